@@ -1,272 +1,304 @@
 /* Animations.cpp
    Procedural animations implementation
-   VERSION: V16.2.3-2026-01-10T21:40:00Z - Namespace-based (NO CLASS)
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scopes: procedural frames and render-ahead
+   V16.5.8-2026-01-13T09:00:00Z - Chase and Sparkling Stars are periodic: frames cached in PSRAM
+   V16.5.8-2026-01-13T09:00:00Z - Chase/Sparkling Stars render frame N as a pure function of N
+                                  (Chase: 172-frame bounce cycle; Stars: fixed seed, 40-frame loop)
+   V16.5.7-2026-01-13T06:00:00Z - Per-matrix frames (drawProcedural) for zone playback
+   V16.5.7-2026-01-13T06:00:00Z - Animation state per matrix; loops over MATRIX_COUNT instead of 2;
+                                  the three snowfalls share one renderer with per-variant settings
+   V16.5.5-2026-01-13T00:00:00Z - "Tree ..." names go to the Mega Tree
+   V16.5.0-2026-01-12T09:00:00Z - runProcedural() dispatcher
+   V16.2.3-2026-01-10T21:40:00Z - Namespace-based (NO CLASS)
 */
 
 #include "Animations.h"
 #include <FastLED.h>
+#include "Effects.h"
+#include "MegaTree.h"
+#include "FrameCache.h"
+#include "ThemeManager.h"
+#include "Profiler.h"
+
+extern ThemeManager themeManager;
 
 // V16.2.3-2026-01-10T21:40:00Z - Procedural animations in namespace (NOT a class!)
 
 namespace Animations {
 
-// Chase animation - diagonal lines bouncing
-void chase(MatrixDisplay* disp) {
-    static int position = 0;
-    static int direction = 1;
-    static int colorIndex = 0;
-    static unsigned long lastUpdate = 0;
-    
-    unsigned long now = millis();
-    if (now - lastUpdate < 50) return;
-    lastUpdate = now;
-    
-    disp->clear();
-    
+namespace {
+
+// V16.5.7-2026-01-13T06:00:00Z - Snowfall variants differ only in these numbers
+struct SnowConfig {
+    int flakes;
+    int dxSpread;   // dx = (random(dxSpread) - dxSpread / 2) / 100
+    int dyRange;    // dy = (random(dyRange) + dyMin) / 100
+    int dyMin;
+};
+const SnowConfig SNOW_STANDARD = {50, 200, 50, 50};
+const SnowConfig SNOW_GENTLE = {30, 100, 30, 20};
+const SnowConfig SNOW_HEAVY = {80, 300, 80, 80};
+const int MAX_FLAKES = 80;
+
+struct SnowState {
+    struct Flake {
+        float x, y, dx, dy;
+    } flakes[MAX_FLAKES];
+    const SnowConfig* config = nullptr;  // Variant the flakes were seeded for
+};
+SnowState snowState[MATRIX_COUNT];
+
+// Chase animation - diagonal lines bouncing between x = -(ROWS - 1) and COLS - 1.
+// V16.5.8-2026-01-13T09:00:00Z - Position and color from the frame number: a bounce is
+// 2 * CHASE_SPAN frames, colors advance at each end and repeat after 4 ends.
+const int CHASE_SPAN = (COLS - 1) + (ROWS - 1);
+const uint16_t CHASE_PERIOD = 4 * CHASE_SPAN;
+
+void chaseFrame(uint32_t frame, uint32_t, CRGB* block, const uint16_t* xy) {
     CRGB colors[] = {CRGB::Red, CRGB::Green, CRGB::Cyan, CRGB::White};
     
     int spacing = 8;
     // V16.2.4-2026-01-10T21:52:00Z - Use Config.h COLS/ROWS macros
     
-    for (int matrix = 0; matrix < 2; matrix++) {
-        for (int lineNum = 0; lineNum < 3; lineNum++) {
-            int linePosition = position + (lineNum * spacing);
-            CRGB lineColor = colors[(colorIndex + lineNum) % 4];
-            
-            for (int offset = -ROWS; offset < COLS; offset++) {
-                if (offset == linePosition) {
-                    for (int i = 0; i < ROWS; i++) {
-                        int x = offset + i;
-                        int y = i;
-                        if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
-                            disp->setPixel(matrix, x, y, lineColor);
-                        }
-                    }
-                }
+    // Starts at 0 moving right: phase counts from the left end
+    uint32_t phase = frame + (ROWS - 1);
+    int u = phase % (2 * CHASE_SPAN);
+    int position = -(ROWS - 1) + (u <= CHASE_SPAN ? u : 2 * CHASE_SPAN - u);
+    int colorIndex = phase / CHASE_SPAN;
+    
+    for (int lineNum = 0; lineNum < 3; lineNum++) {
+        int linePosition = position + (lineNum * spacing);
+        CRGB lineColor = colors[(colorIndex + lineNum) % 4];
+        if (linePosition < -ROWS || linePosition >= COLS) continue;
+        
+        for (int i = 0; i < ROWS; i++) {
+            int x = linePosition + i;
+            int y = i;
+            if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
+                block[xy[y * COLS + x]] = lineColor;
             }
         }
     }
-    
-    position += direction;
-    if (position >= COLS - 1) {
-        position = COLS - 1;
-        direction = -1;
-        colorIndex++;
-    } else if (position <= -(ROWS - 1)) {
-        position = -(ROWS - 1);
-        direction = 1;
-        colorIndex++;
-    }
-    
-    disp->show();
 }
 
-// Snowfall animation - standard speed
-void snowfall(MatrixDisplay* disp) {
-    // V16.2.4-2026-01-10T21:52:00Z - Use Config.h COLS/ROWS macros
-    const int MAX_FLAKES = 50;
+void snowfall(MatrixDisplay* disp, int matrix, const SnowConfig& config) {
     const CRGB SNOW_WHITE = CRGB(220, 240, 255);
-    
-    static struct Flake {
-        float x, y, dx, dy;
-    } flakes[2][MAX_FLAKES];
-    
-    static bool initialized = false;
-    static unsigned long lastUpdate = 0;
-    
-    if (!initialized) {
-        for (int m = 0; m < 2; m++) {
-            for (int i = 0; i < MAX_FLAKES; i++) {
-                flakes[m][i].x = random(COLS);
-                flakes[m][i].y = random(ROWS);
-                flakes[m][i].dx = (random(200) - 100) / 100.0f;
-                flakes[m][i].dy = (random(50) + 50) / 100.0f;
-            }
+    SnowState& s = snowState[matrix];
+    
+    if (s.config != &config) {
+        for (int i = 0; i < config.flakes; i++) {
+            s.flakes[i].x = random(COLS);
+            s.flakes[i].y = random(ROWS);
+            s.flakes[i].dx = (random(config.dxSpread) - config.dxSpread / 2) / 100.0f;
+            s.flakes[i].dy = (random(config.dyRange) + config.dyMin) / 100.0f;
         }
-        initialized = true;
+        s.config = &config;
     }
     
-    unsigned long now = millis();
-    if (now - lastUpdate < 50) return;
-    lastUpdate = now;
-    
-    disp->clear();
-    
-    for (int m = 0; m < 2; m++) {
-        for (int i = 0; i < MAX_FLAKES; i++) {
-            flakes[m][i].x += flakes[m][i].dx;
-            flakes[m][i].y -= flakes[m][i].dy;
-            
-            if (flakes[m][i].x < 0) flakes[m][i].x = COLS - 1;
-            if (flakes[m][i].x >= COLS) flakes[m][i].x = 0;
-            if (flakes[m][i].y < 0) {
-                flakes[m][i].y = ROWS - 1;
-                flakes[m][i].x = random(COLS);
-            }
-            
-            int x = (int)flakes[m][i].x;
-            int y = (int)flakes[m][i].y;
-            if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
-                disp->setPixel(m, x, y, SNOW_WHITE);
-            }
+    for (int i = 0; i < config.flakes; i++) {
+        auto& f = s.flakes[i];
+        f.x += f.dx;
+        f.y -= f.dy;
+        
+        if (f.x < 0) f.x = COLS - 1;
+        if (f.x >= COLS) f.x = 0;
+        if (f.y < 0) {
+            f.y = ROWS - 1;
+            f.x = random(COLS);
+        }
+        
+        int x = (int)f.x;
+        int y = (int)f.y;
+        if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
+            disp->setPixel(matrix, x, y, SNOW_WHITE);
         }
     }
-    
-    disp->show();
 }
 
-// Gentle snowfall - slower
-void snowfallGentle(MatrixDisplay* disp) {
-    // V16.2.4-2026-01-10T21:52:00Z - Use Config.h COLS/ROWS macros
-    const int MAX_FLAKES = 30;
-    const CRGB SNOW_WHITE = CRGB(220, 240, 255);
-    
-    static struct Flake {
-        float x, y, dx, dy;
-    } flakes[2][MAX_FLAKES];
-    
-    static bool initialized = false;
-    static unsigned long lastUpdate = 0;
+// Sparkling stars animation
+// V16.5.8-2026-01-13T09:00:00Z - Sparkles from a per-frame seeded generator instead of random()
+const uint16_t STARS_PERIOD = 40;   // 4 s at 100 ms
+
+void starsFrame(uint32_t frame, uint32_t seed, CRGB* block, const uint16_t* xy) {
+    int cx = COLS / 2;
+    int cy = ROWS / 2;
     
-    if (!initialized) {
-        for (int m = 0; m < 2; m++) {
-            for (int i = 0; i < MAX_FLAKES; i++) {
-                flakes[m][i].x = random(COLS);
-                flakes[m][i].y = random(ROWS);
-                flakes[m][i].dx = (random(100) - 50) / 100.0f;
-                flakes[m][i].dy = (random(30) + 20) / 100.0f;
-            }
+    // Main star lines
+    for (int i = -8; i <= 8; i++) {
+        if (cx + i >= 0 && cx + i < COLS) {
+            block[xy[cy * COLS + cx + i]] = CRGB::Yellow;
+        }
+        if (cy + i >= 0 && cy + i < ROWS) {
+            block[xy[(cy + i) * COLS + cx]] = CRGB::Yellow;
         }
-        initialized = true;
     }
     
-    unsigned long now = millis();
-    if (now - lastUpdate < 80) return;
-    lastUpdate = now;
-    
-    disp->clear();
-    
-    for (int m = 0; m < 2; m++) {
-        for (int i = 0; i < MAX_FLAKES; i++) {
-            flakes[m][i].x += flakes[m][i].dx;
-            flakes[m][i].y -= flakes[m][i].dy;
-            
-            if (flakes[m][i].x < 0) flakes[m][i].x = COLS - 1;
-            if (flakes[m][i].x >= COLS) flakes[m][i].x = 0;
-            if (flakes[m][i].y < 0) {
-                flakes[m][i].y = ROWS - 1;
-                flakes[m][i].x = random(COLS);
-            }
-            
-            int x = (int)flakes[m][i].x;
-            int y = (int)flakes[m][i].y;
-            if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
-                disp->setPixel(m, x, y, SNOW_WHITE);
-            }
+    // Diagonal lines
+    for (int i = -6; i <= 6; i++) {
+        if (cx + i >= 0 && cx + i < COLS && cy + i >= 0 && cy + i < ROWS) {
+            block[xy[(cy + i) * COLS + cx + i]] = CRGB::Yellow;
+            block[xy[(cy - i) * COLS + cx + i]] = CRGB::Yellow;
         }
     }
     
-    disp->show();
+    // Random sparkles (xorshift32, seeded per frame)
+    uint32_t r = (seed ^ (frame * 0x9E3779B9u)) | 1;
+    for (int i = 0; i < 20; i++) {
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        int x = (r >> 8) % COLS;
+        int y = (r >> 16) % ROWS;
+        if (r & 1) {
+            block[xy[y * COLS + x]] = CRGB::White;
+        }
+    }
 }
 
-// Heavy snowfall - faster
-void snowfallHeavy(MatrixDisplay* disp) {
-    // V16.2.4-2026-01-10T21:52:00Z - Use Config.h COLS/ROWS macros
-    const int MAX_FLAKES = 80;
-    const CRGB SNOW_WHITE = CRGB(220, 240, 255);
-    
-    static struct Flake {
-        float x, y, dx, dy;
-    } flakes[2][MAX_FLAKES];
-    
-    static bool initialized = false;
-    static unsigned long lastUpdate = 0;
-    
-    if (!initialized) {
-        for (int m = 0; m < 2; m++) {
-            for (int i = 0; i < MAX_FLAKES; i++) {
-                flakes[m][i].x = random(COLS);
-                flakes[m][i].y = random(ROWS);
-                flakes[m][i].dx = (random(300) - 150) / 100.0f;
-                flakes[m][i].dy = (random(80) + 80) / 100.0f;
-            }
-        }
-        initialized = true;
+// V16.5.8-2026-01-13T09:00:00Z - Procedurals whose frame N depends only on N (and the seed).
+// usesPalette: frames bake in theme colors, so a theme change must miss the cache.
+struct Periodic {
+    const char* name;
+    uint16_t period;
+    uint32_t seed;
+    bool usesPalette;
+    void (*render)(uint32_t frame, uint32_t seed, CRGB* block, const uint16_t* xy);
+};
+
+const Periodic PERIODIC[] = {
+    {"Chase",           CHASE_PERIOD, 0,       false, chaseFrame},
+    {"Sparkling Stars", STARS_PERIOD, 0x57A25, false, starsFrame},
+};
+
+// Playback position per matrix
+struct PeriodicPlay {
+    const Periodic* proc = nullptr;
+    uint16_t frame = 0;
+    unsigned long lastDrawn = 0;
+};
+PeriodicPlay periodicPlay[MATRIX_COUNT];
+
+const Periodic* findPeriodic(const String& name) {
+    for (const auto& p : PERIODIC) {
+        if (name == p.name) return &p;
     }
-    
+    return nullptr;
+}
+
+FrameKey keyFor(const Periodic& p) {
+    uint32_t params = p.seed * 31 + COLS * 1000 + ROWS;
+    if (p.usesPalette) params ^= themeManager.getPaletteGeneration() * 0x9E3779B9u;
+    return FrameKey{p.name, p.period, params};
+}
+
+// One matrix block: cached copy, or render and keep it
+bool drawPeriodic(const Periodic& p, MatrixDisplay* disp, int matrix, unsigned long now) {
+    const uint16_t* xy = disp->getIndexTable(0);  // Matrix-local indices; every matrix is wired alike
+    if (!xy) return false;
+    
+    PeriodicPlay& play = periodicPlay[matrix];
+    if (play.proc != &p) {
+        play.proc = &p;
+        play.frame = 0;
+    }
+    play.lastDrawn = now;
+    
+    CRGB* block = disp->getLeds() + matrix * MATRIX_LEDS;
+    FrameKey key = keyFor(p);
+    if (!frameCache.fetch(key, play.frame, block)) {
+        fill_solid(block, MATRIX_LEDS, CRGB::Black);
+        p.render(play.frame, p.seed, block, xy);
+        frameCache.store(key, play.frame, block);
+    }
+    play.frame = (play.frame + 1) % p.period;
+    return true;
+}
+
+} // namespace
+
+uint16_t frameInterval(const String& name) {
+    if (name == "Chase") return 50;
+    if (name == "Snowfall") return 50;
+    if (name == "Snowfall Gentle") return 80;
+    if (name == "Snowfall Heavy") return 30;
+    if (name == "Sparkling Stars") return 100;
+    if (Effects::isEffect(name)) return EFFECT_FRAME_MS;
+    return 0;
+}
+
+bool drawProcedural(const String& name, MatrixDisplay* disp, int matrix, uint32_t now) {
+    if (matrix < 0 || matrix >= MATRIX_COUNT) return false;
+    
+    // V16.5.8-2026-01-13T09:00:00Z - Periodic procedurals go through the frame cache
+    const Periodic* periodic = findPeriodic(name);
+    if (periodic) return drawPeriodic(*periodic, disp, matrix, now);
+    periodicPlay[matrix].proc = nullptr;
+    
+    if (Effects::isEffect(name)) return Effects::drawMatrix(name, disp, matrix, now);
+    
+    disp->clearMatrix(matrix);
+    if (name == "Snowfall") {
+        snowfall(disp, matrix, SNOW_STANDARD);
+    } else if (name == "Snowfall Gentle") {
+        snowfall(disp, matrix, SNOW_GENTLE);
+    } else if (name == "Snowfall Heavy") {
+        snowfall(disp, matrix, SNOW_HEAVY);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// V16.5.8-2026-01-13T09:00:00Z - Fill the rings of what is playing, nearest upcoming frames first
+void renderAhead(MatrixDisplay* disp, uint32_t budgetUs) {
+    static CRGB scratch[MATRIX_LEDS];
+    const uint16_t* xy = disp->getIndexTable(0);
+    if (!xy) return;
+    PROFILE_SCOPE("renderAhead");  // V16.7.2-2026-01-14T15:00:00Z
+    
+    uint32_t start = micros();
     unsigned long now = millis();
-    if (now - lastUpdate < 30) return;
-    lastUpdate = now;
-    
-    disp->clear();
-    
-    for (int m = 0; m < 2; m++) {
-        for (int i = 0; i < MAX_FLAKES; i++) {
-            flakes[m][i].x += flakes[m][i].dx;
-            flakes[m][i].y -= flakes[m][i].dy;
-            
-            if (flakes[m][i].x < 0) flakes[m][i].x = COLS - 1;
-            if (flakes[m][i].x >= COLS) flakes[m][i].x = 0;
-            if (flakes[m][i].y < 0) {
-                flakes[m][i].y = ROWS - 1;
-                flakes[m][i].x = random(COLS);
-            }
-            
-            int x = (int)flakes[m][i].x;
-            int y = (int)flakes[m][i].y;
-            if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
-                disp->setPixel(m, x, y, SNOW_WHITE);
-            }
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        const PeriodicPlay& play = periodicPlay[m];
+        if (!play.proc || now - play.lastDrawn > 1000) continue;  // Not playing any more
+        
+        FrameKey key = keyFor(*play.proc);
+        while (micros() - start < budgetUs) {
+            int frame = frameCache.nextMissing(key, play.frame);
+            if (frame < 0) break;
+            fill_solid(scratch, MATRIX_LEDS, CRGB::Black);
+            play.proc->render(frame, play.proc->seed, scratch, xy);
+            frameCache.store(key, frame, scratch);
+            frameCache.countAhead();
         }
     }
-    
-    disp->show();
 }
 
-// Sparkling stars animation
-void sparklingStars(MatrixDisplay* disp) {
-    // V16.2.4-2026-01-10T21:52:00Z - Use Config.h COLS/ROWS macros
-    static unsigned long lastUpdate = 0;
+// V16.5.0-2026-01-12T09:00:00Z - Single name -> procedural dispatch (was duplicated in
+// ContentManager and Scheduler, and neither knew "Color Wave")
+// V16.5.7-2026-01-13T06:00:00Z - Every matrix gets the same procedural, one show() per frame
+bool runProcedural(const String& name, MatrixDisplay* disp) {
+#if ENABLE_MEGATREE
+    if (name.startsWith("Tree ")) {
+        return megaTree.run(name, disp);  // V16.5.5-2026-01-13T00:00:00Z
+    }
+#endif
+    static unsigned long lastFrame = 0;
+    uint16_t interval = frameInterval(name);
+    if (interval == 0) return false;
     
     unsigned long now = millis();
-    if (now - lastUpdate < 100) return;
-    lastUpdate = now;
-    
-    disp->clear();
-    
-    int cx = COLS / 2;
-    int cy = ROWS / 2;
-    
-    for (int matrix = 0; matrix < 2; matrix++) {
-        // Main star lines
-        for (int i = -8; i <= 8; i++) {
-            if (cx + i >= 0 && cx + i < COLS) {
-                disp->setPixel(matrix, cx + i, cy, CRGB::Yellow);
-            }
-            if (cy + i >= 0 && cy + i < ROWS) {
-                disp->setPixel(matrix, cx, cy + i, CRGB::Yellow);
-            }
-        }
-        
-        // Diagonal lines
-        for (int i = -6; i <= 6; i++) {
-            if (cx + i >= 0 && cx + i < COLS && cy + i >= 0 && cy + i < ROWS) {
-                disp->setPixel(matrix, cx + i, cy + i, CRGB::Yellow);
-                disp->setPixel(matrix, cx + i, cy - i, CRGB::Yellow);
-            }
-        }
-        
-        // Random sparkles
-        for (int i = 0; i < 20; i++) {
-            int x = random(COLS);
-            int y = random(ROWS);
-            if (random(2)) {
-                disp->setPixel(matrix, x, y, CRGB::White);
-            }
-        }
+    if (now - lastFrame < interval) {
+        renderAhead(disp, FRAME_CACHE_AHEAD_US);  // V16.5.8 - Idle until the next frame
+        return true;
     }
+    lastFrame = now;
+    PROFILE_SCOPE("procedural frame");  // V16.7.2-2026-01-14T15:00:00Z
     
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        PROFILE_SCOPE("drawProcedural");
+        drawProcedural(name, disp, m, now);
+    }
     disp->show();
+    return true;
 }
 
 } // namespace Animations
@@ -1,6 +1,9 @@
 /* Animations.h
    Procedural animations header
-   VERSION: V16.2.3-2026-01-10T21:40:00Z - Namespace-based (NO CLASS)
+   VERSION: V16.5.8-2026-01-13T09:00:00Z - renderAhead(): fill frame caches of periodic procedurals
+   V16.5.7-2026-01-13T06:00:00Z - drawProcedural(): one matrix, no show() (zone playback)
+   V16.5.0-2026-01-12T09:00:00Z - runProcedural() dispatcher shared by all callers
+   V16.2.3-2026-01-10T21:40:00Z - Namespace-based (NO CLASS)
 */
 
 #pragma once
@@ -22,9 +25,19 @@ protected:
 
 // V16.2.3-2026-01-10T21:40:00Z - Procedural animation namespace (NOT a class!)
 namespace Animations {
-    void chase(MatrixDisplay* disp);
-    void snowfall(MatrixDisplay* disp);
-    void snowfallGentle(MatrixDisplay* disp);
-    void snowfallHeavy(MatrixDisplay* disp);
-    void sparklingStars(MatrixDisplay* disp);
+    // V16.5.0-2026-01-12T09:00:00Z - One step of a procedural by registered name
+    // (Chase, Snowfall*, Sparkling Stars or Effects kernels) on every matrix, rate-limited,
+    // calls show(). Returns false for unknown names.
+    bool runProcedural(const String& name, MatrixDisplay* disp);
+    
+    // V16.5.7-2026-01-13T06:00:00Z - One frame into a single matrix: clears and redraws only
+    // that matrix, no rate limit, no show(). State (flakes, chase position) is per matrix.
+    bool drawProcedural(const String& name, MatrixDisplay* disp, int matrix, uint32_t now);
+    
+    // Frame interval in ms for a procedural; 0 if the name is unknown (or a "Tree ..." effect)
+    uint16_t frameInterval(const String& name);
+    
+    // V16.5.8-2026-01-13T09:00:00Z - Spend up to budgetUs rendering not-yet-cached frames of the
+    // periodic procedurals currently playing (FrameCache.h). Call when a frame is not due.
+    void renderAhead(MatrixDisplay* disp, uint32_t budgetUs);
 }
@@ -0,0 +1,82 @@
+/* ColorPipeline.cpp
+   Per-output color correction implementation
+   VERSION: V16.5.4-2026-01-12T21:00:00Z - Power-limit scale and channel sums in the same pass
+   V16.5.3-2026-01-12T18:00:00Z - Initial implementation
+*/
+
+#include "ColorPipeline.h"
+#include <math.h>
+
+ColorPipeline::ColorPipeline()
+: brightness(DEFAULT_BRIGHTNESS), ditherBelow(DITHER_BELOW_BRIGHTNESS) {
+    const float gammas[3] = {OUTPUT0_GAMMA, OUTPUT1_GAMMA, OUTPUT2_GAMMA};
+    const uint32_t whites[3] = {OUTPUT0_WHITE, OUTPUT1_WHITE, OUTPUT2_WHITE};
+    for (int o = 0; o < OUTPUT_COUNT; o++) {
+        outputs[o].gamma = gammas[o];
+        outputs[o].white = CRGB(whites[o]);
+        dirty[o] = true;
+    }
+}
+
+void ColorPipeline::setOutput(int output, float gamma, CRGB white) {
+    if (output < 0 || output >= OUTPUT_COUNT) return;
+    outputs[output].gamma = constrain(gamma, 1.0f, 3.0f);
+    outputs[output].white = white;
+    dirty[output] = true;
+}
+
+void ColorPipeline::setBrightness(uint8_t value) {
+    if (value == brightness) return;
+    brightness = value;
+    for (int o = 0; o < OUTPUT_COUNT; o++) dirty[o] = true;
+}
+
+void ColorPipeline::rebuild(int output) {
+    const OutputColor& oc = outputs[output];
+    float level = powf(brightness / 255.0f, BRIGHTNESS_CURVE);
+    uint8_t white[3] = {oc.white.r, oc.white.g, oc.white.b};
+
+    for (int ch = 0; ch < 3; ch++) {
+        float scale = level * white[ch] * 256.0f;  // 8.8: full white at full level = 255 << 8
+        uint16_t* table = lut[output][ch];
+        for (int v = 0; v < 256; v++) {
+            table[v] = (uint16_t)(powf(v / 255.0f, oc.gamma) * scale + 0.5f);
+        }
+    }
+    dirty[output] = false;
+}
+
+void ColorPipeline::beginFrame() {
+    frameCount++;
+}
+
+void ColorPipeline::apply(int output, const CRGB* src, CRGB* dst, int count,
+                          uint16_t scale, ChannelSums& sums) {
+    if (dirty[output]) rebuild(output);
+    const uint16_t* lr = lut[output][0];
+    const uint16_t* lg = lut[output][1];
+    const uint16_t* lb = lut[output][2];
+    uint32_t sr = 0, sg = 0, sb = 0;
+
+    // Rounding (no dither) or an 8-frame threshold cycle, offset by pixel index.
+    // Table max is 255 << 8, so adding a threshold < 256 can't overflow 8 bits after >> 8.
+    bool dither = brightness < ditherBelow;
+    uint8_t phase = frameCount;
+    for (int i = 0; i < count; i++) {
+        uint16_t d = dither ? (uint16_t)((((phase + i) & 7) << 5) + 16) : 128;
+        uint8_t r = (((lr[src[i].r] * scale) >> 8) + d) >> 8;
+        uint8_t g = (((lg[src[i].g] * scale) >> 8) + d) >> 8;
+        uint8_t b = (((lb[src[i].b] * scale) >> 8) + d) >> 8;
+        dst[i].r = r;
+        dst[i].g = g;
+        dst[i].b = b;
+        sr += r;
+        sg += g;
+        sb += b;
+    }
+
+    sums.r = sr;
+    sums.g = sg;
+    sums.b = sb;
+    sums.count = count;
+}
@@ -0,0 +1,65 @@
+/* ColorPipeline.h
+   Per-output gamma, white point and brightness, folded into lookup tables
+   VERSION: V16.5.4-2026-01-12T21:00:00Z - Power-limit scale and channel sums in the same pass
+   V16.5.3-2026-01-12T18:00:00Z - Initial implementation
+
+   Each output (physical LED string) gets three 256-entry tables, one per channel:
+     lut[ch][v] = (v/255)^gamma * white[ch]/255 * (brightness/255)^curve
+   stored as 8.8 fixed point. MatrixDisplay::show() maps the content frame through
+   them into the buffer FastLED sends - one lookup per channel, no per-pixel math.
+   Tables are rebuilt only after a setting changes (next show()).
+   At low brightness the fractional bits drive a temporal dither: each pixel adds a
+   threshold that cycles over 8 frames (offset by pixel index, so neighbours are out
+   of phase), giving in-between levels instead of hard 8-bit banding.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Config.h"
+
+// V16.5.3-2026-01-12T18:00:00Z - Per-output settings
+struct OutputColor {
+    float gamma;
+    CRGB white;   // Channel scale at full white (LED batch correction)
+};
+
+// V16.5.4-2026-01-12T21:00:00Z - Sum of sent channel values, for the power model
+struct ChannelSums {
+    uint32_t r;
+    uint32_t g;
+    uint32_t b;
+    uint16_t count;   // LEDs on the output
+};
+
+class ColorPipeline {
+public:
+    ColorPipeline();
+
+    void setOutput(int output, float gamma, CRGB white);
+    const OutputColor& getOutput(int output) const { return outputs[output]; }
+
+    void setBrightness(uint8_t value);
+    uint8_t getBrightness() const { return brightness; }
+
+    // Dither while brightness is below this (0 = never)
+    void setDitherBelow(uint8_t value) { ditherBelow = value; }
+    uint8_t getDitherBelow() const { return ditherBelow; }
+
+    // Once per shown frame, before apply(); advances the dither phase
+    void beginFrame();
+    // src -> dst for one output's LEDs, single pass. scale (0-256, 256 = unchanged) is the
+    // power limiter's; sums receives the channel totals actually sent.
+    void apply(int output, const CRGB* src, CRGB* dst, int count, uint16_t scale, ChannelSums& sums);
+
+private:
+    OutputColor outputs[OUTPUT_COUNT];
+    uint16_t lut[OUTPUT_COUNT][3][256];
+    bool dirty[OUTPUT_COUNT];
+    uint8_t brightness;
+    uint8_t ditherBelow;
+    uint8_t frameCount = 0;
+
+    void rebuild(int output);
+};
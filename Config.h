@@ -19,6 +19,14 @@
 
 #define HOSTNAME "palombaro-matrix"
 
+// ========== TIME CONFIGURATION ==========
+// V16.4.2-2026-01-11T14:00:00Z - Background NTP service with POSIX TZ rules
+#define NTP_SERVER "pool.ntp.org"
+#define TIMEZONE_POSIX "EST5EDT,M3.2.0,M11.1.0"  // US Eastern, DST 2nd Sun Mar - 1st Sun Nov
+#define NTP_SYNC_INTERVAL_MS 3600000UL  // Re-sync hourly; drift model covers the gap
+#define NTP_RETRY_MIN_MS 15000UL        // Failed sync backoff, doubling...
+#define NTP_RETRY_MAX_MS 300000UL       // ...up to 5 minutes
+
 // ========== FEATURE ENABLE/DISABLE FLAGS ==========
 #define ENABLE_MEGAMATRIX false  // V16.1.2 - Matrix 2 disabled (future)
 #define ENABLE_MEGATREE false    // V16.1.2 - Mega tree disabled (future)
@@ -45,17 +53,17 @@
 
 // V16.1.2 - Mega Tree Configuration (DISABLED)
 #define PIN_MEGATREE 19
-#define MEGATREE_LEDS 1000       // 20 branches Ã— 50 LEDs
+#define MEGATREE_LEDS 1000       // 20 branches × 50 LEDs
 #define MEGATREE_BRANCHES 20
 #define MEGATREE_LEDS_PER_BRANCH 50
+// V16.5.5-2026-01-13T00:00:00Z - Wiring and effect sampling (MegaTree.h)
+#define MEGATREE_TOP_FIRST true      // LED 0 of each branch is at the star
+#define MEGATREE_ZIGZAG false        // true: odd branches run the other way
+#define MEGATREE_GRID 32             // 2D effects are rendered at GRID x GRID and sampled
 
 // Legacy compatibility names
-#define MATRIX1_ROWS MATRIX0_ROWS
-#define MATRIX1_COLS MATRIX0_COLS
-#define MATRIX1_LEDS MATRIX0_LEDS
-#define MATRIX2_ROWS MATRIX1_ROWS
-#define MATRIX2_COLS MATRIX1_COLS
-#define MATRIX2_LEDS MATRIX1_LEDS
+// V16.5.0-2026-01-12T09:00:00Z - Removed MATRIX1_*/MATRIX2_* re-aliases; they redefined the
+//                                real macros above and shrank Matrix 2 to 25x20
 #define ROWS MATRIX0_ROWS
 #define COLS MATRIX0_COLS
 #define MATRIX_LEDS MATRIX0_LEDS
@@ -69,18 +77,119 @@
   #define TOTAL_LEDS (MATRIX0_LEDS + MATRIX1_LEDS)  // 1000 (current setup)
 #endif
 
+// V16.5.0-2026-01-12T09:00:00Z - Matrices driven through MatrixDisplay's index tables
+// (the Mega Matrix has no output wiring yet, so it is not counted even when enabled)
+#define MATRIX_COUNT 2
+
 #define COLOR_ORDER RGB
 #define LED_TYPE WS2811
 
 // Display Settings
 #define DEFAULT_BRIGHTNESS 20
 
+// V16.5.3-2026-01-12T18:00:00Z - Per-output color pipeline (ColorPipeline.h). The two
+// windows use different LED batches, so each string has its own gamma and white point.
+// V16.5.5-2026-01-13T00:00:00Z - Output 2 is the Mega Tree when enabled
+#if ENABLE_MEGATREE
+  #define OUTPUT_COUNT 3
+#else
+  #define OUTPUT_COUNT 2               // 0 = PIN_LEFT (leds 0-499), 1 = PIN_RIGHT (leds 500-999)
+#endif
+#define OUTPUT0_GAMMA 2.2f
+#define OUTPUT0_WHITE 0xFFB0F0         // FastLED TypicalLEDStrip
+#define OUTPUT1_GAMMA 2.2f
+#define OUTPUT1_WHITE 0xFFB0F0
+#define OUTPUT2_GAMMA 2.2f             // Mega Tree
+#define OUTPUT2_WHITE 0xFFB0F0
+#define BRIGHTNESS_CURVE 1.0f          // Exponent applied to the brightness setting
+#define DITHER_BELOW_BRIGHTNESS 96     // Temporal dithering below this brightness (0 = off)
+
+// V16.5.4-2026-01-12T21:00:00Z - Power model and limits per output (PowerLimiter.h).
+// Edit for the actual pixels and supplies; a budget of 0 disables that limit.
+#define OUTPUT0_VOLTS 12.0f
+#define OUTPUT0_MA_PER_CHANNEL 20      // One channel at full, per LED
+#define OUTPUT0_IDLE_MA 1.0f           // Per LED, all channels off
+#define OUTPUT0_BUDGET_MA 8000         // Supply/injection limit for this string
+#define OUTPUT1_VOLTS 12.0f
+#define OUTPUT1_MA_PER_CHANNEL 20
+#define OUTPUT1_IDLE_MA 1.0f
+#define OUTPUT1_BUDGET_MA 8000
+#define OUTPUT2_VOLTS 12.0f            // Mega Tree
+#define OUTPUT2_MA_PER_CHANNEL 20
+#define OUTPUT2_IDLE_MA 1.0f
+#define OUTPUT2_BUDGET_MA 15000
+#define POWER_BUDGET_W 150.0f          // All outputs together
+
 // V16.1.2 - Display intervals
 #define STATIC_SCENE_INTERVAL 5000    // 5 seconds for static scenes
 #define ANIMATION_INTERVAL 8000       // 8 seconds for animations
 #define SCROLL_INTERVAL 10000         // 10 seconds for scroll text
 #define SCENE_INTERVAL 5000           // Legacy compatibility
 
+// V16.5.7-2026-01-13T06:00:00Z - Zone playback (ZoneManager.h)
+#define ZONE_TRANSITION_MS 400        // Cross-fade when a zone switches content (0 = cut)
+
+// V16.5.8-2026-01-13T09:00:00Z - Render-ahead cache for periodic procedurals (FrameCache.h)
+#define FRAME_CACHE_BYTES (512 * 1024)  // PSRAM, all rings together (1.5 KB per frame)
+#define FRAME_CACHE_RINGS 4
+#define FRAME_CACHE_AHEAD_US 2000       // Render-ahead time per idle pass
+
+// V16.6.0-2026-01-13T12:00:00Z - Async web server (WebController.h)
+#define WEB_QUEUE_MAX 16                // Requests waiting for loop(); more get 503
+#define WEB_BODY_MAX 4096               // V16.6.5 - POST bodies (onPost); larger get 413
+#define BATCH_MAX_COMMANDS 32           // V16.6.5 - Commands per /api/batch request
+
+// V16.6.1-2026-01-13T15:00:00Z - Static UI in the content image (tools/gzip_web.py)
+#define WEB_ASSET_PREFIX "web/"         // Stored as web/<file>.gz, served gzip-encoded
+#define WEB_ASSET_MAX_AGE 31536000      // s; assets are versioned by index.html (?v=<hash>)
+
+// V16.6.2-2026-01-13T18:00:00Z - Generated pages/JSON kept until their state changes (ResponseCache.h)
+#define WEB_CACHE_MAX_BODY (32 * 1024)  // Larger bodies are streamed uncached
+
+// V16.6.3-2026-01-13T21:00:00Z - Live preview over WebSocket (LivePreview.h)
+#define PREVIEW_FPS 10                  // Default rate; /api/preview?fps=N changes it
+#define PREVIEW_FPS_MAX 30
+#define PREVIEW_MAX_CLIENTS 3           // 3 KB base frame each while connected
+
+// V16.6.4-2026-01-14T00:00:00Z - Server-sent events (EventStream.h)
+#define SSE_POLL_MS 100                 // State/log check while a client is connected
+#define SSE_HEARTBEAT_MS 10000          // State is resent this often even if unchanged
+#define SSE_BACKLOG 20                  // Log lines replayed to a (re)connecting client
+#define SSE_BURST 16                    // Log lines per poll; the library queues 32 per client
+#define SSE_CONNECT_MS 1000             // V16.7.4 - Broadcast held for a connecting client at most this long
+
+// V16.7.0-2026-01-14T09:00:00Z - Logger (Logger.h, LogRing.h)
+#define LOG_LEVEL 3                     // 1 error, 2 warn, 3 info, 4 debug; calls below compile out
+#define LOG_SLOTS 128                   // Entries kept (power of two); ~14 KB with the text below
+#define LOG_SLOT_TEXT 100               // Bytes per line, longer ones are truncated
+#define LOG_DRAIN_MS 20                 // Serial output period
+
+// V16.7.1-2026-01-14T12:00:00Z - Crash-surviving event trace (TraceLog.h)
+#define TRACE_PARTITION_LABEL "trace"   // partitions.csv; without it nothing is kept
+#define TRACE_PARTITION_SUBTYPE 0x40    // Custom data subtype
+#define TRACE_RAM_PAGES 4               // RTC memory pages (15 events each) waiting for flash
+#define TRACE_HEAP_MS 60000             // Heap sample period
+#define TRACE_STALL_US 100000           // loop() passes longer than this are traced
+#define TRACE_JSON_MAX 500              // /api/trace?limit= ceiling
+
+// V16.7.2-2026-01-14T15:00:00Z - Frame profiler (Profiler.h)
+#define PROFILER_ENABLED true           // false: PROFILE_SCOPE compiles to nothing
+#define PROFILE_EVENTS 8192             // Ring in PSRAM, 16 bytes per event (power of two)
+#define PROFILE_EVENTS_INTERNAL 1024    // Without PSRAM
+#define PROFILE_DEFAULT_MS 2000
+#define PROFILE_MAX_MS 10000            // Cycle counters wrap after ~17 s at 240 MHz
+
+// V16.7.3-2026-01-14T18:00:00Z - E1.31 / DDP realtime input from xLights (RealtimeReceiver.h)
+#define REALTIME_ENABLED true           // Default for /api/realtime?enable= (saved)
+#define REALTIME_UNIVERSE 1             // First E1.31 universe
+#define REALTIME_UNIVERSE_CHANNELS 510  // 170 pixels per universe (xLights default)
+#define REALTIME_ROW_ORDER true         // Row-major over both windows; false: leds[] wiring order
+#define REALTIME_FRAME_HOLD_MS 40       // A frame that never completes is shown after this
+#define REALTIME_TIMEOUT_MS 2500        // No packets this long: back to scheduled content
+
+// V16.6.6-2026-01-14T06:00:00Z - /metrics (Metrics.h)
+#define METRICS_LOOP_SAMPLES 256        // loop() passes kept for the p50/p99
+
 // --- Run Mode Definitions ---
 #define RUN_MODE_MANUAL 0       
 #define RUN_MODE_SCHEDULE 1     
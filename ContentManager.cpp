@@ -1,5 +1,23 @@
 /* ContentManager.cpp
-   VERSION: V16.2.1-2026-01-10T18:50:00Z - Implemented renderContent with actual display logic
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - postfx "kernel" compared by text ("box" was never matched);
+   heat effects restart with each item; empty matrix1Scene mirrors matrix 0 again;
+   scene document sized for string pixels
+   V16.7.2-2026-01-14T15:00:00Z - Profiler scopes: render, flash read, scene JSON parse
+   V16.7.1-2026-01-14T12:00:00Z - Item starts traced (TraceLog)
+   V16.7.0-2026-01-14T09:00:00Z - Level macros; per-item lines at debug
+   V16.6.6-2026-01-14T06:00:00Z - Content image reads counted (contentFlashRead)
+   V16.6.2-2026-01-13T18:00:00Z - Generation counters for the web response cache
+   V16.6.1-2026-01-13T15:00:00Z - Remember the last rendered item (status API)
+   V16.5.7-2026-01-13T06:00:00Z - drawScene(): one scene slot into one matrix (zones)
+   V16.5.6-2026-01-13T03:00:00Z - renderScene(): native-size pixels resampled to each matrix
+   V16.5.5-2026-01-13T00:00:00Z - Mega Tree effects (ENABLE_MEGATREE)
+   V16.5.2-2026-01-12T15:00:00Z - "postfx" per item; procedural/<theme>/<Name>.json presets
+   V16.5.1-2026-01-12T12:00:00Z - Fire, Embers, Smoke heat-field effects
+   V16.5.0-2026-01-12T09:00:00Z - Procedurals via Animations::runProcedural, effect kernels
+   V16.4.4-2026-01-11T20:00:00Z - Raw file access for theme definitions
+   V16.4.4-2026-01-11T20:00:00Z - Fixed missing brace that skipped the 512-byte advance
+                                  for every file except countdowns
+   V16.2.1-2026-01-10T18:50:00Z - Implemented renderContent with actual display logic
 */
 
 #include "ContentManager.h"
@@ -7,23 +25,58 @@
 #include "Logger.h"
 #include "SceneData.h"
 #include "Animations.h"
+#include "Effects.h"
 #include "Scroll.h"
 #include "Countdown.h"
 #include "ThemeManager.h"
 #include <vector>
 #include "esp_partition.h"
 #include "esp_spi_flash.h"
-#include <NTPClient.h>
+#include "Metrics.h"  // V16.6.6 - contentFlashRead()
+#include "TimeService.h"
+#include "TraceLog.h"
+#include "Profiler.h"
 #include <ArduinoJson.h>  // V16.3.0-2026-01-10T22:42:00Z
 
 // V16.2.5-2026-01-10T22:19:00Z - External references
 extern ThemeManager themeManager;
-extern NTPClient timeClient;
+extern TimeService timeService;
 
 // Custom storage parameters
 #define DATA_PARTITION_OFFSET 0x290000
 #define DATA_AREA_START 0  // V16.1.3-2026-01-09T05:15:00Z - Simple storage starts at offset 0
 
+// V16.5.2-2026-01-12T15:00:00Z - "postfx" object from content JSON (missing keys = pass off)
+static PostFxSettings parsePostFx(JsonVariantConst fx) {
+    PostFxSettings settings;
+    if (fx.isNull()) return settings;
+    settings.blur = fx["blur"] | 0;
+    settings.boxKernel = String(fx["kernel"] | "gauss") == "box";
+    settings.bloomThreshold = fx["bloom"]["threshold"] | 0;
+    settings.bloomAmount = fx["bloom"]["amount"] | 128;
+    settings.trail = fx["trail"] | 0;
+    settings.clamp = fx["clamp"] | 255;
+    return settings;
+}
+
+// V16.5.6-2026-01-13T03:00:00Z - Scaling mode and per-matrix orientation of a scene/animation
+static void parseScaling(JsonVariantConst doc, ContentItem& item) {
+    item.scaling = (doc["scaling"] | "nearest") == String("bilinear") ? RESAMPLE_BILINEAR : RESAMPLE_NEAREST;
+    item.orient[0] = Resampler::parseOrientation(doc["matrix0Orientation"] | "none");
+    item.orient[1] = Resampler::parseOrientation(doc["matrix1Orientation"] | "none");
+    item.orient[2] = Resampler::parseOrientation(doc["matrix2Orientation"] | "none");
+}
+
+// V16.5.6-2026-01-13T03:00:00Z - "#RRGGBB" / "RRGGBB" strings or 0xRRGGBB numbers
+static CRGB parsePixel(JsonVariantConst v) {
+    if (v.is<const char*>()) {
+        const char* hex = v.as<const char*>();
+        if (hex[0] == '#') hex++;
+        return CRGB((uint32_t)strtoul(hex, nullptr, 16));
+    }
+    return CRGB(v.as<uint32_t>());
+}
+
 ContentManager::ContentManager() {
     Serial.println("DEBUG: ContentManager constructor");
 }
@@ -49,6 +102,7 @@ void ContentManager::begin(MatrixDisplay* display) {
     registerTestPatterns();
     
     Logger::instance().log("[ContentManager] Total content: " + String(contentRegistry.size()));
+    contentGeneration++;  // V16.6.2-2026-01-13T18:00:00Z
 }
 
 bool ContentManager::readCustomStorage() {
@@ -57,7 +111,7 @@ bool ContentManager::readCustomStorage() {
     
     // Read file count
     uint32_t file_count = 0;
-    if (esp_flash_read(NULL, &file_count, flash_addr, 4) != ESP_OK) {
+    if (contentFlashRead(&file_count, flash_addr, 4) != ESP_OK) {
         Serial.println("ERROR: Cannot read file count from flash");
         return false;
     }
@@ -76,21 +130,21 @@ bool ContentManager::readCustomStorage() {
     for (uint32_t i = 0; i < file_count; i++) {
         // Read path length (2 bytes)
         uint16_t path_len = 0;
-        if (esp_flash_read(NULL, &path_len, flash_addr, 2) != ESP_OK) break;
+        if (contentFlashRead(&path_len, flash_addr, 2) != ESP_OK) break;
         flash_addr += 2;
         
         if (path_len == 0 || path_len > 255) break;
         
         // Read path
         char path_buf[256];
-        if (esp_flash_read(NULL, path_buf, flash_addr, path_len) != ESP_OK) break;
+        if (contentFlashRead(path_buf, flash_addr, path_len) != ESP_OK) break;
         flash_addr += path_len;
         path_buf[path_len] = '\0';
         String path = String(path_buf);
         
         // Read content length (4 bytes)
         uint32_t content_len = 0;
-        if (esp_flash_read(NULL, &content_len, flash_addr, 4) != ESP_OK) break;
+        if (contentFlashRead(&content_len, flash_addr, 4) != ESP_OK) break;
         flash_addr += 4;
         
         // Store file info (we'll read content on-demand later)
@@ -139,7 +193,7 @@ bool ContentManager::readCustomStorage() {
             
             // V16.3.0-2026-01-10T22:41:00Z - Read JSON to get duration and matrix assignments
             char* json_content = new char[saved_size + 1];
-            if (esp_flash_read(NULL, json_content, saved_offset, saved_size) == ESP_OK) {
+            if (contentFlashRead(json_content, saved_offset, saved_size) == ESP_OK) {
                 json_content[saved_size] = '\0';
                 DynamicJsonDocument doc(1024);
                 if (deserializeJson(doc, json_content) == DeserializationError::Ok) {
@@ -148,6 +202,8 @@ bool ContentManager::readCustomStorage() {
                     String m1 = doc["matrix1Scene"] | m0;  // Default mirror
                     String m2 = doc["matrix2Scene"] | String("");
                     addContent(filename, theme, CONTENT_SCENE, path, duration, m0, m1, m2);
+                    contentRegistry.back().postfx = parsePostFx(doc["postfx"]);  // V16.5.2
+                    parseScaling(doc.as<JsonVariantConst>(), contentRegistry.back());  // V16.5.6
                 } else {
                     addContent(filename, theme, CONTENT_SCENE, path);
                 }
@@ -169,7 +225,7 @@ bool ContentManager::readCustomStorage() {
             
             // V16.3.0-2026-01-10T22:41:00Z - Read timeline JSON for duration
             char* json_content = new char[saved_size + 1];
-            if (esp_flash_read(NULL, json_content, saved_offset, saved_size) == ESP_OK) {
+            if (contentFlashRead(json_content, saved_offset, saved_size) == ESP_OK) {
                 json_content[saved_size] = '\0';
                 DynamicJsonDocument doc(8192);
                 if (deserializeJson(doc, json_content) == DeserializationError::Ok) {
@@ -178,6 +234,8 @@ bool ContentManager::readCustomStorage() {
                     String m1 = doc["matrix1Scene"] | m0;
                     String m2 = doc["matrix2Scene"] | String("");
                     addContent(animName, theme, CONTENT_ANIMATION, path, duration, m0, m1, m2);
+                    contentRegistry.back().postfx = parsePostFx(doc["postfx"]);  // V16.5.2
+                    parseScaling(doc.as<JsonVariantConst>(), contentRegistry.back());  // V16.5.6
                 } else {
                     addContent(animName, theme, CONTENT_ANIMATION, path);
                 }
@@ -199,12 +257,13 @@ bool ContentManager::readCustomStorage() {
             
             // V16.3.0-2026-01-10T22:45:00Z - Parse scroll duration
             char* json_content = new char[saved_size + 1];
-            if (esp_flash_read(NULL, json_content, saved_offset, saved_size) == ESP_OK) {
+            if (contentFlashRead(json_content, saved_offset, saved_size) == ESP_OK) {
                 json_content[saved_size] = '\0';
                 DynamicJsonDocument doc(1024);
                 if (deserializeJson(doc, json_content) == DeserializationError::Ok) {
                     unsigned long duration = doc["durationMs"] | 5000;
                     addContent(filename, theme, CONTENT_SCROLL, path, duration, path, path, "");
+                    contentRegistry.back().postfx = parsePostFx(doc["postfx"]);  // V16.5.2
                 } else {
                     addContent(filename, theme, CONTENT_SCROLL, path);
                 }
@@ -226,12 +285,13 @@ bool ContentManager::readCustomStorage() {
             
             // V16.3.0-2026-01-10T22:45:00Z - Parse countdown duration
             char* json_content = new char[saved_size + 1];
-            if (esp_flash_read(NULL, json_content, saved_offset, saved_size) == ESP_OK) {
+            if (contentFlashRead(json_content, saved_offset, saved_size) == ESP_OK) {
                 json_content[saved_size] = '\0';
                 DynamicJsonDocument doc(1024);
                 if (deserializeJson(doc, json_content) == DeserializationError::Ok) {
                     unsigned long duration = doc["durationMs"] | 5000;
                     addContent(filename, theme, CONTENT_COUNTDOWN, path, duration, path, path, "");
+                    contentRegistry.back().postfx = parsePostFx(doc["postfx"]);  // V16.5.2
                 } else {
                     addContent(filename, theme, CONTENT_COUNTDOWN, path);
                 }
@@ -240,6 +300,27 @@ bool ContentManager::readCustomStorage() {
                 delete[] json_content;
                 addContent(filename, theme, CONTENT_COUNTDOWN, path);
             }
+        }
+        // V16.5.2-2026-01-12T15:00:00Z - procedural/<theme>/<Name>.json sets duration/postfx for a
+        // built-in procedural; the file name is the procedural's name (e.g. procedural/halloween/Fire.json)
+        else if (path.startsWith("procedural/") && path.endsWith(".json")) {
+            String filename = path.substring(path.lastIndexOf('/') + 1);
+            filename.replace(".json", "");
+            String theme = extractTheme(path);
+            
+            char* json_content = new char[content_len + 1];
+            if (contentFlashRead(json_content, flash_addr, content_len) == ESP_OK) {
+                json_content[content_len] = '\0';
+                DynamicJsonDocument doc(1024);
+                if (deserializeJson(doc, json_content) == DeserializationError::Ok) {
+                    unsigned long duration = doc["durationMs"] | 5000;
+                    addContent(filename, theme, CONTENT_PROCEDURAL, "", duration, "", "", "");
+                    contentRegistry.back().postfx = parsePostFx(doc["postfx"]);
+                }
+            }
+            delete[] json_content;
+        }
+        // V16.4.4-2026-01-11T20:00:00Z - themes/*.json are theme definitions, loaded by ThemeManager
         
         // Skip to next file (align to 512 bytes)
         flash_addr += content_len;
@@ -250,6 +331,30 @@ bool ContentManager::readCustomStorage() {
     return fileEntries.size() > 0;
 }
 
+// V16.4.4-2026-01-11T20:00:00Z - Look up any stored file by exact path
+const FileEntry* ContentManager::findFile(const String& path) const {
+    for (const auto& entry : fileEntries) {
+        if (entry.path == path) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool ContentManager::readFile(const FileEntry& entry, String& out) const {
+    PROFILE_SCOPE("ContentManager::readFile");  // V16.7.2-2026-01-14T15:00:00Z
+    char* buf = new char[entry.size + 1];
+    if (contentFlashRead(buf, entry.offset, entry.size) != ESP_OK) {
+        delete[] buf;
+        LOG_E("[ContentManager] Read failed: %s", entry.path.c_str());
+        return false;
+    }
+    buf[entry.size] = '\0';
+    out = buf;
+    delete[] buf;
+    return true;
+}
+
 String ContentManager::extractTheme(const String& path) {
     // V16.2.0-2026-01-10T18:10:00Z - Extract theme from paths like "scenes/christmas/tree.json", "scroll/christmas/text.json", "countdown/christmas/newyear.json"
     int slash1 = path.indexOf('/');
@@ -294,39 +399,33 @@ const std::vector<String>& ContentManager::getDiscoveredThemes() const {
 bool ContentManager::renderContent(uint16_t contentId) {
     const ContentItem* item = getContentById(contentId);
     if (!item) return false;
+    PROFILE_SCOPE("ContentManager::renderContent");  // V16.7.2-2026-01-14T15:00:00Z
     
-    Logger::instance().log("[ContentManager] Rendering: " + item->name);
+    LOG_I("[ContentManager] Rendering: %s", item->name.c_str());
+    traceLog.event(TRACE_PLAY, item->id, item->type);  // V16.7.1-2026-01-14T12:00:00Z
     
+    // V16.5.2-2026-01-12T15:00:00Z - Post-processing only while this item plays
+    disp->setPostFx(item->postfx);
+    Effects::restartHeat(-1);  // V16.7.4-2026-01-15T09:00:00Z - No stale field from an earlier item
+    bool ok = renderItem(item);
+    disp->setPostFx(PostFxSettings());
+    if (ok) lastRenderedId = contentId;  // V16.6.1-2026-01-13T15:00:00Z
+    return ok;
+}
+
+bool ContentManager::renderItem(const ContentItem* item) {
     // V16.2.1-2026-01-10T18:50:00Z - Actually render content to display
     switch (item->type) {
         case CONTENT_SCENE:
         case CONTENT_ANIMATION: {
-            // V16.2.6-2026-01-10T22:30:00Z - Read JSON from flash, parse pixels, render
-            // Find file in flash storage
-            for (const auto& entry : fileEntries) {
-                if (entry.path == item->path) {
-                    // Read JSON from flash
-                    char* jsonData = new char[entry.size + 1];
-                    if (esp_flash_read(NULL, jsonData, entry.offset, entry.size) == ESP_OK) {
-                        jsonData[entry.size] = '\0';
-                        
-                        // Parse and render (simplified - just clear for now)
-                        disp->clear();
-                        disp->show();
-                        
-                        // TODO: Parse JSON pixels and render
-                        Logger::instance().log("[ContentManager] Rendered from flash: " + item->name);
-                        
-                        delete[] jsonData;
-                        return true;
-                    }
-                    // V16.3.0-2026-01-10T22:54:00Z - Only delete on failure
-                    delete[] jsonData;
-                    return false;
-                }
+            // V16.5.6-2026-01-13T03:00:00Z - Pixels drawn at the scene's native size, resampled per matrix
+            if (!findFile(item->path)) {
+                LOG_W("[ContentManager] Flash entry not found: %s", item->path.c_str());
+                return false;
             }
-            Logger::instance().log("[ContentManager] Flash entry not found: " + item->path);
-            return false;
+            if (!renderScene(*item)) return false;
+            LOG_D("[ContentManager] Rendered from flash: %s", item->name.c_str());
+            return true;
         }
         
         case CONTENT_SCROLL: {
@@ -334,12 +433,12 @@ bool ContentManager::renderContent(uint16_t contentId) {
             for (const auto& entry : fileEntries) {
                 if (entry.path == item->path) {
                     char* jsonData = new char[entry.size + 1];
-                    if (esp_flash_read(NULL, jsonData, entry.offset, entry.size) == ESP_OK) {
+                    if (contentFlashRead(jsonData, entry.offset, entry.size) == ESP_OK) {
                         jsonData[entry.size] = '\0';
                         // TODO: Parse and display scroll
                         disp->clear();
                         disp->show();
-                        Logger::instance().log("[ContentManager] Scroll rendered: " + item->name);
+                        LOG_D("[ContentManager] Scroll rendered: %s", item->name.c_str());
                         delete[] jsonData;
                         return true;
                     }
@@ -355,12 +454,12 @@ bool ContentManager::renderContent(uint16_t contentId) {
             for (const auto& entry : fileEntries) {
                 if (entry.path == item->path) {
                     char* jsonData = new char[entry.size + 1];
-                    if (esp_flash_read(NULL, jsonData, entry.offset, entry.size) == ESP_OK) {
+                    if (contentFlashRead(jsonData, entry.offset, entry.size) == ESP_OK) {
                         jsonData[entry.size] = '\0';
                         // TODO: Parse and display countdown
                         disp->clear();
                         disp->show();
-                        Logger::instance().log("[ContentManager] Countdown rendered: " + item->name);
+                        LOG_D("[ContentManager] Countdown rendered: %s", item->name.c_str());
                         delete[] jsonData;
                         return true;
                     }
@@ -375,16 +474,10 @@ bool ContentManager::renderContent(uint16_t contentId) {
             // V16.2.1-2026-01-10T18:50:00Z - Run procedural animations
             unsigned long start = millis();
             while (millis() - start < 5000) {  // 5 seconds
-                if (item->name == "Chase") {
-                    Animations::chase(disp);
-                } else if (item->name == "Snowfall") {
-                    Animations::snowfall(disp);
-                } else if (item->name == "Snowfall Gentle") {
-                    Animations::snowfallGentle(disp);
-                } else if (item->name == "Snowfall Heavy") {
-                    Animations::snowfallHeavy(disp);
-                } else if (item->name == "Sparkling Stars") {
-                    Animations::sparklingStars(disp);
+                // V16.5.0-2026-01-12T09:00:00Z - Shared dispatcher (includes effect kernels)
+                if (!Animations::runProcedural(item->name, disp)) {
+                    LOG_W("[ContentManager] Unknown procedural: %s", item->name.c_str());
+                    return false;
                 }
                 delay(10);
             }
@@ -392,6 +485,12 @@ bool ContentManager::renderContent(uint16_t contentId) {
         }
             
         case CONTENT_TEST: {
+            // V16.5.0-2026-01-12T09:00:00Z - Kernel timing report (see Logger / web log)
+            if (item->name == "Effect Benchmark") {
+                Effects::benchmark(disp);
+                return true;
+            }
+            
             // Test patterns - basic color display
             disp->clear();
             for (int m = 0; m < 2; m++) {
@@ -411,6 +510,67 @@ bool ContentManager::renderContent(uint16_t contentId) {
     }
 }
 
+// V16.5.6-2026-01-13T03:00:00Z - Scene JSON: {"width": 20, "height": 25, "pixels": [row-major colors]}.
+// The canvas keeps the authored size; MatrixDisplay::present() scales it to each matrix.
+bool ContentManager::renderScene(const ContentItem& item) {
+    disp->clear();
+    for (int m = 0; m < MATRIX_COUNT && m < 3; m++) {
+        if (!drawScene(item, m, m)) return false;
+    }
+    disp->show();
+    return true;
+}
+
+// V16.5.7-2026-01-13T06:00:00Z - One scene slot (matrixNScene) onto one matrix, no show()
+bool ContentManager::drawScene(const ContentItem& item, int slot, int matrix) {
+    const String* scenes[3] = {&item.matrix0Scene, &item.matrix1Scene, &item.matrix2Scene};
+    if (slot < 0 || slot >= 3) return true;
+    if (slot == 1 && scenes[1]->length() == 0) scenes[1] = scenes[0];  // V16.7.4-2026-01-15T09:00:00Z - Default: mirror matrix0
+    PROFILE_SCOPE("ContentManager::drawScene");  // V16.7.2-2026-01-14T15:00:00Z
+    
+    const FileEntry* entry = scenes[slot]->length() ? findFile(*scenes[slot]) : nullptr;
+    String json;
+    if (!entry || !readFile(*entry, json)) return true;  // Nothing assigned: matrix stays black
+    
+    // V16.7.4-2026-01-15T09:00:00Z - Sized per value, not per byte: every pixel takes an array
+    // slot plus, for "#RRGGBB", a copy of its string. Values counted by commas (upper bound).
+    size_t values = 1;
+    for (const char* c = json.c_str(); *c; c++) {
+        if (*c == ',') values++;
+    }
+    DynamicJsonDocument doc(JSON_ARRAY_SIZE(values) + values * sizeof("#RRGGBB") + 1024);
+    DeserializationError error;
+    {
+        PROFILE_SCOPE("scene JSON parse");
+        error = deserializeJson(doc, json);
+    }
+    if (error != DeserializationError::Ok) {
+        LOG_W("[ContentManager] Bad scene JSON: %s (%s)", scenes[slot]->c_str(), error.c_str());
+        return true;
+    }
+    JsonArray pixels = doc["pixels"].as<JsonArray>();
+    int width = doc["width"] | MATRIX0_COLS;
+    int height = doc["height"] | MATRIX0_ROWS;
+    if (pixels.isNull() || width <= 0 || height <= 0) return true;
+    
+    CRGB* canvas = (CRGB*)malloc(width * height * sizeof(CRGB));
+    if (!canvas) {
+        LOG_E("[ContentManager] No memory for %dx%d scene", (int)width, (int)height);
+        return false;
+    }
+    PROFILE_SCOPE("scene pixels");
+    int i = 0;
+    for (JsonVariant v : pixels) {
+        if (i >= width * height) break;
+        canvas[i++] = parsePixel(v);
+    }
+    while (i < width * height) canvas[i++] = CRGB::Black;
+    
+    disp->present(matrix, canvas, width, height, item.scaling, item.orient[slot]);
+    free(canvas);
+    return true;
+}
+
 void ContentManager::addContent(const String& name, const String& theme, ContentType type, const String& path, unsigned long duration, const String& m0, const String& m1, const String& m2) {
     ContentItem item;
     item.id = nextContentId++;
@@ -430,16 +590,44 @@ void ContentManager::addContent(const String& name, const String& theme, Content
     addContent(name, theme, type, path, 5000, path, path, "");
 }
 
+// V16.5.2-2026-01-12T15:00:00Z - A procedural/*.json preset with the same name wins
+void ContentManager::addProcedural(const String& name, const String& theme) {
+    for (const auto& item : contentRegistry) {
+        if (item.type == CONTENT_PROCEDURAL && item.name == name) return;
+    }
+    addContent(name, theme, CONTENT_PROCEDURAL, "");
+}
+
 void ContentManager::registerProceduralAnimations() {
     Logger::instance().log("[ContentManager] Registering procedural animations...");
     
     // V16.2.0-2026-01-10T18:12:00Z - Register all procedural animations with correct themes
-    addContent("Chase", "christmas", CONTENT_PROCEDURAL, "");
-    addContent("Snowfall", "christmas", CONTENT_PROCEDURAL, "");
-    addContent("Snowfall Gentle", "christmas", CONTENT_PROCEDURAL, "");
-    addContent("Snowfall Heavy", "christmas", CONTENT_PROCEDURAL, "");
-    addContent("Sparkling Stars", "christmas", CONTENT_PROCEDURAL, "");
-    addContent("Color Wave", "osu", CONTENT_PROCEDURAL, "");
+    addProcedural("Chase", "christmas");
+    addProcedural("Snowfall", "christmas");
+    addProcedural("Snowfall Gentle", "christmas");
+    addProcedural("Snowfall Heavy", "christmas");
+    addProcedural("Sparkling Stars", "christmas");
+    addProcedural("Color Wave", "osu");
+    
+    // V16.5.0-2026-01-12T09:00:00Z - Effect kernels (Effects.h)
+    addProcedural("Plasma", "effects");
+    addProcedural("Radial Rainbow", "effects");
+    addProcedural("Noise Field", "effects");
+
+    // V16.5.1-2026-01-12T12:00:00Z - Heat-field effects (HeatField.h)
+    addProcedural("Fire", "halloween");
+    addProcedural("Embers", "halloween");
+    addProcedural("Smoke", "halloween");
+
+#if ENABLE_MEGATREE
+    // V16.5.5-2026-01-13T00:00:00Z - Mega Tree (MegaTree.h): native, then sampled 2D kernels
+    addProcedural("Tree Spiral", "megatree");
+    addProcedural("Tree Wipe", "megatree");
+    addProcedural("Tree Bands", "megatree");
+    addProcedural("Tree Snow", "christmas");
+    addProcedural("Tree Plasma", "megatree");
+    addProcedural("Tree Radial Rainbow", "megatree");
+#endif
 }
 
 void ContentManager::registerTestPatterns() {
@@ -448,10 +636,12 @@ void ContentManager::registerTestPatterns() {
     addContent("Color Test", "test", CONTENT_TEST, "");
     addContent("All Pixels", "test", CONTENT_TEST, "");
     addContent("Matrix ID", "test", CONTENT_TEST, "");
+    addContent("Effect Benchmark", "test", CONTENT_TEST, "");  // V16.5.0-2026-01-12T09:00:00Z
 }
 
 void ContentManager::enableScheduler(bool enable) {
     schedulerEnabled = enable;
+    settingsGeneration++;  // V16.6.2-2026-01-13T18:00:00Z
     Logger::instance().log("[ContentManager] Scheduler " + String(enable ? "ENABLED" : "DISABLED"));
 }
 
@@ -461,6 +651,7 @@ bool ContentManager::isSchedulerEnabled() const {
 
 void ContentManager::enableRandomMode(bool enable) {
     randomModeEnabled = enable;
+    settingsGeneration++;
     if (enable) {
         lastRandomChange = millis();
         Logger::instance().log("[ContentManager] Random mode ENABLED");
@@ -475,6 +666,7 @@ bool ContentManager::isRandomModeEnabled() const {
 
 void ContentManager::setRandomInterval(unsigned long intervalMs) {
     randomIntervalMs = intervalMs;
+    settingsGeneration++;
     Logger::instance().log("[ContentManager] Random interval: " + String(intervalMs) + "ms");
 }
 
@@ -484,6 +676,7 @@ unsigned long ContentManager::getRandomInterval() const {
 
 void ContentManager::setRandomThemeFilter(const String& theme) {
     randomThemeFilter = theme;
+    settingsGeneration++;
     if (theme.length() > 0) {
         Logger::instance().log("[ContentManager] Random filter: " + theme);
     } else {
@@ -525,5 +718,5 @@ void ContentManager::selectRandomContent() {
     int idx = random(pool.size());
     renderContent(pool[idx].id);
     
-    Logger::instance().log("[ContentManager] Random: " + pool[idx].name);
+    LOG_I("[ContentManager] Random: %s", pool[idx].name.c_str());
 }
\ No newline at end of file
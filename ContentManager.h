@@ -1,12 +1,20 @@
 /* ContentManager.h
    Content discovery and rendering system
-   VERSION: V16.2.5-2026-01-10T22:05:00Z - Fixed header to match .cpp implementation
+   VERSION: V16.6.2-2026-01-13T18:00:00Z - Content/settings generation counters (response cache)
+   V16.6.1-2026-01-13T15:00:00Z - getLastRenderedId() for the JSON status API
+   V16.5.7-2026-01-13T06:00:00Z - drawScene() for zone playback
+   V16.5.6-2026-01-13T03:00:00Z - Scenes drawn at native size and resampled per matrix
+   V16.5.2-2026-01-12T15:00:00Z - Per-item post-processing ("postfx" in content JSON)
+   V16.4.4-2026-01-11T20:00:00Z - Raw file access (findFile/readFile)
+   V16.2.5-2026-01-10T22:05:00Z - Fixed header to match .cpp implementation
 */
 
 #pragma once
 
 #include <Arduino.h>
 #include <vector>
+#include "PostFx.h"
+#include "Resampler.h"
 
 // V16.2.5-2026-01-10T22:05:00Z - Forward declarations
 class MatrixDisplay;
@@ -32,6 +40,9 @@ struct ContentItem {
     String matrix0Scene;          // V16.3.0-2026-01-10T22:40:00Z - Scene for matrix 0
     String matrix1Scene;          // V16.3.0-2026-01-10T22:40:00Z - Scene for matrix 1 (default: mirror matrix0)
     String matrix2Scene;          // V16.3.0-2026-01-10T22:40:00Z - Scene for matrix 2 (optional)
+    PostFxSettings postfx;        // V16.5.2-2026-01-12T15:00:00Z - Applied by show() while the item plays
+    ResampleMode scaling = RESAMPLE_NEAREST;  // V16.5.6-2026-01-13T03:00:00Z - "scaling": "nearest" | "bilinear"
+    uint8_t orient[3] = {};       // V16.5.6-2026-01-13T03:00:00Z - "matrixNOrientation" (ORIENT_* bits)
 };
 
 // V16.1.3-2026-01-09T05:00:00Z - File entry structure for flash storage
@@ -54,8 +65,22 @@ public:
     std::vector<ContentItem> getContentByTheme(const String& theme) const;
     const std::vector<String>& getDiscoveredThemes() const;
     
+    // V16.4.4-2026-01-11T20:00:00Z - Raw access to any stored file (e.g. themes/*.json)
+    const std::vector<FileEntry>& getFiles() const { return fileEntries; }
+    const FileEntry* findFile(const String& path) const;
+    bool readFile(const FileEntry& entry, String& out) const;
+    
     // Content rendering
     bool renderContent(uint16_t contentId);
+    uint16_t getLastRenderedId() const { return lastRenderedId; }  // V16.6.1 - 0 = none yet
+    
+    // V16.5.6-2026-01-13T03:00:00Z - Draw each matrix's scene ("width"/"height"/"pixels") scaled
+    // to that matrix, then show(). Scenes without pixel data leave their matrix black.
+    bool renderScene(const ContentItem& item);
+    
+    // V16.5.7-2026-01-13T06:00:00Z - Scene slot 0-2 (matrixNScene) into one matrix, no show()
+    // (the matrix is not cleared first). False only when out of memory.
+    bool drawScene(const ContentItem& item, int slot, int matrix);
     
     // Scheduler control
     void enableScheduler(bool enable);
@@ -68,6 +93,10 @@ public:
     unsigned long getRandomInterval() const;
     void setRandomThemeFilter(const String& theme);
     String getRandomThemeFilter() const;
+    
+    // V16.6.2-2026-01-13T18:00:00Z - Bumped when the registry is rebuilt / a setting above changes
+    uint32_t getContentGeneration() const { return contentGeneration; }
+    uint32_t getSettingsGeneration() const { return settingsGeneration; }
 
 private:
     MatrixDisplay* disp = nullptr;
@@ -77,6 +106,9 @@ private:
     std::vector<FileEntry> fileEntries;
     
     uint16_t nextContentId = 1;
+    uint16_t lastRenderedId = 0;  // V16.6.1-2026-01-13T15:00:00Z
+    uint32_t contentGeneration = 0;   // V16.6.2-2026-01-13T18:00:00Z
+    uint32_t settingsGeneration = 0;
     
     bool schedulerEnabled = false;
     bool randomModeEnabled = false;
@@ -87,9 +119,13 @@ private:
     // Content registration
     void addContent(const String& name, const String& theme, ContentType type, const String& path, unsigned long duration, const String& m0, const String& m1, const String& m2);
     void addContent(const String& name, const String& theme, ContentType type, const String& path);  // V16.3.0 - Backward compat
+    void addProcedural(const String& name, const String& theme);  // V16.5.2 - Skips names already set up by procedural/*.json
     void registerProceduralAnimations();
     void registerTestPatterns();
     
+    // V16.5.2-2026-01-12T15:00:00Z - Runs one item; renderContent() wraps it with the item's postfx
+    bool renderItem(const ContentItem* item);
+    
     // Storage reading
     bool readCustomStorage();
     String extractTheme(const String& path);
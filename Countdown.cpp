@@ -1,47 +1,63 @@
 /* Countdown.cpp
    Countdown display implementation
-   VERSION: V16.2.0-2026-01-10T18:05:00Z - Initial implementation with theme colors and flash behavior
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scope in drawFrame()
+   V16.7.0-2026-01-14T09:00:00Z - Level macros; load lines at debug
+   V16.6.6-2026-01-14T06:00:00Z - Content image reads counted (contentFlashRead)
+   V16.5.7-2026-01-13T06:00:00Z - Zone playback
+
+   V16.5.7-2026-01-13T06:00:00Z - Two-box layout for one-matrix zones; right box moved to fit 20 columns
+   V16.4.3-2026-01-11T17:00:00Z - Draws PALETTE_COLOR1/2/3 indices; a theme swap only re-expands
+   V16.4.2-2026-01-11T14:00:00Z - Replaced the NTPClient anchor with TimeService::nowEpoch()
+   V16.4.1-2026-01-11T11:00:00Z - Static parts drawn once; only changed digit cells redrawn
+                                  No NTP network calls on the render path
+   V16.4.0-2026-01-11T09:00:00Z - Digits and labels drawn with the shared 3x5 font
+   V16.2.0-2026-01-10T18:05:00Z - Initial implementation with theme colors and flash behavior
 */
 
 #include "Countdown.h"
 #include "MatrixDisplay.h"
 #include "ThemeManager.h"
 #include "Logger.h"
+#include "Profiler.h"
+#include "Font.h"
 #include <ArduinoJson.h>
-#include <NTPClient.h>
+#include "TimeService.h"
 #include "esp_partition.h"
 #include "esp_spi_flash.h"
+#include "Metrics.h"  // V16.6.6 - contentFlashRead()
 
 #define DATA_PARTITION_OFFSET 0x290000
 
-// V16.2.0-2026-01-10T18:05:00Z - 3x5 digit font
-const uint8_t Countdown::DIGIT_3X5[][5] = {
-  {0b111, 0b101, 0b101, 0b101, 0b111}, // 0
-  {0b010, 0b110, 0b010, 0b010, 0b111}, // 1
-  {0b111, 0b001, 0b111, 0b100, 0b111}, // 2
-  {0b111, 0b001, 0b111, 0b001, 0b111}, // 3
-  {0b101, 0b101, 0b111, 0b001, 0b001}, // 4
-  {0b111, 0b100, 0b111, 0b001, 0b111}, // 5
-  {0b111, 0b100, 0b111, 0b101, 0b111}, // 6
-  {0b111, 0b001, 0b001, 0b001, 0b001}, // 7
-  {0b111, 0b101, 0b111, 0b101, 0b111}, // 8
-  {0b111, 0b101, 0b111, 0b001, 0b111}  // 9
-};
+Countdown::Countdown(MatrixDisplay* display, ThemeManager* themeMgr, TimeService* time)
+    : disp(display), themes(themeMgr), timeSvc(time), targetTime(0), 
+      lastUpdate(0), flashState(false), lastFlash(0), staticDrawn(false),
+      zoned(false), zoneFirst(0), zoneCount(MATRIX_COUNT), boxCount(4),
+      indexed(false), paletteGeneration(0) {
+    for (int i = 0; i < 8; i++) shownDigits[i] = -1;
+    for (int i = 0; i < 4; i++) boxValue[i] = i;
+}
 
-Countdown::Countdown(MatrixDisplay* display, ThemeManager* themeMgr, NTPClient* ntp)
-    : disp(display), themes(themeMgr), ntpClient(ntp), targetTime(0), 
-      lastUpdate(0), flashState(false), lastFlash(0) {
+void Countdown::setZone(int firstMatrix, int matrixCount) {
+    zoned = true;
+    zoneFirst = constrain(firstMatrix, 0, MATRIX_COUNT - 1);
+    zoneCount = constrain(matrixCount, 1, MATRIX_COUNT - zoneFirst);
+}
+
+Countdown::~Countdown() {
+    if (indexed) {
+        disp->setIndexedMode(false);
+    }
 }
 
 bool Countdown::loadFromJSON(const String& jsonPath) {
     // V16.2.0-2026-01-10T18:30:00Z - Read JSON from flash storage with human-readable date support
-    Logger::instance().log("[Countdown] Loading: " + jsonPath);
+    LOG_D("[Countdown] Loading: %s", jsonPath.c_str());
     
     uint32_t flash_addr = DATA_PARTITION_OFFSET;
     uint32_t file_count = 0;
     
-    if (esp_flash_read(NULL, &file_count, flash_addr, 4) != ESP_OK) {
-        Logger::instance().log("[Countdown] Failed to read file count");
+    if (contentFlashRead(&file_count, flash_addr, 4) != ESP_OK) {
+        LOG_E("[Countdown] Failed to read file count");
         return false;
     }
     
@@ -50,22 +66,22 @@ bool Countdown::loadFromJSON(const String& jsonPath) {
     // Search for the file
     for (uint32_t i = 0; i < file_count; i++) {
         uint16_t path_len = 0;
-        if (esp_flash_read(NULL, &path_len, flash_addr, 2) != ESP_OK) break;
+        if (contentFlashRead(&path_len, flash_addr, 2) != ESP_OK) break;
         flash_addr += 2;
         
         char path_buf[256];
-        if (esp_flash_read(NULL, path_buf, flash_addr, path_len) != ESP_OK) break;
+        if (contentFlashRead(path_buf, flash_addr, path_len) != ESP_OK) break;
         flash_addr += path_len;
         path_buf[path_len] = '\0';
         
         uint32_t content_len = 0;
-        if (esp_flash_read(NULL, &content_len, flash_addr, 4) != ESP_OK) break;
+        if (contentFlashRead(&content_len, flash_addr, 4) != ESP_OK) break;
         flash_addr += 4;
         
         if (String(path_buf) == jsonPath) {
             // Found it! Read content
             char* content = new char[content_len + 1];
-            if (esp_flash_read(NULL, content, flash_addr, content_len) == ESP_OK) {
+            if (contentFlashRead(content, flash_addr, content_len) == ESP_OK) {
                 content[content_len] = '\0';
                 
                 // Parse JSON
@@ -74,7 +90,7 @@ bool Countdown::loadFromJSON(const String& jsonPath) {
                 delete[] content;
                 
                 if (error) {
-                    Logger::instance().log("[Countdown] JSON parse error: " + String(error.c_str()));
+                    LOG_W("[Countdown] JSON parse error: %s", error.c_str());
                     return false;
                 }
                 
@@ -83,22 +99,22 @@ bool Countdown::loadFromJSON(const String& jsonPath) {
                     // Check if it's a number (Unix timestamp) or string (human-readable)
                     if (doc["targetDate"].is<long>()) {
                         targetTime = doc["targetDate"].as<long>();
-                        Logger::instance().log("[Countdown] Target: " + String(targetTime));
+                        LOG_D("[Countdown] Target: %lu", (unsigned long)targetTime);
                     } else if (doc["targetDate"].is<const char*>()) {
                         // Parse "YYYY-MM-DD HH:MM:SS" format
                         String dateStr = doc["targetDate"].as<String>();
                         targetTime = parseHumanDate(dateStr);
                         if (targetTime > 0) {
-                            Logger::instance().log("[Countdown] Parsed target: " + String(targetTime));
+                            LOG_D("[Countdown] Parsed target: %lu", (unsigned long)targetTime);
                         } else {
-                            Logger::instance().log("[Countdown] Failed to parse date: " + dateStr);
+                            LOG_W("[Countdown] Failed to parse date: %s", dateStr.c_str());
                             return false;
                         }
                     }
                     return true;
                 }
                 
-                Logger::instance().log("[Countdown] No targetDate field");
+                LOG_W("[Countdown] No targetDate field");
                 return false;
             }
             delete[] content;
@@ -111,32 +127,93 @@ bool Countdown::loadFromJSON(const String& jsonPath) {
         flash_addr += padding;
     }
     
-    Logger::instance().log("[Countdown] File not found: " + jsonPath);
+    LOG_W("[Countdown] File not found: %s", jsonPath.c_str());
     return false;
 }
 
+// V16.4.1-2026-01-11T11:00:00Z - Box layout shared by the static and digit passes
+// Layout: Matrix 0 = Minutes & Seconds, Matrix 1 = Days & Hours
+static const int BOX_GAP = 1;
+static const int BOX_Y_START = 8;
+static const int BOX_X_LEFT = BOX_GAP;
+static const int BOX_X_RIGHT = COLS / 2 + BOX_GAP;  // V16.5.7 - Columns 11-19 (was 13-21, clipped at 20)
+static const int DIGIT_Y = 10;
+
+struct CountdownBox {
+    int matrix;
+    int x;
+    char label;
+};
+
+static const CountdownBox BOXES[4] = {
+    {0, BOX_X_LEFT,  'M'},
+    {0, BOX_X_RIGHT, 'S'},
+    {1, BOX_X_LEFT,  'D'},
+    {1, BOX_X_RIGHT, 'H'}
+};
+
+// V16.5.7-2026-01-13T06:00:00Z - Box positions for the current zone. Two or more matrices use
+// BOXES (offset to the zone); one matrix shows boxValue[0] left and boxValue[1] right.
+int Countdown::boxMatrix(int box) const {
+    return zoneFirst + (boxCount == 4 ? BOXES[box].matrix : 0);
+}
+
+int Countdown::boxX(int box) const {
+    return BOXES[boxCount == 4 ? box : box & 1].x;
+}
+
 void Countdown::begin() {
-    lastUpdate = millis();
+    lastUpdate = 0;  // V16.4.1-2026-01-11T11:00:00Z - Draw on the first update() call
     flashState = false;
     lastFlash = 0;
+    staticDrawn = false;
+    boxCount = zoneCount >= 2 ? 4 : 2;
+    for (int i = 0; i < 4; i++) boxValue[i] = i;
+    
+    // V16.4.3-2026-01-11T17:00:00Z - Indexed mode: the frame is expanded through the theme palette
+    // V16.5.7-2026-01-13T06:00:00Z - Not in a zone: indexed mode is display-wide and would
+    // overwrite the other zones
+    if (!zoned) {
+        disp->setIndexedMode(true);
+        indexed = disp->isIndexedMode();
+    }
+    paletteGeneration = themes->getPaletteGeneration();
+}
+
+// V16.4.2-2026-01-11T14:00:00Z - Cheap CPU-clock read; before the first NTP sync
+// this is time since boot, same as the old millis() fallback
+time_t Countdown::currentEpoch() {
+    return timeSvc ? timeSvc->nowEpoch() : (time_t)(millis() / 1000);
 }
 
 void Countdown::update() {
     unsigned long now = millis();
-    if (now - lastUpdate < 1000) return;  // V16.2.0-2026-01-10T18:05:00Z - Update every second
+    // V16.4.1-2026-01-11T11:00:00Z - Poll at 100ms so the 500ms flash is not aliased;
+    // only cells whose value changed are redrawn
+    if (lastUpdate != 0 && now - lastUpdate < 100) return;
     lastUpdate = now;
     
-    disp->clear();
-    
-    // V16.2.0-2026-01-10T18:05:00Z - Get current time from NTP
-    ntpClient->update();
-    time_t currentTime = ntpClient->getEpochTime();
+    if (drawFrame()) {
+        disp->show();
+    }
+}
+
+bool Countdown::drawFrame() {
+    PROFILE_SCOPE("Countdown::drawFrame");  // V16.7.2-2026-01-14T15:00:00Z
+    unsigned long now = millis();
+    bool changed = false;
     
-    // Fallback if NTP not synced
-    if (currentTime < 100000) {
-        currentTime = millis() / 1000;
+    // V16.4.3-2026-01-11T17:00:00Z - Theme swapped: same indices, new palette - just show()
+    // V16.5.7-2026-01-13T06:00:00Z - RGB (zone) drawing has the old colors baked in: redraw
+    if (themes->getPaletteGeneration() != paletteGeneration) {
+        paletteGeneration = themes->getPaletteGeneration();
+        if (!indexed) staticDrawn = false;
+        changed = true;
     }
     
+    // V16.4.2-2026-01-11T14:00:00Z - Disciplined CPU clock from TimeService
+    time_t currentTime = currentEpoch();
+    
     // Calculate time difference
     long diff = targetTime - currentTime;
     bool isZero = (diff <= 0);
@@ -152,174 +229,153 @@ void Countdown::update() {
     }
     
     // Calculate time components
-    long days = diff / 86400;
-    long hours = (diff % 86400) / 3600;
-    long minutes = (diff % 3600) / 60;
-    long seconds = diff % 60;
+    long values[4];
+    values[0] = (diff % 3600) / 60;   // Minutes
+    values[1] = diff % 60;            // Seconds
+    values[2] = diff / 86400;         // Days
+    values[3] = (diff % 86400) / 3600;  // Hours
     
-    // Clamp to 99 max
-    if (days > 99) days = 99;
-    if (hours > 99) hours = 99;
-    if (minutes > 99) minutes = 99;
-    if (seconds > 99) seconds = 99;
+    // V16.5.7-2026-01-13T06:00:00Z - One matrix: the two most significant units; the labels
+    // change with them, so a new pair redraws the static parts
+    if (boxCount == 2) {
+        int8_t first = values[2] > 0 ? 2 : (values[3] > 0 ? 3 : 0);
+        int8_t second = first == 2 ? 3 : (first == 3 ? 0 : 1);
+        if (boxValue[0] != first || boxValue[1] != second) {
+            boxValue[0] = first;
+            boxValue[1] = second;
+            staticDrawn = false;
+        }
+    }
+    
+    if (!staticDrawn) {
+        drawStatic();
+        changed = true;
+    }
     
-    // V16.2.0-2026-01-10T18:05:00Z - Draw countdown boxes with theme colors
-    // Layout: Matrix 0 = Minutes & Seconds, Matrix 1 = Days & Hours
-    const int BOX_WIDTH = 9;
-    const int BOX_HEIGHT = 10;
-    const int GAP = 1;
-    const int Y_START = 8;
-    const int X_LEFT = GAP;
-    const int X_RIGHT = 12 + GAP;  // Adjusted for 25-pixel width
+    // Digits are hidden during the "off" half of the flash
+    bool visible = !isZero || flashState;
     
-    drawBox(0, X_LEFT, Y_START, 'M', minutes, isZero);
-    drawBox(0, X_RIGHT, Y_START, 'S', seconds, isZero);
-    drawBox(1, X_LEFT, Y_START, 'D', days, isZero);
-    drawBox(1, X_RIGHT, Y_START, 'H', hours, isZero);
+    for (int box = 0; box < boxCount; box++) {
+        long value = values[boxValue[box]];
+        if (value > 99) value = 99;  // Clamp to 99 max
+        
+        int tens = visible ? (int)(value / 10) % 10 : -1;
+        int ones = visible ? (int)(value % 10) : -1;
+        changed |= updateDigitCell(box * 2, boxMatrix(box), boxX(box) + 1, tens);
+        changed |= updateDigitCell(box * 2 + 1, boxMatrix(box), boxX(box) + 5, ones);
+    }
     
-    disp->show();
+    return changed;
 }
 
-void Countdown::drawBox(int matrix, int x, int y, char label, long value, bool shouldFlash) {
-    // V16.2.0-2026-01-10T18:05:00Z - Theme colors: Header=color1, Box=color2, Numbers=color3
-    CRGB headerColor = themes->getColor1();
-    CRGB boxColor = themes->getColor2();
-    CRGB numberColor = themes->getColor3();
+void Countdown::drawStatic() {
+    // V16.4.1-2026-01-11T11:00:00Z - Borders and labels never change; draw them once
+    // V16.5.7-2026-01-13T06:00:00Z - Only the zone's matrices are cleared
+    for (int m = zoneFirst; m < zoneFirst + zoneCount; m++) {
+        disp->clearMatrix(m);
+    }
+    for (int box = 0; box < boxCount; box++) {
+        drawBox(boxMatrix(box), boxX(box), BOX_Y_START, BOXES[boxValue[box]].label);
+    }
+    for (int cell = 0; cell < 8; cell++) {
+        shownDigits[cell] = -1;  // Cells are blank after clear()
+    }
+    staticDrawn = true;
+}
+
+bool Countdown::updateDigitCell(int cell, int matrix, int x, int digit) {
+    if (shownDigits[cell] == digit) return false;
     
+    // Blank the 3x5 cell, then draw the new digit (-1 leaves it blank)
+    for (int row = 0; row < 5; row++) {
+        for (int col = 0; col < 3; col++) {
+            plot(matrix, x + col, DIGIT_Y + row, PALETTE_BLACK);
+        }
+    }
+    if (digit >= 0) {
+        // V16.2.0-2026-01-10T18:05:00Z - Numbers=color3
+        drawDigit(matrix, x, DIGIT_Y, digit, PALETTE_COLOR3);
+    }
+    shownDigits[cell] = digit;
+    return true;
+}
+
+void Countdown::drawBox(int matrix, int x, int y, char label) {
+    // V16.2.0-2026-01-10T18:05:00Z - Theme colors: Header=color1, Box=color2, Numbers=color3
     // Draw box border
-    drawRectBorder(matrix, x, y, x + 8, y + 9, boxColor);
+    drawRectBorder(matrix, x, y, x + 8, y + 9, PALETTE_COLOR2);
     
     // Draw label above box
     int label_x = x + 4;
     int label_y = y - 4;
-    drawLabel(matrix, label_x, label_y, label, headerColor);
-    
-    // Draw digits (only if not flashing or flash is ON)
-    if (!shouldFlash || flashState) {
-        int digit1 = (value / 10) % 10;
-        int digit2 = value % 10;
-        
-        drawDigit(matrix, x + 1, 10, digit1, numberColor);
-        drawDigit(matrix, x + 5, 10, digit2, numberColor);
+    drawLabel(matrix, label_x, label_y, label, PALETTE_COLOR1);
+}
+
+// V16.4.3-2026-01-11T17:00:00Z - All drawing goes through a palette index
+void Countdown::plot(int matrix, int x, int y, uint8_t colorIndex) {
+    if (indexed) {
+        disp->setPixelIndex(matrix, x, y, colorIndex);
+    } else {
+        disp->setPixel(matrix, x, y, themes->getPaletteColor(colorIndex));
     }
 }
 
-void Countdown::drawDigit(int matrix, int x, int y, int digit, CRGB color) {
+void Countdown::drawFontGlyph(int matrix, int x, int y, uint32_t codepoint, uint8_t colorIndex) {
+    const Glyph* glyph = Fonts::findGlyph(FONT_3X5, codepoint);
+    if (indexed) {
+        Fonts::drawGlyphIndex(disp, matrix, x, y, FONT_3X5, glyph, colorIndex);
+    } else {
+        Fonts::drawGlyph(disp, matrix, x, y, FONT_3X5, glyph, themes->getPaletteColor(colorIndex));
+    }
+}
+
+void Countdown::drawDigit(int matrix, int x, int y, int digit, uint8_t colorIndex) {
     if (digit < 0 || digit > 9) return;
     
-    for (int row = 0; row < 5; row++) {
-        uint8_t rowPattern = DIGIT_3X5[digit][row];
-        for (int col = 0; col < 3; col++) {
-            if (rowPattern & (0b100 >> col)) {
-                disp->setPixel(matrix, x + col, y + row, color);
-            }
-        }
-    }
+    // V16.4.0-2026-01-11T09:00:00Z - Shared font blitter (3x5 digits are fixed width)
+    drawFontGlyph(matrix, x, y, '0' + digit, colorIndex);
 }
 
-void Countdown::drawRectBorder(int matrix, int x1, int y1, int x2, int y2, CRGB color) {
+void Countdown::drawRectBorder(int matrix, int x1, int y1, int x2, int y2, uint8_t colorIndex) {
     // Draw horizontal lines
     for (int x = x1; x <= x2; x++) {
-        disp->setPixel(matrix, x, y1, color);
-        disp->setPixel(matrix, x, y2, color);
+        plot(matrix, x, y1, colorIndex);
+        plot(matrix, x, y2, colorIndex);
     }
     // Draw vertical lines
     for (int y = y1 + 1; y <= y2 - 1; y++) {
-        disp->setPixel(matrix, x1, y, color);
-        disp->setPixel(matrix, x2, y, color);
+        plot(matrix, x1, y, colorIndex);
+        plot(matrix, x2, y, colorIndex);
     }
 }
 
-void Countdown::drawLabel(int matrix, int x, int y, char label, CRGB color) {
-    // V16.2.0-2026-01-10T18:05:00Z - Draw 3-pixel wide labels (D, H, M, S)
-    switch(label) {
-        case 'D':
-            disp->setPixel(matrix, x-1, y, color);
-            disp->setPixel(matrix, x-1, y+1, color);
-            disp->setPixel(matrix, x-1, y+2, color);
-            disp->setPixel(matrix, x-1, y+3, color);
-            disp->setPixel(matrix, x-1, y+4, color);
-            disp->setPixel(matrix, x, y, color);
-            disp->setPixel(matrix, x+1, y+1, color);
-            disp->setPixel(matrix, x+1, y+2, color);
-            disp->setPixel(matrix, x+1, y+3, color);
-            disp->setPixel(matrix, x, y+4, color);
-            break;
-            
-        case 'H':
-            disp->setPixel(matrix, x-1, y, color);
-            disp->setPixel(matrix, x-1, y+1, color);
-            disp->setPixel(matrix, x-1, y+2, color);
-            disp->setPixel(matrix, x-1, y+3, color);
-            disp->setPixel(matrix, x-1, y+4, color);
-            disp->setPixel(matrix, x, y+2, color);
-            disp->setPixel(matrix, x+1, y, color);
-            disp->setPixel(matrix, x+1, y+1, color);
-            disp->setPixel(matrix, x+1, y+2, color);
-            disp->setPixel(matrix, x+1, y+3, color);
-            disp->setPixel(matrix, x+1, y+4, color);
-            break;
-            
-        case 'M':
-            disp->setPixel(matrix, x-1, y, color);
-            disp->setPixel(matrix, x-1, y+1, color);
-            disp->setPixel(matrix, x-1, y+2, color);
-            disp->setPixel(matrix, x-1, y+3, color);
-            disp->setPixel(matrix, x-1, y+4, color);
-            disp->setPixel(matrix, x, y+1, color);
-            disp->setPixel(matrix, x+1, y, color);
-            disp->setPixel(matrix, x+1, y+1, color);
-            disp->setPixel(matrix, x+1, y+2, color);
-            disp->setPixel(matrix, x+1, y+3, color);
-            disp->setPixel(matrix, x+1, y+4, color);
-            break;
-            
-        case 'S':
-            disp->setPixel(matrix, x-1, y, color);
-            disp->setPixel(matrix, x, y, color);
-            disp->setPixel(matrix, x+1, y, color);
-            disp->setPixel(matrix, x-1, y+1, color);
-            disp->setPixel(matrix, x-1, y+2, color);
-            disp->setPixel(matrix, x, y+2, color);
-            disp->setPixel(matrix, x+1, y+2, color);
-            disp->setPixel(matrix, x+1, y+3, color);
-            disp->setPixel(matrix, x-1, y+4, color);
-            disp->setPixel(matrix, x, y+4, color);
-            disp->setPixel(matrix, x+1, y+4, color);
-            break;
-    }
+void Countdown::drawLabel(int matrix, int x, int y, char label, uint8_t colorIndex) {
+    // V16.4.0-2026-01-11T09:00:00Z - 3-pixel wide labels (D, H, M, S) centered on x
+    drawFontGlyph(matrix, x - 1, y, label, colorIndex);
 }
 
 void Countdown::setTargetDate(time_t targetEpoch) {
     targetTime = targetEpoch;
 }
 
-// V16.2.0-2026-01-10T18:30:00Z - Parse "YYYY-MM-DD HH:MM:SS" to Unix timestamp (UTC)
+// V16.2.0-2026-01-10T18:30:00Z - Parse "YYYY-MM-DD HH:MM:SS" to Unix timestamp
 time_t Countdown::parseHumanDate(const String& dateStr) {
-    struct tm timeinfo;
-    memset(&timeinfo, 0, sizeof(timeinfo));
-    
-    // Expected format: "2025-12-25 05:00:00"
-    int year, month, day, hour, minute, second;
-    
-    if (sscanf(dateStr.c_str(), "%d-%d-%d %d:%d:%d", 
-               &year, &month, &day, &hour, &minute, &second) == 6) {
-        
-        timeinfo.tm_year = year - 1900;  // Years since 1900
-        timeinfo.tm_mon = month - 1;     // Months since January (0-11)
-        timeinfo.tm_mday = day;
-        timeinfo.tm_hour = hour;
-        timeinfo.tm_min = minute;
-        timeinfo.tm_sec = second;
-        
-        // Convert to Unix timestamp (assuming UTC)
-        time_t timestamp = mktime(&timeinfo);
-        
-        // mktime uses local time, but we want UTC, so adjust
-        // This is a simplified approach - for production use a proper UTC conversion
-        return timestamp;
+    // V16.4.2-2026-01-11T14:00:00Z - "2025-12-25 05:00:00" is local wall-clock time in
+    // TIMEZONE_POSIX (DST resolved per date); a trailing Z or +hh:mm pins the offset
+    time_t timestamp = 0;
+    if (timeSvc) {
+        timestamp = timeSvc->parseLocalDateTime(dateStr);
+    } else {
+        TimeMath::DateTime dt;
+        bool hasOffset;
+        int32_t offsetSec;
+        if (TimeMath::parseDateTime(dateStr.c_str(), dt, hasOffset, offsetSec)) {
+            timestamp = (time_t)(TimeMath::toEpoch(dt) - offsetSec);
+        }
     }
     
-    Logger::instance().log("[Countdown] Invalid date format, expected: YYYY-MM-DD HH:MM:SS");
-    return 0;
+    if (timestamp == 0) {
+        LOG_W("[Countdown] Invalid date format, expected: YYYY-MM-DD HH:MM:SS");
+    }
+    return timestamp;
 }
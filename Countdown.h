@@ -1,10 +1,16 @@
 /* Countdown.h
    Countdown display system with JSON configuration
-   VERSION: V16.2.0-2026-01-10T18:05:00Z - Initial implementation
+   VERSION: V16.5.7-2026-01-13T06:00:00Z - Plays inside a zone (one or two matrices)
    
    Supports JSON-driven countdown timers with theme colors
    Colors: Header=theme1, Box=theme2, Numbers=theme3
    Flashes "00" when target date reached/passed
+   V16.5.7-2026-01-13T06:00:00Z - setZone(): a one-matrix zone shows the two most significant
+                                  units (D:H, H:M or M:S); zones always draw RGB
+   V16.4.3-2026-01-11T17:00:00Z - Draws palette indices; theme changes re-tint without redraw
+   V16.4.3-2026-01-11T17:00:00Z - Runs in the display's palette-indexed mode while alive
+   V16.4.2-2026-01-11T14:00:00Z - "targetDate" strings are local time (DST-aware) unless they carry Z/+hh:mm
+   V16.4.1-2026-01-11T11:00:00Z - Borders/labels drawn once, digits redrawn only on change
 */
 
 #pragma once
@@ -15,11 +21,12 @@
 
 class MatrixDisplay;
 class ThemeManager;
-class NTPClient;
+class TimeService;
 
 class Countdown {
 public:
-    Countdown(MatrixDisplay* display, ThemeManager* themeMgr, NTPClient* ntp);
+    Countdown(MatrixDisplay* display, ThemeManager* themeMgr, TimeService* time);
+    ~Countdown();  // V16.4.3-2026-01-11T17:00:00Z - Restores RGB mode
     
     // Load countdown configuration from JSON
     bool loadFromJSON(const String& jsonPath);
@@ -28,26 +35,55 @@ public:
     void begin();
     void update();
     
+    // V16.5.7-2026-01-13T06:00:00Z - Redraw what changed into the zone; no timing, no show().
+    // Returns true if any pixel changed.
+    bool drawFrame();
+    
     // Manual configuration
     void setTargetDate(time_t targetEpoch);
     
+    // V16.5.7-2026-01-13T06:00:00Z - Matrices to draw on (default: all, palette-indexed).
+    // Call before begin().
+    void setZone(int firstMatrix, int matrixCount);
+    
 private:
     MatrixDisplay* disp;
     ThemeManager* themes;
-    NTPClient* ntpClient;
+    TimeService* timeSvc;
     
     time_t targetTime;
     unsigned long lastUpdate;
     bool flashState;
     unsigned long lastFlash;
     
-    // V16.2.0-2026-01-10T18:05:00Z - 3x5 digit font
-    static const uint8_t DIGIT_3X5[][5];
+    // V16.4.2-2026-01-11T14:00:00Z - CPU-clock epoch from TimeService (no network)
+    time_t currentEpoch();
+    
+    // V16.4.1-2026-01-11T11:00:00Z - Incremental redraw state (-1 = blank cell)
+    bool staticDrawn;
+    int8_t shownDigits[8];
+    
+    // V16.5.7-2026-01-13T06:00:00Z - Zone and the boxes laid out in it
+    bool zoned;
+    int zoneFirst;
+    int zoneCount;
+    int boxCount;
+    int8_t boxValue[4];     // Unit shown by each box: 0 = M, 1 = S, 2 = D, 3 = H
+    int boxMatrix(int box) const;
+    int boxX(int box) const;
+    
+    // V16.4.3-2026-01-11T17:00:00Z - Palette-indexed drawing (falls back to RGB if unavailable)
+    bool indexed;
+    uint32_t paletteGeneration;
+    void plot(int matrix, int x, int y, uint8_t colorIndex);
+    void drawFontGlyph(int matrix, int x, int y, uint32_t codepoint, uint8_t colorIndex);
+    void drawStatic();
+    bool updateDigitCell(int cell, int matrix, int x, int digit);
     
-    void drawDigit(int matrix, int x, int y, int digit, CRGB color);
-    void drawLabel(int matrix, int x, int y, char label, CRGB color);
-    void drawRectBorder(int matrix, int x1, int y1, int x2, int y2, CRGB color);
-    void drawBox(int matrix, int x, int y, char label, long value, bool shouldFlash);
+    void drawDigit(int matrix, int x, int y, int digit, uint8_t colorIndex);
+    void drawLabel(int matrix, int x, int y, char label, uint8_t colorIndex);
+    void drawRectBorder(int matrix, int x1, int y1, int x2, int y2, uint8_t colorIndex);
+    void drawBox(int matrix, int x, int y, char label);
     
     // V16.2.0-2026-01-10T18:30:00Z - Parse human-readable date to Unix timestamp
     time_t parseHumanDate(const String& dateStr);
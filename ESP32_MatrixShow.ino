@@ -1,12 +1,21 @@
 /* ESP32_MatrixShow.ino
    Main program entry point
-   VERSION: V16.1.2-2026-01-08T15:00:00Z - Content auto-discovery architecture
+   VERSION: V16.7.3-2026-01-14T18:00:00Z - E1.31/DDP realtime input owns the display while it streams
+   V16.7.2-2026-01-14T15:00:00Z - Profiler capture timing
+   V16.7.1-2026-01-14T12:00:00Z - Crash-surviving trace (TraceLog) started in setup, flushed each pass
+   V16.7.0-2026-01-14T09:00:00Z - Serial log drain task started first
+   V16.6.6-2026-01-14T06:00:00Z - Loop pass timing for /metrics
+   V16.6.4-2026-01-14T00:00:00Z - Server-sent events polled each pass
+   V16.6.3-2026-01-13T21:00:00Z - Live preview frames sent after each pass
+   V16.6.0-2026-01-13T12:00:00Z - Async web server; loop() answers queued requests
+   V16.5.7-2026-01-13T06:00:00Z - Per-zone playback (ZoneManager)
+   V16.5.5-2026-01-13T00:00:00Z - Mega Tree output when ENABLE_MEGATREE
+   V16.4.2-2026-01-11T14:00:00Z - Background time service replaces NTPClient
+   V16.1.2-2026-01-08T15:00:00Z - Content auto-discovery architecture
 */
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <NTPClient.h>
-#include <WiFiUdp.h>
 #include <FastLED.h>
 #include <Preferences.h>     // ← ADD THIS!
 #include "Config.h"
@@ -18,11 +27,18 @@
 #include "WebController.h"
 #include "Scroll.h"          // ← ADD THIS
 #include "Countdown.h"       // ← ADD THIS
+#include "TimeService.h"     // V16.4.2-2026-01-11T14:00:00Z - Replaces NTPClient
+#include "MegaTree.h"        // V16.5.5-2026-01-13T00:00:00Z
+#include "ZoneManager.h"     // V16.5.7-2026-01-13T06:00:00Z
+#include "LivePreview.h"     // V16.6.3-2026-01-13T21:00:00Z
+#include "EventStream.h"     // V16.6.4-2026-01-14T00:00:00Z
+#include "Metrics.h"         // V16.6.6-2026-01-14T06:00:00Z
+#include "TraceLog.h"        // V16.7.1-2026-01-14T12:00:00Z
+#include "Profiler.h"        // V16.7.2-2026-01-14T15:00:00Z
+#include "RealtimeReceiver.h" // V16.7.3-2026-01-14T18:00:00Z
 
 // Global objects
 Preferences preferences;
-WiFiUDP ntpUDP;
-NTPClient timeClient(ntpUDP, "pool.ntp.org", -18000, 60000);
 
 MatrixDisplay display;
 ThemeManager themeManager;  // V16.2.5-2026-01-10T22:20:00Z - Must be before ContentManager
@@ -32,6 +48,8 @@ WebController web;
 void setup() {
     Serial.begin(115200);
     delay(1000);
+    Logger::instance().begin();  // V16.7.0-2026-01-14T09:00:00Z
+    traceLog.begin();  // V16.7.1-2026-01-14T12:00:00Z - First: writes out what a reset left in RTC memory
 
     Logger::instance().log("=================================");
     Logger::instance().log("ESP32 Matrix Show V16.1.2");
@@ -41,10 +59,17 @@ void setup() {
     // Initialize display hardware
     display.begin();
     Logger::instance().log("[SETUP] Display initialized");
+#if ENABLE_MEGATREE
+    megaTree.begin(&display);  // V16.5.5-2026-01-13T00:00:00Z - Polar tables built once here
+#endif
 
     // V16.1.2 - Discover all content from filesystem
     content.begin(&display);
     Logger::instance().log("[SETUP] Content discovery complete");
+    zones.begin(&display, &content);  // V16.5.7-2026-01-13T06:00:00Z - Idle until /api/zone
+
+    // V16.4.2-2026-01-11T14:00:00Z - Time service syncs in the background once WiFi is up
+    timeService.begin(NTP_SERVER, TIMEZONE_POSIX);
 
     // Initialize WiFi
     WiFi.mode(WIFI_STA);
@@ -61,7 +86,6 @@ void setup() {
 
     if (WiFi.status() == WL_CONNECTED) {
         Logger::instance().log("[SETUP] WiFi connected: " + WiFi.localIP().toString());
-        timeClient.begin();
     } else {
         Logger::instance().log("[SETUP] WiFi connection FAILED - continuing offline");
     }
@@ -74,24 +98,47 @@ void setup() {
     web.begin(&content, &themeManager, &display);
     Logger::instance().log("[SETUP] Web interface started");
 
+    // V16.7.3-2026-01-14T18:00:00Z - xLights E1.31/DDP; listens once WiFi is up
+    realtime.begin(&display, &content);
+
     Logger::instance().log("[SETUP] System ready!");
     Logger::instance().log("=================================");
 }
 
 void loop() {
     // V16.2.5-2026-01-10T22:06:00Z - Removed watchdog reset (not needed)
+    metrics.beginPass();  // V16.6.6-2026-01-14T06:00:00Z
     
-    // Update NTP time
-    if (WiFi.status() == WL_CONNECTED) {
-        timeClient.update();
-    }
+    // V16.4.2-2026-01-11T14:00:00Z - NTP runs in its own task; just forward its log messages
+    timeService.update();
 
     // Handle web requests
+    // V16.6.0-2026-01-13T12:00:00Z - Connections are served by the async TCP task; handlers
+    // that touch display/content state run here
     web.handle();
     
     // Update theme/content system
     themeManager.update();
-    content.update();
+    // V16.7.3-2026-01-14T18:00:00Z - While xLights streams, its frames are all that is shown
+    realtime.update();
+    if (!realtime.isActive()) {
+        // V16.5.7-2026-01-13T06:00:00Z - Zones composite and show once per frame;
+        // random mode pauses while any zone is playing
+        zones.update();
+        if (!zones.isActive()) {
+            content.update();
+        }
+    }
+
+    // V16.6.3-2026-01-13T21:00:00Z - Returns at once unless a preview client is connected
+    livePreview.update();
+    // V16.6.4-2026-01-14T00:00:00Z - Pushes state changes and log lines to /api/events
+    eventStream.update();
+    // V16.7.1-2026-01-14T12:00:00Z - Filled trace pages to flash (a sector erase now and then)
+    traceLog.update();
+    profiler.update();  // V16.7.2-2026-01-14T15:00:00Z - Ends a /api/profile capture on time
+
+    metrics.endPass();  // Before the delay: it is not work
 
     delay(10);
 }
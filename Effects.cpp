@@ -0,0 +1,337 @@
+/* Effects.cpp
+   Effect kernel tables, dispatch and benchmark
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Heat field restarted when a pixel kernel or other content plays
+   V16.5.7-2026-01-13T06:00:00Z - drawMatrix(): one effect frame into one matrix (zones)
+   V16.5.5-2026-01-13T00:00:00Z - renderKernel() for off-matrix grids
+   V16.5.1-2026-01-12T12:00:00Z - Fire/Embers/Smoke heat-field effects
+   V16.5.0-2026-01-12T09:00:00Z - Initial implementation
+*/
+
+#include "Effects.h"
+#include "HeatField.h"
+#include "MatrixDisplay.h"
+#include "ThemeManager.h"
+#include "Logger.h"
+#include "Config.h"
+#include <math.h>
+
+extern ThemeManager themeManager;
+
+namespace Effects {
+
+namespace {
+
+Geometry matrixGeometry[MATRIX_COUNT];
+bool matrixGeometryBuilt[MATRIX_COUNT] = {};
+CRGB rainbow[256];
+bool rainbowBuilt = false;
+
+// Kernels hold per-frame term arrays; keep them out of the loop task's stack
+ColorWave colorWave;
+Plasma plasma;
+RadialRainbow radialRainbow;
+NoiseField noiseField;
+HeatMap heatMap;
+
+// V16.5.1-2026-01-12T12:00:00Z - Heat effects: one field per matrix, restarted on effect change.
+// Palettes are compiled-in gradients unless a theme file with the same name
+// (themes/fire.json, ...) provides one.
+const uint32_t HEAT_SEED = 0x5EED;
+
+struct HeatEffect {
+    const char* name;
+    const HeatParams* params;
+    const char* paletteName;
+    const PaletteStop* stops;
+    int stopCount;
+    CRGB* palette;   // Expanded on first use
+};
+
+const PaletteStop FIRE_STOPS[] = {
+    {1, CRGB(0x10, 0x00, 0x00)}, {80, CRGB(0xA0, 0x00, 0x00)}, {150, CRGB(0xFF, 0x50, 0x00)},
+    {210, CRGB(0xFF, 0xB0, 0x10)}, {255, CRGB(0xFF, 0xFF, 0xA0)}
+};
+const PaletteStop EMBERS_STOPS[] = {
+    {1, CRGB(0x08, 0x00, 0x00)}, {120, CRGB(0x80, 0x08, 0x00)}, {200, CRGB(0xFF, 0x40, 0x00)},
+    {255, CRGB(0xFF, 0xA0, 0x20)}
+};
+const PaletteStop SMOKE_STOPS[] = {
+    {1, CRGB(0x04, 0x04, 0x06)}, {100, CRGB(0x30, 0x28, 0x38)}, {200, CRGB(0x70, 0x68, 0x78)},
+    {255, CRGB(0xB0, 0xB0, 0xB8)}
+};
+
+HeatEffect heatEffects[] = {
+    {"Fire",   &HeatPresets::FIRE,   "fire",   FIRE_STOPS,   5, nullptr},
+    {"Embers", &HeatPresets::EMBERS, "embers", EMBERS_STOPS, 4, nullptr},
+    {"Smoke",  &HeatPresets::SMOKE,  "smoke",  SMOKE_STOPS,  4, nullptr},
+};
+const int HEAT_EFFECT_COUNT = sizeof(heatEffects) / sizeof(heatEffects[0]);
+
+HeatField heatFields[MATRIX_COUNT];
+int activeHeat[MATRIX_COUNT] = {-1, -1};  // V16.5.7 - Per matrix: zones can run different heat effects
+
+const CRGB* heatPalette(HeatEffect& effect) {
+    for (const auto& def : themeManager.getThemes()) {
+        if (def.name.equalsIgnoreCase(effect.paletteName)) return def.palette;
+    }
+    if (!effect.palette) {
+        effect.palette = new CRGB[PALETTE_SIZE];
+        ThemeManager::expandGradient(effect.stops, effect.stopCount, effect.palette);
+    }
+    return effect.palette;
+}
+
+void runHeat(MatrixDisplay* disp, int matrix, int which) {
+    HeatEffect& effect = heatEffects[which];
+    const Geometry& g = geometry(disp, matrix);
+    if (!g.index) return;
+
+    if (which != activeHeat[matrix]) {
+        // Different seed per matrix so mirrored panels don't flicker in lockstep
+        if (!heatFields[matrix].begin(g.cols, g.rows, HEAT_SEED + matrix)) {
+            Logger::instance().log("[Effects] No heat buffer for matrix " + String(matrix));
+        }
+        activeHeat[matrix] = which;
+    }
+    if (!heatFields[matrix].data()) return;
+
+    heatMap.palette = heatPalette(effect);
+    heatFields[matrix].step(*effect.params);
+    heatMap.heat = heatFields[matrix].data();
+    render(disp->getLeds(), g, heatMap, 0);
+}
+
+// Kernel index for a name: 0-3 pixel kernels, 4+ heat effects, -1 unknown
+int effectIndex(const String& name) {
+    if (name == "Color Wave") return 0;
+    if (name == "Plasma") return 1;
+    if (name == "Radial Rainbow") return 2;
+    if (name == "Noise Field") return 3;
+    for (int i = 0; i < HEAT_EFFECT_COUNT; i++) {
+        if (name == heatEffects[i].name) return 4 + i;
+    }
+    return -1;
+}
+
+template<typename Kernel>
+void renderMatrix(MatrixDisplay* disp, int matrix, Kernel& kernel, uint32_t t) {
+    const Geometry& g = geometry(disp, matrix);
+    if (g.index) render(disp->getLeds(), g, kernel, t);
+}
+
+template<typename Kernel>
+void renderAll(MatrixDisplay* disp, Kernel& kernel, uint32_t t) {
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        renderMatrix(disp, m, kernel, t);
+    }
+}
+
+void bindTables() {
+    const CRGB* palette = themeManager.getPalette();
+    colorWave.palette = palette;
+    noiseField.palette = palette;
+    plasma.rainbow = rainbowTable();
+    radialRainbow.rainbow = rainbowTable();
+}
+
+} // namespace
+
+void buildGeometry(Geometry& g, int cols, int rows, uint16_t* index, uint8_t* radius, uint8_t* angle) {
+    // One-time float math; kernels only ever read the 8-bit results
+    float cx = (cols - 1) * 0.5f;
+    float cy = (rows - 1) * 0.5f;
+    float maxR = sqrtf(cx * cx + cy * cy);
+
+    for (int y = 0; y < rows; y++) {
+        for (int x = 0; x < cols; x++) {
+            int i = y * cols + x;
+            float dx = x - cx;
+            float dy = y - cy;
+            radius[i] = (uint8_t)min(255.0f, sqrtf(dx * dx + dy * dy) * 255.0f / maxR);
+            float a = atan2f(dy, dx);  // -pi..pi
+            angle[i] = (uint8_t)((int)((a + (float)M_PI) * 128.0f / (float)M_PI) & 0xFF);
+            if (index) index[i] = (uint16_t)i;
+        }
+    }
+
+    g.cols = cols;
+    g.rows = rows;
+    g.index = index;
+    g.radius = radius;
+    g.angle = angle;
+}
+
+const Geometry& geometry(MatrixDisplay* disp, int matrix) {
+    if (!matrixGeometryBuilt[matrix]) {
+        Geometry& g = matrixGeometry[matrix];
+        int cols = disp->getMatrixCols(matrix);
+        int rows = disp->getMatrixRows(matrix);
+        uint8_t* radius = (uint8_t*)malloc(cols * rows);
+        uint8_t* angle = (uint8_t*)malloc(cols * rows);
+        if (radius && angle && cols <= EFFECT_MAX_DIM && rows <= EFFECT_MAX_DIM) {
+            buildGeometry(g, cols, rows, nullptr, radius, angle);
+            g.index = disp->getIndexTable(matrix);
+        } else {
+            free(radius);
+            free(angle);
+            g.index = nullptr;  // render() is skipped for this matrix
+            Logger::instance().log("[Effects] No geometry for matrix " + String(matrix));
+        }
+        matrixGeometryBuilt[matrix] = true;
+    }
+    return matrixGeometry[matrix];
+}
+
+const CRGB* rainbowTable() {
+    if (!rainbowBuilt) {
+        for (int i = 0; i < 256; i++) {
+            hsv2rgb_rainbow(CHSV(i, 255, 255), rainbow[i]);
+        }
+        rainbowBuilt = true;
+    }
+    return rainbow;
+}
+
+bool renderKernel(const String& name, CRGB* leds, const Geometry& g, uint32_t t) {
+    bindTables();
+    if (name == "Color Wave") render(leds, g, colorWave, t);
+    else if (name == "Plasma") render(leds, g, plasma, t);
+    else if (name == "Radial Rainbow") render(leds, g, radialRainbow, t);
+    else if (name == "Noise Field") render(leds, g, noiseField, t);
+    else return false;
+    return true;
+}
+
+bool isEffect(const String& name) {
+    return effectIndex(name) >= 0;
+}
+
+void restartHeat(int matrix) {
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        if (matrix < 0 || m == matrix) activeHeat[m] = -1;
+    }
+}
+
+// V16.5.7-2026-01-13T06:00:00Z - No clear of other matrices, no timing, no show()
+bool drawMatrix(const String& name, MatrixDisplay* disp, int matrix, uint32_t t) {
+    int which = effectIndex(name);
+    if (which < 0 || matrix < 0 || matrix >= MATRIX_COUNT) return false;
+
+    bindTables();  // Palette pointer may have been swapped by a theme change
+    if (which < 4) restartHeat(matrix);  // V16.7.4-2026-01-15T09:00:00Z
+    switch (which) {
+        case 0: renderMatrix(disp, matrix, colorWave, t); break;
+        case 1: renderMatrix(disp, matrix, plasma, t); break;
+        case 2: renderMatrix(disp, matrix, radialRainbow, t); break;
+        case 3: renderMatrix(disp, matrix, noiseField, t); break;
+        default: runHeat(disp, matrix, which - 4); break;
+    }
+    return true;
+}
+
+bool run(const String& name, MatrixDisplay* disp) {
+    static unsigned long lastFrame = 0;
+
+    // Dispatch first so unknown names fall through to the caller
+    if (!isEffect(name)) return false;
+
+    unsigned long now = millis();
+    if (now - lastFrame < EFFECT_FRAME_MS) return true;
+    lastFrame = now;
+
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        drawMatrix(name, disp, m, now);
+    }
+    disp->show();
+    return true;
+}
+
+// V16.5.0-2026-01-12T09:00:00Z - Kernel timing. Only kernel cost is measured (no show()).
+namespace {
+
+const int BENCH_FRAMES = 50;
+const int BENCH_COLS = 60;   // 3000 LEDs: 1000 live + a Mega-Matrix-sized 2000
+const int BENCH_ROWS = 50;
+
+template<typename Kernel>
+void benchKernel(const char* name, MatrixDisplay* disp, Kernel& kernel,
+                 CRGB* scratch, const Geometry& big) {
+    uint32_t start = micros();
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        renderAll(disp, kernel, f * EFFECT_FRAME_MS);
+    }
+    uint32_t liveUs = (micros() - start) / BENCH_FRAMES;
+
+    start = micros();
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        render(scratch, big, kernel, f * EFFECT_FRAME_MS);
+    }
+    uint32_t bigUs = (micros() - start) / BENCH_FRAMES;
+
+    Logger::instance().logf("[Effects] %-15s 1000 LEDs: %5lu us/frame  3000 LEDs: %5lu us/frame",
+                            name, (unsigned long)liveUs, (unsigned long)bigUs);
+}
+
+// V16.5.1-2026-01-12T12:00:00Z - Heat simulation step alone, then step + palette map,
+// on a Mega Matrix sized field (budget: 2 ms per frame)
+void benchHeat(HeatEffect& effect, CRGB* scratch, const Geometry& mega, HeatField& field) {
+    field.begin(mega.cols, mega.rows, HEAT_SEED);
+    uint32_t start = micros();
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        field.step(*effect.params);
+    }
+    uint32_t simUs = (micros() - start) / BENCH_FRAMES;
+
+    heatMap.palette = heatPalette(effect);
+    heatMap.heat = field.data();
+    start = micros();
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        field.step(*effect.params);
+        render(scratch, mega, heatMap, 0);
+    }
+    uint32_t totalUs = (micros() - start) / BENCH_FRAMES;
+
+    Logger::instance().logf("[Effects] %-15s %dx%d sim: %5lu us/frame  sim+map: %5lu us/frame",
+                            effect.name, mega.cols, mega.rows,
+                            (unsigned long)simUs, (unsigned long)totalUs);
+}
+
+} // namespace
+
+void benchmark(MatrixDisplay* disp) {
+    const int count = BENCH_COLS * BENCH_ROWS;
+    CRGB* scratch = (CRGB*)malloc(count * sizeof(CRGB));
+    uint16_t* index = (uint16_t*)malloc(count * sizeof(uint16_t));
+    uint8_t* radius = (uint8_t*)malloc(count);
+    uint8_t* angle = (uint8_t*)malloc(count);
+
+    if (scratch && index && radius && angle) {
+        Geometry big;
+        buildGeometry(big, BENCH_COLS, BENCH_ROWS, index, radius, angle);
+        bindTables();
+
+        Logger::instance().log("[Effects] Benchmark, " + String(BENCH_FRAMES) + " frames per kernel");
+        benchKernel("Color Wave", disp, colorWave, scratch, big);
+        benchKernel("Plasma", disp, plasma, scratch, big);
+        benchKernel("Radial Rainbow", disp, radialRainbow, scratch, big);
+        benchKernel("Noise Field", disp, noiseField, scratch, big);
+        disp->show();  // Leave the last Noise Field frame on screen
+
+        // Reuse the scratch index/radius/angle arrays at the Mega Matrix size
+        Geometry mega;
+        buildGeometry(mega, MATRIX2_COLS, MATRIX2_ROWS, index, radius, angle);
+        HeatField field;
+        for (int i = 0; i < HEAT_EFFECT_COUNT; i++) {
+            benchHeat(heatEffects[i], scratch, mega, field);
+        }
+    } else {
+        Logger::instance().log("[Effects] Benchmark skipped - out of memory");
+    }
+
+    free(scratch);
+    free(index);
+    free(radius);
+    free(angle);
+}
+
+} // namespace Effects
@@ -0,0 +1,180 @@
+/* Effects.h
+   Per-pixel effect kernels ("shaders") and the templated render driver
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - restartHeat(): heat effects start over when other content played
+   V16.5.7-2026-01-13T06:00:00Z - drawMatrix() for per-zone playback
+   V16.5.5-2026-01-13T00:00:00Z - renderKernel() into any grid (Mega Tree sampling)
+   V16.5.1-2026-01-12T12:00:00Z - Heat-field kernel (Fire, Embers, Smoke)
+   V16.5.0-2026-01-12T09:00:00Z - Initial implementation
+
+   An effect is a small struct with two members:
+     void frame(const Effects::Geometry& g, uint32_t t)   - once per matrix per frame;
+                                                           precompute per-row/column terms
+     CRGB operator()(int x, int y, uint32_t t) const      - one pixel
+   Effects::render<Kernel>() is instantiated per kernel, so the pixel call is inlined
+   into the loop. The loop walks the matrix in x/y order and writes through the
+   precomputed index table - no per-pixel serpentine math or bounds checks.
+   All math is 8-bit fixed point (sin8/inoise8 + 256-entry color tables).
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+class MatrixDisplay;
+
+#define EFFECT_MAX_DIM 64        // Largest cols/rows a kernel's term arrays support
+#define EFFECT_FRAME_MS 33       // ~30 fps
+
+namespace Effects {
+
+// V16.5.0-2026-01-12T09:00:00Z - Precomputed per-matrix coordinate data
+struct Geometry {
+    int cols;
+    int rows;
+    const uint16_t* index;   // LED index for (x, y) at [y * cols + x]
+    const uint8_t* radius;   // Distance from center, 0..255 spans the half-diagonal
+    const uint8_t* angle;    // atan2 around the center, 0..255 = full turn
+};
+
+// Built on first use from MatrixDisplay::getIndexTable()
+const Geometry& geometry(MatrixDisplay* disp, int matrix);
+
+// Build geometry for an arbitrary cols x rows grid (index = y * cols + x); used by the benchmark
+void buildGeometry(Geometry& g, int cols, int rows, uint16_t* index, uint8_t* radius, uint8_t* angle);
+
+// Full-saturation hue wheel, one lookup per pixel instead of hsv2rgb
+const CRGB* rainbowTable();
+
+// V16.5.0-2026-01-12T09:00:00Z - The driver: one instantiation per kernel type
+template<typename Kernel>
+inline void render(CRGB* leds, const Geometry& g, Kernel& kernel, uint32_t t) {
+    kernel.frame(g, t);
+    const uint16_t* idx = g.index;
+    for (int y = 0; y < g.rows; y++) {
+        for (int x = 0; x < g.cols; x++) {
+            leds[*idx++] = kernel(x, y, t);
+        }
+    }
+}
+
+// ========== Kernels ==========
+
+// Theme palette waves rolling diagonally; sum of two precomputed sine terms
+struct ColorWave {
+    const CRGB* palette;
+    uint8_t colTerm[EFFECT_MAX_DIM];
+    uint8_t rowTerm[EFFECT_MAX_DIM];
+
+    void frame(const Geometry& g, uint32_t t) {
+        uint8_t phase = t >> 3;
+        for (int x = 0; x < g.cols; x++) colTerm[x] = sin8(x * 12 + phase) >> 1;
+        for (int y = 0; y < g.rows; y++) rowTerm[y] = sin8(y * 8 - (phase >> 1)) >> 1;
+    }
+    CRGB operator()(int x, int y, uint32_t) const {
+        uint8_t v = colTerm[x] + rowTerm[y];
+        return palette[1 + scale8(v, 254)];  // Skip index 0 (black)
+    }
+};
+
+// Classic plasma: column + row + diagonal + ring sines into the hue wheel
+struct Plasma {
+    const CRGB* rainbow;
+    const uint8_t* radius;
+    int cols;
+    uint8_t colTerm[EFFECT_MAX_DIM];
+    uint8_t rowTerm[EFFECT_MAX_DIM];
+    uint8_t diagTerm[EFFECT_MAX_DIM * 2];
+    uint8_t ringPhase;
+
+    void frame(const Geometry& g, uint32_t t) {
+        radius = g.radius;
+        cols = g.cols;
+        uint8_t t1 = t >> 4, t2 = t >> 5, t3 = t >> 3;
+        for (int x = 0; x < g.cols; x++) colTerm[x] = sin8(x * 16 + t1) >> 2;
+        for (int y = 0; y < g.rows; y++) rowTerm[y] = sin8(y * 12 - t2) >> 2;
+        for (int d = 0; d < g.cols + g.rows; d++) diagTerm[d] = sin8(d * 10 + t3) >> 2;
+        ringPhase = t >> 2;
+    }
+    CRGB operator()(int x, int y, uint32_t) const {
+        uint8_t ring = sin8(radius[y * cols + x] * 3 - ringPhase) >> 2;
+        return rainbow[(uint8_t)(colTerm[x] + rowTerm[y] + diagTerm[x + y] + ring)];
+    }
+};
+
+// Hue by distance from center, spun by angle
+struct RadialRainbow {
+    const CRGB* rainbow;
+    const uint8_t* radius;
+    const uint8_t* angle;
+    int cols;
+    uint8_t phase;
+
+    void frame(const Geometry& g, uint32_t t) {
+        radius = g.radius;
+        angle = g.angle;
+        cols = g.cols;
+        phase = t >> 2;
+    }
+    CRGB operator()(int x, int y, uint32_t) const {
+        int i = y * cols + x;
+        return rainbow[(uint8_t)(radius[i] * 2 + (angle[i] >> 2) - phase)];
+    }
+};
+
+// Drifting 3D value noise sampled through the theme palette
+struct NoiseField {
+    const CRGB* palette;
+    uint16_t xs[EFFECT_MAX_DIM];
+    uint16_t ys[EFFECT_MAX_DIM];
+    uint16_t z;
+
+    void frame(const Geometry& g, uint32_t t) {
+        uint16_t drift = t >> 1;
+        for (int x = 0; x < g.cols; x++) xs[x] = x * 40 + drift;
+        for (int y = 0; y < g.rows; y++) ys[y] = y * 40;
+        z = t << 1;
+    }
+    CRGB operator()(int x, int y, uint32_t) const {
+        uint8_t v = qsub8(inoise8(xs[x], ys[y], z), 32);
+        v = qadd8(v, v >> 1);  // Noise clusters around 128; stretch ~32..200 to full range
+        return palette[1 + scale8(v, 254)];
+    }
+};
+
+// V16.5.1-2026-01-12T12:00:00Z - Heat cells straight through a heat palette (0 = black)
+struct HeatMap {
+    const CRGB* palette;
+    const uint8_t* heat;   // HeatField rows for the matrix being rendered, [y * cols + x]
+    int cols;
+
+    void frame(const Geometry& g, uint32_t) { cols = g.cols; }
+    CRGB operator()(int x, int y, uint32_t) const {
+        return palette[heat[y * cols + x]];
+    }
+};
+
+// ========== Content entry points ==========
+
+// Render one frame of a named effect on all matrices (rate-limited to EFFECT_FRAME_MS,
+// calls show()). Returns false if the name is not an effect.
+bool run(const String& name, MatrixDisplay* disp);
+
+// V16.5.7-2026-01-13T06:00:00Z - One frame of a named effect into a single matrix; leaves the
+// other matrices alone and does not call show() (ZoneManager composites and shows)
+bool drawMatrix(const String& name, MatrixDisplay* disp, int matrix, uint32_t t);
+bool isEffect(const String& name);
+
+// V16.7.4-2026-01-15T09:00:00Z - Drop a matrix's heat field (-1 = all): the next heat frame
+// there starts again from the seed instead of resuming where the last heat effect stopped
+void restartHeat(int matrix);
+
+// V16.5.5-2026-01-13T00:00:00Z - Render one frame of a named kernel (Color Wave, Plasma,
+// Radial Rainbow, Noise Field) into an arbitrary grid; false if the name is not a kernel
+bool renderKernel(const String& name, CRGB* leds, const Geometry& g, uint32_t t);
+
+// Time every kernel at 1000 LEDs (the live matrices) and 3000 LEDs (off-screen
+// 60x50 grid), plus the heat simulation at Mega Matrix size; results go to Logger
+void benchmark(MatrixDisplay* disp);
+
+} // namespace Effects
@@ -0,0 +1,128 @@
+/* EventStream.cpp
+   State polling, log broadcast and reconnect backfill
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Log broadcast held while a new client is backfilled
+   V16.7.3-2026-01-14T18:00:00Z - State event when realtime input starts or ends
+   V16.7.0-2026-01-14T09:00:00Z - Log reads are lock-free
+   V16.6.4-2026-01-14T00:00:00Z - Initial implementation
+*/
+
+#include "EventStream.h"
+#include "ContentManager.h"
+#include "ThemeManager.h"
+#include "MatrixDisplay.h"
+#include "ZoneManager.h"
+#include "RealtimeReceiver.h"
+#include "Logger.h"
+
+EventStream eventStream;
+
+void EventStream::begin(AsyncWebServer& server, ContentManager* contentMgr, ThemeManager* themeMgr,
+                        MatrixDisplay* disp, std::function<String()> statusJson) {
+    content = contentMgr;
+    themes = themeMgr;
+    display = disp;
+    status = statusJson;
+    logCursor = Logger::instance().getLastSequence();
+    lock = xSemaphoreCreateMutex();
+
+    source.onConnect([this](AsyncEventSourceClient* client) { onConnect(client); });
+    // V16.7.4-2026-01-15T09:00:00Z - Called before the client joins the broadcast
+    source.setFilter([this](AsyncWebServerRequest* request) {
+        if (request->method() == HTTP_GET && request->url() == "/api/events") {
+            xSemaphoreTake(lock, portMAX_DELAY);
+            connecting++;
+            connectingSince = millis();
+            xSemaphoreGive(lock);
+        }
+        return true;
+    });
+    server.addHandler(&source);
+}
+
+void EventStream::onConnect(AsyncEventSourceClient* client) {
+    // TCP task: log reads are lock-free; everything else waits for loop()
+    xSemaphoreTake(lock, portMAX_DELAY);  // Held for the backfill: no line is broadcast meanwhile
+    uint32_t upTo = logCursor;  // Later lines reach this client through the broadcast
+    uint32_t cursor = client->lastId();
+    if (cursor == 0 || cursor > upTo) {
+        cursor = upTo > SSE_BACKLOG ? upTo - SSE_BACKLOG : 0;
+    } else if (upTo - cursor > SSE_BACKLOG) {
+        client->send(("{\"missed\":" + String(upTo - cursor - SSE_BACKLOG) + "}").c_str(), "gap");
+        cursor = upTo - SSE_BACKLOG;
+    }
+
+    String line;
+    uint32_t seq;
+    while ((seq = Logger::instance().readAfter(cursor, line)) != 0 && seq <= upTo) {
+        if (seq > cursor + 1) {
+            client->send(("{\"missed\":" + String(seq - cursor - 1) + "}").c_str(), "gap");
+        }
+        client->send(line.c_str(), "log", seq);
+        cursor = seq;
+    }
+    if (connecting) connecting--;
+    xSemaphoreGive(lock);
+    stateWanted = true;
+}
+
+void EventStream::sendLogs() {
+    String line;
+    uint32_t seq;
+    for (int n = 0; n < SSE_BURST; n++) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        if (connecting && millis() - connectingSince < SSE_CONNECT_MS) {
+            xSemaphoreGive(lock);  // A client is joining: its backfill goes first
+            break;
+        }
+        connecting = 0;  // Any left never reached onConnect()
+        uint32_t cursor = logCursor;
+        if ((seq = Logger::instance().readAfter(cursor, line)) == 0) {
+            xSemaphoreGive(lock);
+            break;
+        }
+        if (seq > cursor + 1) {
+            source.send(("{\"missed\":" + String(seq - cursor - 1) + "}").c_str(), "gap");
+            eventsSent++;
+        }
+        source.send(line.c_str(), "log", seq);
+        eventsSent++;
+        logCursor = seq;
+        xSemaphoreGive(lock);
+    }
+}
+
+void EventStream::update() {
+    unsigned long now = millis();
+    if (!content || now - lastPoll < SSE_POLL_MS) return;
+    lastPoll = now;
+
+    clients = source.count();
+    if (clients == 0) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        bool joining = connecting && millis() - connectingSince < SSE_CONNECT_MS;
+        if (!joining && source.count() == 0) {
+            connecting = 0;
+            logCursor = Logger::instance().getLastSequence();
+        }
+        xSemaphoreGive(lock);
+        return;
+    }
+
+    State current;
+    current.playingId = content->getLastRenderedId();
+    current.zones = zones.isActive();
+    current.realtime = realtime.isActive();
+    current.brightness = display->getBrightness();
+    current.settings = content->getSettingsGeneration();
+    current.theme = themes->getThemeGeneration();
+
+    if (current != last || stateWanted || now - lastState >= SSE_HEARTBEAT_MS) {
+        stateWanted = false;
+        last = current;
+        lastState = now;
+        source.send(status().c_str(), "state");
+        eventsSent++;
+    }
+
+    sendLogs();  // After the state: a line about a change follows the change
+}
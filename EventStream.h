@@ -0,0 +1,86 @@
+/* EventStream.h
+   Server-sent events for state changes and log lines (/api/events)
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Backfill and broadcast never interleave
+   V16.7.3-2026-01-14T18:00:00Z - State event when realtime input starts or ends
+   V16.6.4-2026-01-14T00:00:00Z - Initial implementation
+
+   Events:
+     state  the /api/status JSON (plus brightness), when what is playing, brightness,
+            random/scheduler mode, theme or realtime input changes, and every SSE_HEARTBEAT_MS
+     log    one log line; the event id is its Logger sequence number
+     gap    {"missed":N} - lines that left the log buffer before they could be sent
+   Clients share one broadcast: loop() polls every SSE_POLL_MS and sends what changed
+   once, however many dashboards are open. A client's only cursor is the id of the last
+   log line it got, which the browser sends back as Last-Event-ID when it reconnects:
+   it is backfilled from there (at most SSE_BACKLOG lines, else a gap event). New clients
+   get the last SSE_BACKLOG lines. With no client connected update() only keeps the log
+   cursor current.
+   V16.7.4-2026-01-15T09:00:00Z - The backfill runs on the TCP task, and the server puts the
+   client on the broadcast list just before onConnect(). So the request filter marks the
+   client as connecting first: from then until its backfill is sent, loop() broadcasts no
+   log lines (at most SSE_CONNECT_MS), and the backfill ends at the last line broadcast.
+   Each line therefore reaches a new client once, in order.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <functional>
+#include "Config.h"
+
+class ContentManager;
+class ThemeManager;
+class MatrixDisplay;
+
+class EventStream {
+public:
+    EventStream() {}
+
+    void begin(AsyncWebServer& server, ContentManager* contentMgr, ThemeManager* themeMgr,
+               MatrixDisplay* disp, std::function<String()> statusJson);
+    void update();  // Call from loop()
+
+    int getClientCount() const { return clients; }
+    uint32_t getEventsSent() const { return eventsSent; }
+
+private:
+    AsyncEventSource source{"/api/events"};
+    ContentManager* content = nullptr;
+    ThemeManager* themes = nullptr;
+    MatrixDisplay* display = nullptr;
+    std::function<String()> status;
+
+    // What a state event reports; compared field by field each poll
+    struct State {
+        uint16_t playingId = 0;
+        bool zones = false;
+        bool realtime = false;   // V16.7.3-2026-01-14T18:00:00Z
+        uint8_t brightness = 0;
+        uint32_t settings = 0;   // ContentManager settings generation (random, scheduler, ...)
+        uint32_t theme = 0;      // ThemeManager theme generation
+        bool operator!=(const State& o) const {
+            return playingId != o.playingId || zones != o.zones || realtime != o.realtime || brightness != o.brightness ||
+                   settings != o.settings || theme != o.theme;
+        }
+    };
+    State last;
+    unsigned long lastPoll = 0;
+    unsigned long lastState = 0;
+    volatile bool stateWanted = false;  // A client connected: send state on the next poll
+
+    volatile uint32_t logCursor = 0;    // Newest log line broadcast (read by onConnect)
+    // V16.7.4-2026-01-15T09:00:00Z - Guards logCursor, connecting and each broadcast line
+    SemaphoreHandle_t lock = nullptr;
+    int connecting = 0;                 // Clients between the filter and their backfill
+    unsigned long connectingSince = 0;
+    int clients = 0;
+    uint32_t eventsSent = 0;
+
+    void onConnect(AsyncEventSourceClient* client);
+    void sendLogs();
+};
+
+extern EventStream eventStream;
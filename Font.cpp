@@ -0,0 +1,160 @@
+/* Font.cpp
+   Shared bitmap font subsystem implementation
+   VERSION: V16.4.3-2026-01-11T17:00:00Z - Palette-index glyph blit
+   V16.4.0-2026-01-11T09:00:00Z - Initial implementation
+*/
+
+#include "Font.h"
+#include "MatrixDisplay.h"
+
+// V16.4.0-2026-01-11T09:00:00Z - Direct-mapped glyph cache (power of two)
+#define GLYPH_CACHE_SIZE 64
+
+namespace {
+
+struct GlyphCacheSlot {
+    const Font* font;
+    uint32_t codepoint;
+    const Glyph* glyph;
+};
+
+GlyphCacheSlot glyphCache[GLYPH_CACHE_SIZE];
+
+const Glyph* searchGlyph(const Font& font, uint32_t codepoint) {
+    int lo = 0;
+    int hi = font.glyphCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) >> 1;
+        uint16_t cp = font.glyphs[mid].codepoint;
+        if (cp == codepoint) return &font.glyphs[mid];
+        if (cp < codepoint) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return nullptr;
+}
+
+// Read `width` bits (<= 16) starting at bitPos, MSB first.
+// The compiler pads every bitmap with two zero bytes so the 3-byte window is always valid.
+inline uint16_t readRowBits(const uint8_t* bitmap, uint32_t bitPos, uint8_t width) {
+    const uint8_t* p = bitmap + (bitPos >> 3);
+    uint32_t window = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (window >> (24 - (bitPos & 7) - width)) & ((1u << width) - 1);
+}
+
+// V16.4.0-2026-01-11T09:00:00Z - Clip once against the matrix, then walk only visible bits
+// V16.4.3-2026-01-11T17:00:00Z - Shared by the CRGB and palette-index blits
+template<typename Plot>
+void blitGlyph(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const Glyph* glyph, Plot plot) {
+    int cols = disp->getMatrixCols(matrix);
+    int rows = disp->getMatrixRows(matrix);
+
+    int colStart = (x < 0) ? -x : 0;
+    int colEnd = min((int)glyph->width, cols - x);
+    int rowStart = (y < 0) ? -y : 0;
+    int rowEnd = min((int)font.height, rows - y);
+    if (colStart >= colEnd || rowStart >= rowEnd) return;
+
+    uint8_t width = glyph->width;
+    uint32_t bitPos = glyph->bitOffset + rowStart * width;
+    for (int row = rowStart; row < rowEnd; row++, bitPos += width) {
+        uint16_t bits = readRowBits(font.bitmap, bitPos, width);
+        if (!bits) continue;
+        for (int col = colStart; col < colEnd; col++) {
+            if (bits & (1u << (width - 1 - col))) {
+                plot(x + col, y + row);
+            }
+        }
+    }
+}
+
+} // namespace
+
+namespace Fonts {
+
+const Font* byName(const String& name) {
+    if (name == "3x5") return &FONT_3X5;
+    if (name == "5x7") return &FONT_5X7;
+    if (name == "7x12") return &FONT_7X12;
+    return nullptr;
+}
+
+uint32_t nextCodepoint(const char*& p) {
+    uint8_t c = (uint8_t)*p;
+    if (c == 0) return 0;
+    p++;
+    if (c < 0x80) return c;
+
+    uint32_t cp;
+    int extra;
+    if ((c & 0xE0) == 0xC0)      { cp = c & 0x1F; extra = 1; }
+    else if ((c & 0xF0) == 0xE0) { cp = c & 0x0F; extra = 2; }
+    else if ((c & 0xF8) == 0xF0) { cp = c & 0x07; extra = 3; }
+    else return 0xFFFD;  // Stray continuation or invalid lead byte
+
+    while (extra--) {
+        uint8_t n = (uint8_t)*p;
+        if ((n & 0xC0) != 0x80) return 0xFFFD;  // Truncated sequence - don't consume
+        cp = (cp << 6) | (n & 0x3F);
+        p++;
+    }
+    return cp;
+}
+
+const Glyph* findGlyph(const Font& font, uint32_t codepoint) {
+    uint32_t slot = (codepoint ^ ((uintptr_t)&font >> 3)) & (GLYPH_CACHE_SIZE - 1);
+    GlyphCacheSlot& entry = glyphCache[slot];
+    if (entry.font == &font && entry.codepoint == codepoint) {
+        return entry.glyph;
+    }
+
+    const Glyph* glyph = searchGlyph(font, codepoint);
+    if (!glyph && codepoint >= 'a' && codepoint <= 'z') {
+        glyph = searchGlyph(font, codepoint - 'a' + 'A');  // Fonts without lowercase
+    }
+    if (!glyph) {
+        glyph = searchGlyph(font, font.fallback);
+    }
+
+    entry.font = &font;
+    entry.codepoint = codepoint;
+    entry.glyph = glyph;
+    return glyph;
+}
+
+int textWidth(const Font& font, const char* utf8) {
+    int width = 0;
+    uint32_t cp;
+    while ((cp = nextCodepoint(utf8)) != 0) {
+        width += advance(font, findGlyph(font, cp));
+    }
+    return width;
+}
+
+void drawGlyph(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const Glyph* glyph, CRGB color) {
+    blitGlyph(disp, matrix, x, y, font, glyph, [&](int px, int py) {
+        disp->setPixel(matrix, px, py, color);
+    });
+}
+
+// V16.4.3-2026-01-11T17:00:00Z - Same blit into the palette-indexed framebuffer
+void drawGlyphIndex(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const Glyph* glyph, uint8_t paletteIndex) {
+    blitGlyph(disp, matrix, x, y, font, glyph, [&](int px, int py) {
+        disp->setPixelIndex(matrix, px, py, paletteIndex);
+    });
+}
+
+int drawText(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const char* utf8, CRGB color) {
+    int cols = disp->getMatrixCols(matrix);
+    int startX = x;
+    uint32_t cp;
+    while ((cp = nextCodepoint(utf8)) != 0) {
+        const Glyph* glyph = findGlyph(font, cp);
+        if (x < cols && x + glyph->width > 0) {
+            drawGlyph(disp, matrix, x, y, font, glyph, color);
+        }
+        x += advance(font, glyph);
+    }
+    return x - startX;
+}
+
+} // namespace Fonts
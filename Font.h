@@ -0,0 +1,57 @@
+/* Font.h
+   Shared bitmap font subsystem - bit-packed variable-width glyphs
+   VERSION: V16.4.0-2026-01-11T09:00:00Z - Initial implementation
+
+   Glyph tables live in FontData.cpp, generated by tools/fonts/build_fonts.py
+   Text is UTF-8; glyph lookups go through a small direct-mapped cache
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+class MatrixDisplay;
+
+// V16.4.0-2026-01-11T09:00:00Z - One glyph in a bit-packed bitmap
+struct Glyph {
+    uint16_t codepoint;   // BMP code point
+    uint16_t bitOffset;   // First bit of the glyph in Font::bitmap
+    uint8_t width;        // Columns (rows come from Font::height)
+};
+
+struct Font {
+    const char* name;
+    uint8_t height;
+    uint8_t spacing;      // Blank columns after each glyph
+    uint16_t fallback;    // Code point drawn when a glyph is missing
+    uint16_t glyphCount;
+    const Glyph* glyphs;  // Sorted by codepoint
+    const uint8_t* bitmap;
+};
+
+// V16.4.0-2026-01-11T09:00:00Z - Compiled fonts (FontData.cpp)
+extern const Font FONT_3X5;   // Countdown digits/labels
+extern const Font FONT_5X7;   // Scroll text
+extern const Font FONT_7X12;  // Mega Matrix text
+
+namespace Fonts {
+    // Look up a font by JSON name ("3x5", "5x7", "7x12"); nullptr if unknown
+    const Font* byName(const String& name);
+
+    // Decode one UTF-8 code point and advance p; returns 0 at end of string
+    uint32_t nextCodepoint(const char*& p);
+
+    // Cached glyph lookup with case folding and fallback (never nullptr)
+    const Glyph* findGlyph(const Font& font, uint32_t codepoint);
+
+    // Width in pixels of a glyph including trailing spacing
+    inline int advance(const Font& font, const Glyph* glyph) { return glyph->width + font.spacing; }
+    int textWidth(const Font& font, const char* utf8);
+
+    // Clipped blit of one glyph with its top-left corner at (x, y)
+    void drawGlyph(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const Glyph* glyph, CRGB color);
+    // V16.4.3-2026-01-11T17:00:00Z - Same blit writing a palette index (indexed mode)
+    void drawGlyphIndex(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const Glyph* glyph, uint8_t paletteIndex);
+    int drawText(MatrixDisplay* disp, int matrix, int x, int y, const Font& font, const char* utf8, CRGB color);
+}
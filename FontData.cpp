@@ -0,0 +1,334 @@
+/* FontData.cpp
+   Bit-packed glyph tables generated by tools/fonts/build_fonts.py
+   DO NOT EDIT - change the .font sources and re-run the compiler
+*/
+
+#include "Font.h"
+
+// ---- FONT_3X5: 44 glyphs, 81 bitmap bytes ----
+static const uint8_t FONT_3X5_BITMAP[] = {
+  0x00, 0x3A, 0x17, 0x40, 0x0E, 0x00, 0x49, 0x52, 0x7B, 0x6F, 0x59, 0x2F, 0xCF, 0x9F, 0x9E, 0x7D,
+  0xBC, 0x9F, 0x39, 0xFE, 0x7B, 0xF9, 0x24, 0xFB, 0xEF, 0xF7, 0x9E, 0xAC, 0x50, 0x4A, 0xFB, 0x75,
+  0xD7, 0x39, 0x23, 0xD6, 0xDD, 0xE6, 0x9F, 0xCD, 0x23, 0x96, 0xBB, 0x7D, 0xBD, 0x25, 0xC9, 0x35,
+  0x5B, 0xAD, 0x92, 0x4F, 0x7D, 0xB7, 0x5B, 0x6A, 0xB6, 0xAD, 0x74, 0x8A, 0xDC, 0xF5, 0xD6, 0xF9,
+  0xCF, 0xE9, 0x25, 0x6D, 0xBE, 0xDB, 0x55, 0xB7, 0xDB, 0x55, 0xB6, 0xA4, 0xB9, 0x53, 0x80, 0x00,
+  0x00,
+};
+
+static const Glyph FONT_3X5_GLYPHS[] = {
+  {0x0020,     0,  2},  // U+0020
+  {0x0021,    10,  1},  // '!'
+  {0x002B,    15,  3},  // '+'
+  {0x002D,    30,  3},  // '-'
+  {0x002E,    45,  1},  // '.'
+  {0x002F,    50,  3},  // '/'
+  {0x0030,    65,  3},  // '0'
+  {0x0031,    80,  3},  // '1'
+  {0x0032,    95,  3},  // '2'
+  {0x0033,   110,  3},  // '3'
+  {0x0034,   125,  3},  // '4'
+  {0x0035,   140,  3},  // '5'
+  {0x0036,   155,  3},  // '6'
+  {0x0037,   170,  3},  // '7'
+  {0x0038,   185,  3},  // '8'
+  {0x0039,   200,  3},  // '9'
+  {0x003A,   215,  1},  // ':'
+  {0x003F,   220,  3},  // '?'
+  {0x0041,   235,  3},  // 'A'
+  {0x0042,   250,  3},  // 'B'
+  {0x0043,   265,  3},  // 'C'
+  {0x0044,   280,  3},  // 'D'
+  {0x0045,   295,  3},  // 'E'
+  {0x0046,   310,  3},  // 'F'
+  {0x0047,   325,  3},  // 'G'
+  {0x0048,   340,  3},  // 'H'
+  {0x0049,   355,  3},  // 'I'
+  {0x004A,   370,  3},  // 'J'
+  {0x004B,   385,  3},  // 'K'
+  {0x004C,   400,  3},  // 'L'
+  {0x004D,   415,  3},  // 'M'
+  {0x004E,   430,  3},  // 'N'
+  {0x004F,   445,  3},  // 'O'
+  {0x0050,   460,  3},  // 'P'
+  {0x0051,   475,  3},  // 'Q'
+  {0x0052,   490,  3},  // 'R'
+  {0x0053,   505,  3},  // 'S'
+  {0x0054,   520,  3},  // 'T'
+  {0x0055,   535,  3},  // 'U'
+  {0x0056,   550,  3},  // 'V'
+  {0x0057,   565,  3},  // 'W'
+  {0x0058,   580,  3},  // 'X'
+  {0x0059,   595,  3},  // 'Y'
+  {0x005A,   610,  3},  // 'Z'
+};
+
+const Font FONT_3X5 = {
+  "3x5", 5, 1, 0x003F, 44,
+  FONT_3X5_GLYPHS, FONT_3X5_BITMAP
+};
+
+// ---- FONT_5X7: 100 glyphs, 393 bitmap bytes ----
+static const uint8_t FONT_5X7_BITMAP[] = {
+  0x00, 0x00, 0x07, 0xDB, 0x68, 0x00, 0x29, 0x5F, 0x57, 0xD4, 0xA2, 0x3E, 0x8E, 0x2F, 0x89, 0x8C,
+  0x88, 0x88, 0x98, 0xD9, 0x2A, 0x22, 0xB2, 0x6E, 0xC0, 0x05, 0x49, 0x11, 0x88, 0x92, 0xA0, 0x09,
+  0x57, 0x54, 0x80, 0x01, 0x09, 0xF2, 0x10, 0x00, 0x1B, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xC0,
+  0x11, 0x11, 0x10, 0x03, 0xA3, 0x3A, 0xE6, 0x2E, 0x59, 0x24, 0xBB, 0xA2, 0x11, 0x11, 0x1F, 0xF8,
+  0x88, 0x20, 0xC5, 0xC2, 0x32, 0xA5, 0xF1, 0x0B, 0xF0, 0xF0, 0x43, 0x17, 0x19, 0x10, 0xF4, 0x62,
+  0xEF, 0x84, 0x44, 0x42, 0x10, 0xE8, 0xC5, 0xD1, 0x8B, 0x9D, 0x18, 0xBC, 0x22, 0x61, 0xE7, 0x87,
+  0x9B, 0x09, 0x24, 0x21, 0x08, 0x01, 0xF0, 0x7C, 0x00, 0x84, 0x21, 0x24, 0x87, 0x44, 0x22, 0x20,
+  0x08, 0xE8, 0x85, 0xB5, 0xAB, 0x9D, 0x18, 0xC7, 0xF1, 0x8F, 0xA3, 0x1F, 0x46, 0x3E, 0x74, 0x61,
+  0x08, 0x45, 0xDC, 0x94, 0x63, 0x19, 0x73, 0xF0, 0x87, 0xA1, 0x0F, 0xFE, 0x10, 0xF4, 0x21, 0x07,
+  0x46, 0x17, 0x8C, 0x5F, 0x18, 0xC7, 0xF1, 0x8C, 0x7A, 0x49, 0x2E, 0x71, 0x08, 0x42, 0x93, 0x23,
+  0x2A, 0x62, 0x92, 0x8C, 0x21, 0x08, 0x42, 0x1F, 0x8E, 0xEB, 0x58, 0xC6, 0x31, 0x8E, 0x6B, 0x38,
+  0xC5, 0xD1, 0x8C, 0x63, 0x17, 0x7A, 0x31, 0xF4, 0x21, 0x07, 0x46, 0x31, 0xAC, 0x9B, 0xE8, 0xC7,
+  0xD4, 0x94, 0x5F, 0x08, 0x38, 0x21, 0xF7, 0xC8, 0x42, 0x10, 0x84, 0x8C, 0x63, 0x18, 0xC5, 0xD1,
+  0x8C, 0x63, 0x15, 0x12, 0x31, 0x8D, 0x6B, 0x55, 0x46, 0x2A, 0x22, 0xA3, 0x18, 0xC6, 0x2A, 0x21,
+  0x09, 0xF0, 0x88, 0x88, 0x87, 0xFC, 0x92, 0x4E, 0x08, 0x20, 0x82, 0x08, 0x39, 0x24, 0x9E, 0x45,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x44, 0x00, 0x00, 0x07, 0x05, 0xF1, 0x7C, 0x21,
+  0x6C, 0xC6, 0x3E, 0x00, 0x1D, 0x08, 0x45, 0xC1, 0x0B, 0x67, 0x18, 0xBC, 0x00, 0x74, 0x7F, 0x07,
+  0x19, 0x28, 0xE2, 0x10, 0x80, 0x3E, 0x31, 0x78, 0x5D, 0x08, 0x5B, 0x31, 0x8C, 0x50, 0xC9, 0x2E,
+  0x20, 0x62, 0x32, 0xD1, 0x13, 0x59, 0x53, 0x92, 0x49, 0x70, 0x03, 0x55, 0xAC, 0x62, 0x00, 0x5B,
+  0x31, 0x8C, 0x40, 0x07, 0x46, 0x31, 0x70, 0x01, 0xE8, 0xFA, 0x10, 0x00, 0x1B, 0x37, 0x84, 0x20,
+  0x05, 0xB3, 0x08, 0x40, 0x00, 0x74, 0x1C, 0x1F, 0x21, 0x1C, 0x42, 0x12, 0x60, 0x02, 0x31, 0x8C,
+  0xDA, 0x00, 0x46, 0x31, 0x51, 0x00, 0x08, 0xC6, 0xB5, 0x50, 0x01, 0x15, 0x11, 0x51, 0x00, 0x23,
+  0x17, 0x85, 0xC0, 0x07, 0xC4, 0x44, 0x7C, 0xA5, 0x12, 0x3F, 0xE2, 0x45, 0x28, 0x00, 0x22, 0xA2,
+  0x00, 0x1A, 0x65, 0x80, 0x00, 0x84, 0xFB, 0x95, 0x10, 0x2B, 0xFF, 0xFB, 0x88, 0x03, 0x14, 0x84,
+  0x67, 0x10, 0x0A, 0xBB, 0xEE, 0xA8, 0x00, 0x00, 0x00,
+};
+
+static const Glyph FONT_5X7_GLYPHS[] = {
+  {0x0020,     0,  3},  // U+0020
+  {0x0021,    21,  1},  // '!'
+  {0x0022,    28,  3},  // '"'
+  {0x0023,    49,  5},  // '#'
+  {0x0024,    84,  5},  // '$'
+  {0x0025,   119,  5},  // '%'
+  {0x0026,   154,  5},  // '&'
+  {0x0027,   189,  2},  // U+0027
+  {0x0028,   203,  3},  // '('
+  {0x0029,   224,  3},  // ')'
+  {0x002A,   245,  5},  // '*'
+  {0x002B,   280,  5},  // '+'
+  {0x002C,   315,  2},  // ','
+  {0x002D,   329,  5},  // '-'
+  {0x002E,   364,  2},  // '.'
+  {0x002F,   378,  5},  // '/'
+  {0x0030,   413,  5},  // '0'
+  {0x0031,   448,  3},  // '1'
+  {0x0032,   469,  5},  // '2'
+  {0x0033,   504,  5},  // '3'
+  {0x0034,   539,  5},  // '4'
+  {0x0035,   574,  5},  // '5'
+  {0x0036,   609,  5},  // '6'
+  {0x0037,   644,  5},  // '7'
+  {0x0038,   679,  5},  // '8'
+  {0x0039,   714,  5},  // '9'
+  {0x003A,   749,  2},  // ':'
+  {0x003B,   763,  2},  // ';'
+  {0x003C,   777,  4},  // '<'
+  {0x003D,   805,  5},  // '='
+  {0x003E,   840,  4},  // '>'
+  {0x003F,   868,  5},  // '?'
+  {0x0040,   903,  5},  // '@'
+  {0x0041,   938,  5},  // 'A'
+  {0x0042,   973,  5},  // 'B'
+  {0x0043,  1008,  5},  // 'C'
+  {0x0044,  1043,  5},  // 'D'
+  {0x0045,  1078,  5},  // 'E'
+  {0x0046,  1113,  5},  // 'F'
+  {0x0047,  1148,  5},  // 'G'
+  {0x0048,  1183,  5},  // 'H'
+  {0x0049,  1218,  3},  // 'I'
+  {0x004A,  1239,  5},  // 'J'
+  {0x004B,  1274,  5},  // 'K'
+  {0x004C,  1309,  5},  // 'L'
+  {0x004D,  1344,  5},  // 'M'
+  {0x004E,  1379,  5},  // 'N'
+  {0x004F,  1414,  5},  // 'O'
+  {0x0050,  1449,  5},  // 'P'
+  {0x0051,  1484,  5},  // 'Q'
+  {0x0052,  1519,  5},  // 'R'
+  {0x0053,  1554,  5},  // 'S'
+  {0x0054,  1589,  5},  // 'T'
+  {0x0055,  1624,  5},  // 'U'
+  {0x0056,  1659,  5},  // 'V'
+  {0x0057,  1694,  5},  // 'W'
+  {0x0058,  1729,  5},  // 'X'
+  {0x0059,  1764,  5},  // 'Y'
+  {0x005A,  1799,  5},  // 'Z'
+  {0x005B,  1834,  3},  // '['
+  {0x005C,  1855,  5},  // U+005C
+  {0x005D,  1890,  3},  // ']'
+  {0x005E,  1911,  5},  // '^'
+  {0x005F,  1946,  5},  // '_'
+  {0x0060,  1981,  3},  // '`'
+  {0x0061,  2002,  5},  // 'a'
+  {0x0062,  2037,  5},  // 'b'
+  {0x0063,  2072,  5},  // 'c'
+  {0x0064,  2107,  5},  // 'd'
+  {0x0065,  2142,  5},  // 'e'
+  {0x0066,  2177,  5},  // 'f'
+  {0x0067,  2212,  5},  // 'g'
+  {0x0068,  2247,  5},  // 'h'
+  {0x0069,  2282,  3},  // 'i'
+  {0x006A,  2303,  4},  // 'j'
+  {0x006B,  2331,  4},  // 'k'
+  {0x006C,  2359,  3},  // 'l'
+  {0x006D,  2380,  5},  // 'm'
+  {0x006E,  2415,  5},  // 'n'
+  {0x006F,  2450,  5},  // 'o'
+  {0x0070,  2485,  5},  // 'p'
+  {0x0071,  2520,  5},  // 'q'
+  {0x0072,  2555,  5},  // 'r'
+  {0x0073,  2590,  5},  // 's'
+  {0x0074,  2625,  5},  // 't'
+  {0x0075,  2660,  5},  // 'u'
+  {0x0076,  2695,  5},  // 'v'
+  {0x0077,  2730,  5},  // 'w'
+  {0x0078,  2765,  5},  // 'x'
+  {0x0079,  2800,  5},  // 'y'
+  {0x007A,  2835,  5},  // 'z'
+  {0x007B,  2870,  3},  // '{'
+  {0x007C,  2891,  1},  // '|'
+  {0x007D,  2898,  3},  // '}'
+  {0x007E,  2919,  5},  // '~'
+  {0x00B0,  2954,  4},  // U+00B0
+  {0x2605,  2982,  5},  // U+2605
+  {0x2665,  3017,  5},  // U+2665
+  {0x266A,  3052,  5},  // U+266A
+  {0x2744,  3087,  5},  // U+2744
+};
+
+const Font FONT_5X7 = {
+  "5x7", 7, 1, 0x003F, 100,
+  FONT_5X7_GLYPHS, FONT_5X7_BITMAP
+};
+
+// ---- FONT_7X12: 79 glyphs, 608 bitmap bytes ----
+static const uint8_t FONT_7X12_BITMAP[] = {
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xEC, 0xB6, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x2A, 0x49, 0x24, 0x44,
+  0x08, 0x89, 0x24, 0x95, 0x00, 0x00, 0x00, 0x42, 0x7C, 0x84, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x44, 0x22, 0x11, 0x08, 0x84,
+  0x00, 0x07, 0xA1, 0x8E, 0x59, 0x69, 0xA7, 0x18, 0x5E, 0x00, 0x03, 0x14, 0x90, 0x41, 0x04, 0x10,
+  0x41, 0x3F, 0x00, 0x07, 0xA1, 0x04, 0x10, 0x84, 0x21, 0x08, 0x3F, 0x00, 0x07, 0xA1, 0x04, 0x13,
+  0x81, 0x04, 0x18, 0x5E, 0x00, 0x00, 0x86, 0x29, 0x28, 0xBF, 0x08, 0x20, 0x82, 0x00, 0x0F, 0xE0,
+  0x83, 0xE0, 0x41, 0x04, 0x18, 0x5E, 0x00, 0x03, 0x90, 0x82, 0x0F, 0xA1, 0x86, 0x18, 0x5E, 0x00,
+  0x0F, 0xC1, 0x04, 0x20, 0x84, 0x10, 0x82, 0x08, 0x00, 0x07, 0xA1, 0x86, 0x17, 0xA1, 0x86, 0x18,
+  0x5E, 0x00, 0x07, 0xA1, 0x86, 0x18, 0x5F, 0x04, 0x10, 0x9C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0xF0,
+  0x3D, 0x80, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x7A, 0x10, 0x42, 0x10, 0x82, 0x00, 0x20,
+  0x80, 0x00, 0x31, 0x28, 0x61, 0x87, 0xF8, 0x61, 0x86, 0x10, 0x00, 0xFA, 0x18, 0x61, 0xFA, 0x18,
+  0x61, 0x87, 0xE0, 0x00, 0x7A, 0x18, 0x20, 0x82, 0x08, 0x20, 0x85, 0xE0, 0x00, 0xF2, 0x28, 0x61,
+  0x86, 0x18, 0x61, 0x8B, 0xC0, 0x00, 0xFE, 0x08, 0x20, 0xFA, 0x08, 0x20, 0x83, 0xF0, 0x00, 0xFE,
+  0x08, 0x20, 0xFA, 0x08, 0x20, 0x82, 0x00, 0x00, 0x7A, 0x18, 0x20, 0x82, 0x78, 0x61, 0x8D, 0xD0,
+  0x00, 0x86, 0x18, 0x61, 0xFE, 0x18, 0x61, 0x86, 0x10, 0x00, 0xE9, 0x24, 0x92, 0x5C, 0x01, 0xC2,
+  0x08, 0x20, 0x82, 0x0A, 0x28, 0x9C, 0x00, 0x08, 0x62, 0x92, 0x8C, 0x30, 0xA2, 0x48, 0xA1, 0x00,
+  0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0x00, 0x08, 0x38, 0xEA, 0xC9, 0x83, 0x06, 0x0C,
+  0x18, 0x30, 0x40, 0x00, 0x87, 0x1C, 0x69, 0xA6, 0x59, 0x63, 0x8E, 0x10, 0x00, 0x7A, 0x18, 0x61,
+  0x86, 0x18, 0x61, 0x85, 0xE0, 0x00, 0xFA, 0x18, 0x61, 0xFA, 0x08, 0x20, 0x82, 0x00, 0x00, 0x7A,
+  0x18, 0x61, 0x86, 0x18, 0x65, 0x89, 0xD0, 0x00, 0xFA, 0x18, 0x61, 0xFA, 0x89, 0x22, 0x86, 0x10,
+  0x00, 0x7A, 0x18, 0x20, 0x78, 0x10, 0x41, 0x85, 0xE0, 0x00, 0xFE, 0x20, 0x40, 0x81, 0x02, 0x04,
+  0x08, 0x10, 0x20, 0x00, 0x08, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x5E, 0x00, 0x08, 0x30, 0x60,
+  0xA2, 0x44, 0x88, 0xA1, 0x41, 0x02, 0x00, 0x00, 0x83, 0x06, 0x0C, 0x18, 0x32, 0x64, 0xD5, 0xC7,
+  0x04, 0x00, 0x08, 0x61, 0x49, 0x23, 0x0C, 0x49, 0x28, 0x61, 0x00, 0x08, 0x30, 0x51, 0x22, 0x28,
+  0x20, 0x40, 0x81, 0x02, 0x00, 0x00, 0xFC, 0x10, 0x82, 0x10, 0x84, 0x10, 0x83, 0xF0, 0x00, 0x00,
+  0x00, 0xE0, 0x85, 0xF1, 0x8B, 0xC0, 0x08, 0x42, 0x1E, 0x8C, 0x63, 0x18, 0xF8, 0x00, 0x00, 0x00,
+  0xE8, 0xC2, 0x10, 0x8B, 0x80, 0x00, 0x84, 0x2F, 0x8C, 0x63, 0x18, 0xBC, 0x00, 0x00, 0x00, 0xE8,
+  0xC7, 0xF0, 0x8B, 0x80, 0x03, 0x44, 0xF4, 0x44, 0x44, 0x40, 0x00, 0x00, 0x0F, 0x8C, 0x63, 0x18,
+  0xBC, 0x2E, 0x84, 0x21, 0xE8, 0xC6, 0x31, 0x8C, 0x40, 0x04, 0x06, 0x49, 0x25, 0xC0, 0x10, 0x03,
+  0x11, 0x11, 0x11, 0x96, 0x84, 0x21, 0x19, 0x53, 0x14, 0x94, 0x40, 0x0C, 0x92, 0x49, 0x25, 0xC0,
+  0x00, 0x00, 0x07, 0x69, 0x32, 0x64, 0xC9, 0x93, 0x24, 0x00, 0x00, 0x00, 0x1E, 0x8C, 0x63, 0x18,
+  0xC4, 0x00, 0x00, 0x00, 0xE8, 0xC6, 0x31, 0x8B, 0x80, 0x00, 0x00, 0x1E, 0x8C, 0x63, 0x18, 0xFA,
+  0x10, 0x00, 0x00, 0xF8, 0xC6, 0x31, 0x8B, 0xC2, 0x10, 0x00, 0x16, 0xCC, 0x21, 0x08, 0x40, 0x00,
+  0x00, 0x00, 0xF8, 0x41, 0xC1, 0x0F, 0x80, 0x04, 0x44, 0xF4, 0x44, 0x44, 0x30, 0x00, 0x00, 0x11,
+  0x8C, 0x63, 0x18, 0xBC, 0x00, 0x00, 0x01, 0x18, 0xC5, 0x4A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x41,
+  0x83, 0x26, 0x4C, 0x9A, 0xA8, 0x80, 0x00, 0x00, 0x01, 0x18, 0xA8, 0x8A, 0x8C, 0x40, 0x00, 0x00,
+  0x11, 0x8C, 0x63, 0x18, 0xBC, 0x2E, 0x00, 0x01, 0xF0, 0x88, 0x88, 0x87, 0xC0, 0x06, 0x99, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x7F, 0xFF, 0xFD, 0xF1, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const Glyph FONT_7X12_GLYPHS[] = {
+  {0x0020,     0,  3},  // U+0020
+  {0x0021,    36,  1},  // '!'
+  {0x0022,    48,  3},  // '"'
+  {0x0027,    84,  1},  // U+0027
+  {0x0028,    96,  3},  // '('
+  {0x0029,   132,  3},  // ')'
+  {0x002B,   168,  5},  // '+'
+  {0x002C,   228,  2},  // ','
+  {0x002D,   252,  5},  // '-'
+  {0x002E,   312,  2},  // '.'
+  {0x002F,   336,  5},  // '/'
+  {0x0030,   396,  6},  // '0'
+  {0x0031,   468,  6},  // '1'
+  {0x0032,   540,  6},  // '2'
+  {0x0033,   612,  6},  // '3'
+  {0x0034,   684,  6},  // '4'
+  {0x0035,   756,  6},  // '5'
+  {0x0036,   828,  6},  // '6'
+  {0x0037,   900,  6},  // '7'
+  {0x0038,   972,  6},  // '8'
+  {0x0039,  1044,  6},  // '9'
+  {0x003A,  1116,  2},  // ':'
+  {0x003B,  1140,  2},  // ';'
+  {0x003D,  1164,  5},  // '='
+  {0x003F,  1224,  6},  // '?'
+  {0x0041,  1296,  6},  // 'A'
+  {0x0042,  1368,  6},  // 'B'
+  {0x0043,  1440,  6},  // 'C'
+  {0x0044,  1512,  6},  // 'D'
+  {0x0045,  1584,  6},  // 'E'
+  {0x0046,  1656,  6},  // 'F'
+  {0x0047,  1728,  6},  // 'G'
+  {0x0048,  1800,  6},  // 'H'
+  {0x0049,  1872,  3},  // 'I'
+  {0x004A,  1908,  6},  // 'J'
+  {0x004B,  1980,  6},  // 'K'
+  {0x004C,  2052,  6},  // 'L'
+  {0x004D,  2124,  7},  // 'M'
+  {0x004E,  2208,  6},  // 'N'
+  {0x004F,  2280,  6},  // 'O'
+  {0x0050,  2352,  6},  // 'P'
+  {0x0051,  2424,  6},  // 'Q'
+  {0x0052,  2496,  6},  // 'R'
+  {0x0053,  2568,  6},  // 'S'
+  {0x0054,  2640,  7},  // 'T'
+  {0x0055,  2724,  6},  // 'U'
+  {0x0056,  2796,  7},  // 'V'
+  {0x0057,  2880,  7},  // 'W'
+  {0x0058,  2964,  6},  // 'X'
+  {0x0059,  3036,  7},  // 'Y'
+  {0x005A,  3120,  6},  // 'Z'
+  {0x0061,  3192,  5},  // 'a'
+  {0x0062,  3252,  5},  // 'b'
+  {0x0063,  3312,  5},  // 'c'
+  {0x0064,  3372,  5},  // 'd'
+  {0x0065,  3432,  5},  // 'e'
+  {0x0066,  3492,  4},  // 'f'
+  {0x0067,  3540,  5},  // 'g'
+  {0x0068,  3600,  5},  // 'h'
+  {0x0069,  3660,  3},  // 'i'
+  {0x006A,  3696,  4},  // 'j'
+  {0x006B,  3744,  5},  // 'k'
+  {0x006C,  3804,  3},  // 'l'
+  {0x006D,  3840,  7},  // 'm'
+  {0x006E,  3924,  5},  // 'n'
+  {0x006F,  3984,  5},  // 'o'
+  {0x0070,  4044,  5},  // 'p'
+  {0x0071,  4104,  5},  // 'q'
+  {0x0072,  4164,  5},  // 'r'
+  {0x0073,  4224,  5},  // 's'
+  {0x0074,  4284,  4},  // 't'
+  {0x0075,  4332,  5},  // 'u'
+  {0x0076,  4392,  5},  // 'v'
+  {0x0077,  4452,  7},  // 'w'
+  {0x0078,  4536,  5},  // 'x'
+  {0x0079,  4596,  5},  // 'y'
+  {0x007A,  4656,  5},  // 'z'
+  {0x00B0,  4716,  4},  // U+00B0
+  {0x2665,  4764,  7},  // U+2665
+};
+
+const Font FONT_7X12 = {
+  "7x12", 12, 1, 0x003F, 79,
+  FONT_7X12_GLYPHS, FONT_7X12_BITMAP
+};
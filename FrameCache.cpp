@@ -0,0 +1,131 @@
+/* FrameCache.cpp
+   Frame ring allocation, lookup and eviction
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - No PSRAM: stop calling heap_caps_malloc() on every idle pass
+   V16.5.8-2026-01-13T09:00:00Z - Initial implementation
+*/
+
+#include "FrameCache.h"
+#include "Logger.h"
+#include <esp_heap_caps.h>
+
+FrameCache frameCache;
+
+size_t FrameCache::ringBytes(uint16_t period) {
+    return (size_t)period * MATRIX_LEDS * sizeof(CRGB) + (period + 7) / 8;
+}
+
+FrameCache::Ring* FrameCache::find(const FrameKey& key) {
+    for (auto& ring : rings) {
+        if (ring.frames && ring.name == key.name && ring.period == key.period && ring.params == key.params) {
+            ring.lastUsed = ++useCounter;
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+void FrameCache::release(Ring& ring) {
+    if (!ring.frames) return;
+    heap_caps_free(ring.frames);
+    heap_caps_free(ring.valid);
+    bytes -= ringBytes(ring.period);
+    ring = Ring();
+}
+
+FrameCache::Ring* FrameCache::allocate(const FrameKey& key) {
+    size_t need = ringBytes(key.period);
+    if (noPsram || key.period == 0 || need > FRAME_CACHE_BYTES) return nullptr;
+
+    // Same procedural with other params (seed, theme) is stale now: drop it first
+    for (auto& ring : rings) {
+        if (ring.frames && ring.name == key.name) release(ring);
+    }
+
+    // Evict least recently used rings until there is a free slot within budget
+    while (true) {
+        Ring* empty = nullptr;
+        Ring* oldest = nullptr;
+        for (auto& ring : rings) {
+            if (!ring.frames) {
+                if (!empty) empty = &ring;
+            } else if (!oldest || ring.lastUsed < oldest->lastUsed) {
+                oldest = &ring;
+            }
+        }
+        if (empty && bytes + need <= FRAME_CACHE_BYTES) {
+            CRGB* frames = (CRGB*)heap_caps_malloc((size_t)key.period * MATRIX_LEDS * sizeof(CRGB), MALLOC_CAP_SPIRAM);
+            uint8_t* valid = (uint8_t*)heap_caps_malloc((key.period + 7) / 8, MALLOC_CAP_SPIRAM);
+            if (!frames || !valid) {
+                heap_caps_free(frames);
+                heap_caps_free(valid);
+                Logger::instance().log("[FrameCache] No PSRAM for " + String(need / 1024) + " KB ring - caching off");
+                noPsram = true;
+                return nullptr;
+            }
+            memset(valid, 0, (key.period + 7) / 8);
+            empty->name = key.name;
+            empty->period = key.period;
+            empty->params = key.params;
+            empty->frames = frames;
+            empty->valid = valid;
+            empty->filled = 0;
+            empty->lastUsed = ++useCounter;
+            bytes += need;
+            return empty;
+        }
+        if (!oldest) return nullptr;
+        release(*oldest);
+    }
+}
+
+bool FrameCache::fetch(const FrameKey& key, uint16_t frame, CRGB* dst) {
+    Ring* ring = find(key);
+    if (!ring || frame >= ring->period || !(ring->valid[frame >> 3] & (1 << (frame & 7)))) {
+        misses++;
+        return false;
+    }
+    memcpy(dst, ring->frames + (size_t)frame * MATRIX_LEDS, MATRIX_LEDS * sizeof(CRGB));
+    hits++;
+    return true;
+}
+
+bool FrameCache::store(const FrameKey& key, uint16_t frame, const CRGB* src) {
+    if (frame >= key.period) return false;
+    Ring* ring = find(key);
+    if (!ring) ring = allocate(key);
+    if (!ring) return false;
+
+    uint8_t bit = 1 << (frame & 7);
+    memcpy(ring->frames + (size_t)frame * MATRIX_LEDS, src, MATRIX_LEDS * sizeof(CRGB));
+    if (!(ring->valid[frame >> 3] & bit)) {
+        ring->valid[frame >> 3] |= bit;
+        if (++ring->filled == ring->period) {
+            Logger::instance().log("[FrameCache] " + String(key.name) + ": " + String(ring->period) +
+                                   " frames cached (" + String(ringBytes(ring->period) / 1024) + " KB)");
+        }
+    }
+    return true;
+}
+
+int FrameCache::nextMissing(const FrameKey& key, uint16_t from) {
+    Ring* ring = find(key);
+    if (!ring) ring = allocate(key);
+    if (!ring || ring->filled == ring->period) return -1;
+    for (uint16_t i = 0; i < ring->period; i++) {
+        uint16_t frame = (from + i) % ring->period;
+        if (!(ring->valid[frame >> 3] & (1 << (frame & 7)))) return frame;
+    }
+    return -1;
+}
+
+void FrameCache::invalidateAll() {
+    for (auto& ring : rings) release(ring);
+}
+
+int FrameCache::getRingCount() const {
+    int count = 0;
+    for (const auto& ring : rings) {
+        if (ring.frames) count++;
+    }
+    return count;
+}
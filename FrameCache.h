@@ -0,0 +1,80 @@
+/* FrameCache.h
+   Render-ahead frame rings for periodic, deterministic procedurals
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - A failed PSRAM allocation turns caching off for good
+   V16.5.8-2026-01-13T09:00:00Z - Initial implementation
+
+   A procedural that declares a period (frames until it repeats exactly) and renders
+   frame N as a pure function of N (fixed seed, no live state) can be cached: each
+   frame is one matrix block (MATRIX_LEDS, wiring order), identical for every matrix.
+   The first loop fills the ring - on a miss the frame is rendered and stored, and
+   idle time between frames renders ahead (Animations::renderAhead). Later loops are
+   a memcpy per matrix.
+   Rings live in PSRAM (no PSRAM = no cache; internal RAM is left alone), at most
+   FRAME_CACHE_RINGS of them within FRAME_CACHE_BYTES, least recently used evicted.
+   A ring is keyed by name + period + params (seed, palette generation for palette
+   users), so a parameter or theme change simply misses and replaces the old ring.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Config.h"
+
+struct FrameKey {
+    const char* name;     // Static string from the procedural table
+    uint16_t period;      // Frames per loop
+    uint32_t params;      // Hash of everything else the frames depend on
+};
+
+class FrameCache {
+public:
+    FrameCache() {}
+
+    // Copy a cached frame into dst (MATRIX_LEDS); false on a miss
+    bool fetch(const FrameKey& key, uint16_t frame, CRGB* dst);
+
+    // Keep a rendered frame; false if no ring could be allocated for the key
+    bool store(const FrameKey& key, uint16_t frame, const CRGB* src);
+
+    // First frame at or after `from` (wrapping) that is not cached yet; -1 if the ring
+    // is complete or cannot exist
+    int nextMissing(const FrameKey& key, uint16_t from);
+
+    void invalidateAll();
+
+    // Stats (since boot / last resetStats)
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getAheadFrames() const { return aheadFrames; }
+    void countAhead() { aheadFrames++; }
+    float getHitRate() const { return (hits + misses) ? (float)hits / (hits + misses) : 0.0f; }
+    size_t getBytes() const { return bytes; }
+    int getRingCount() const;
+    void resetStats() { hits = misses = aheadFrames = 0; }
+
+private:
+    struct Ring {
+        const char* name = nullptr;
+        uint16_t period = 0;
+        uint32_t params = 0;
+        CRGB* frames = nullptr;     // period * MATRIX_LEDS
+        uint8_t* valid = nullptr;   // Bit per frame
+        uint16_t filled = 0;
+        uint32_t lastUsed = 0;
+    };
+    Ring rings[FRAME_CACHE_RINGS];
+    uint32_t useCounter = 0;
+    size_t bytes = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t aheadFrames = 0;
+    bool noPsram = false;       // An allocation failed: no more attempts until reboot
+
+    Ring* find(const FrameKey& key);
+    Ring* allocate(const FrameKey& key);
+    void release(Ring& ring);
+    static size_t ringBytes(uint16_t period);
+};
+
+extern FrameCache frameCache;
@@ -0,0 +1,99 @@
+/* HeatField.cpp
+   Heat-diffusion simulation implementation
+   VERSION: V16.5.1-2026-01-12T12:00:00Z - Initial implementation
+*/
+
+#include "HeatField.h"
+#include <stdlib.h>
+#include <string.h>
+
+namespace HeatPresets {
+    //                          cooling sparking rows  min  max  drift
+    const HeatParams FIRE   = {   55,    120,     2,  160, 255,  255 };
+    const HeatParams EMBERS = {   18,     24,     4,  120, 230,   90 };
+    const HeatParams SMOKE  = {   28,     80,     3,   40, 100,  200 };
+}
+
+HeatField::HeatField() : heat(nullptr), cols(0), rows(0), rng(1) {}
+
+HeatField::~HeatField() {
+    free(heat);
+}
+
+bool HeatField::begin(int newCols, int newRows, uint32_t seed) {
+    if (!heat || newCols != cols || newRows != rows) {
+        free(heat);
+        heat = (uint8_t*)malloc((size_t)newCols * newRows);
+        if (!heat) {
+            cols = rows = 0;
+            return false;
+        }
+        cols = newCols;
+        rows = newRows;
+    }
+    reset(seed);
+    return true;
+}
+
+void HeatField::reset(uint32_t seed) {
+    rng = seed ? seed : 0x5EED;  // xorshift must not start at zero
+    if (heat) memset(heat, 0, (size_t)cols * rows);
+}
+
+uint32_t HeatField::next() {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+uint8_t HeatField::random8(uint8_t lo, uint8_t hi) {
+    // Range scaling with a multiply instead of a modulo
+    return lo + (uint8_t)(((next() & 0xFF) * (uint32_t)(hi - lo + 1)) >> 8);
+}
+
+void HeatField::step(const HeatParams& p) {
+    if (!heat) return;
+
+    // 1. Cool every cell a little; taller fields cool more slowly per row
+    uint8_t maxCool = (uint8_t)((p.cooling * 10) / rows + 2);
+    uint8_t* cell = heat;
+    for (int i = cols * rows; i > 0; i--, cell++) {
+        uint8_t c = random8(0, maxCool);
+        *cell = (*cell > c) ? *cell - c : 0;
+    }
+
+    // 2. Convect: each cell moves toward a weighted average of the two cells below
+    //    it plus its lower neighbours. Walking top-down, the rows read below are
+    //    still last step's values, so the update is in place.
+    for (int y = 0; y < rows - 2; y++) {
+        uint8_t* row = heat + y * cols;
+        const uint8_t* below = row + cols;
+        const uint8_t* below2 = below + cols;
+        for (int x = 0; x < cols; x++) {
+            int left = below[x > 0 ? x - 1 : x];
+            int right = below[x < cols - 1 ? x + 1 : x];
+            int target = (below[x] * 2 + below2[x] + ((left + right) >> 1)) >> 2;
+            row[x] = (uint8_t)(row[x] + (((target - row[x]) * p.drift) >> 8));
+        }
+    }
+
+    // 3. Spark new heat near the bottom
+    int sparkRows = p.sparkRows < rows ? p.sparkRows : rows;
+    for (int x = 0; x < cols; x++) {
+        if ((next() & 0xFF) < p.sparking) {
+            int y = rows - 1 - (int)((next() & 0xFF) * sparkRows >> 8);
+            uint8_t* h = heat + y * cols + x;
+            int v = *h + random8(p.sparkMin, p.sparkMax);
+            *h = (uint8_t)(v > 255 ? 255 : v);
+        }
+    }
+}
+
+uint32_t HeatField::checksum() const {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < cols * rows; i++) {
+        hash = (hash ^ heat[i]) * 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,59 @@
+/* HeatField.h
+   Heat-diffusion simulation for fire, embers and smoke effects
+   VERSION: V16.5.1-2026-01-12T12:00:00Z - Initial implementation
+
+   One byte of heat per cell, stored as contiguous rows (row 0 = top) so every
+   pass walks memory linearly. Each step cools every cell, convects heat upward
+   with a little sideways spread, then sparks new heat into the bottom rows.
+   Integer-only with its own PRNG: a given seed and preset produce the same
+   frames on the ESP32 and on a Linux host (see tools/heat/heat_golden.cpp).
+   No Arduino or FastLED dependencies.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// V16.5.1-2026-01-12T12:00:00Z - Simulation tuning per effect
+struct HeatParams {
+    uint8_t cooling;     // Max heat removed per cell per step, scaled by 1/rows
+    uint8_t sparking;    // Chance (0-255) per column per step of a new spark
+    uint8_t sparkRows;   // Sparks land in this many bottom rows
+    uint8_t sparkMin;    // Spark heat range
+    uint8_t sparkMax;
+    uint8_t drift;       // 255 = full convection each step, lower = heat lingers (embers/smoke)
+};
+
+namespace HeatPresets {
+    extern const HeatParams FIRE;
+    extern const HeatParams EMBERS;
+    extern const HeatParams SMOKE;
+}
+
+class HeatField {
+public:
+    HeatField();
+    ~HeatField();
+
+    // Allocate cols x rows cells (zeroed); false if out of memory
+    bool begin(int cols, int rows, uint32_t seed);
+    void reset(uint32_t seed);
+    void step(const HeatParams& params);
+
+    const uint8_t* data() const { return heat; }
+    int getCols() const { return cols; }
+    int getRows() const { return rows; }
+
+    // FNV-1a of the heat buffer, for golden comparisons
+    uint32_t checksum() const;
+
+private:
+    uint8_t* heat;
+    int cols;
+    int rows;
+    uint32_t rng;
+
+    uint32_t next();                       // xorshift32
+    uint8_t random8(uint8_t lo, uint8_t hi);
+};
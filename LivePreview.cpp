@@ -0,0 +1,190 @@
+/* LivePreview.cpp
+   Preview socket, per-client delta state and back-pressure
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scope for preview frames
+   V16.6.3-2026-01-13T21:00:00Z - Initial implementation
+*/
+
+#include "LivePreview.h"
+#include "PreviewEncoder.h"
+#include "MatrixDisplay.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <Preferences.h>
+
+static_assert(PREVIEW_PIXELS < 0x8000, "Preview run counts are 15 bits");
+
+LivePreview livePreview;
+
+void LivePreview::begin(AsyncWebServer& server, MatrixDisplay* disp) {
+    display = disp;
+
+    Preferences prefs;
+    prefs.begin("matrixshow", true);
+    fps = constrain(prefs.getUChar("previewFps", PREVIEW_FPS), 1, PREVIEW_FPS_MAX);
+    prefs.end();
+
+    ws.onEvent([this](AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type,
+                      void* arg, uint8_t* data, size_t len) {
+        onEvent(client, type, arg, data, len);
+    });
+    server.addHandler(&ws);
+}
+
+void LivePreview::onEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
+    // TCP task: record only, the slots and buffers belong to loop()
+    if (type == WS_EVT_CONNECT) {
+        portENTER_CRITICAL(&lock);
+        bool room = joinedCount < PREVIEW_MAX_CLIENTS;
+        if (room) joined[joinedCount++] = client->id();
+        portEXIT_CRITICAL(&lock);
+        if (!room) client->close();
+    } else if (type == WS_EVT_DISCONNECT) {
+        portENTER_CRITICAL(&lock);
+        if (leftCount < PREVIEW_MAX_CLIENTS * 2) left[leftCount++] = client->id();
+        portEXIT_CRITICAL(&lock);
+    } else if (type == WS_EVT_DATA) {
+        AwsFrameInfo* info = (AwsFrameInfo*)arg;
+        if (info->final && info->index == 0 && info->opcode == WS_TEXT && len > 4 && len < 8 &&
+            memcmp(data, "fps=", 4) == 0) {
+            char digits[4] = {};
+            memcpy(digits, data + 4, len - 4);
+            requestedFps = atoi(digits);
+        }
+    }
+}
+
+void LivePreview::release(Watcher& w) {
+    free(w.base);
+    w = Watcher();
+    watching--;
+}
+
+void LivePreview::applyEvents() {
+    uint32_t join[PREVIEW_MAX_CLIENTS];
+    uint32_t leave[PREVIEW_MAX_CLIENTS * 2];
+    portENTER_CRITICAL(&lock);
+    int joins = joinedCount;
+    int leaves = leftCount;
+    memcpy(join, joined, joins * sizeof(uint32_t));
+    memcpy(leave, left, leaves * sizeof(uint32_t));
+    joinedCount = leftCount = 0;
+    portEXIT_CRITICAL(&lock);
+
+    for (int i = 0; i < leaves; i++) {
+        for (auto& w : watchers) {
+            if (w.id == leave[i]) release(w);
+        }
+    }
+
+    for (int i = 0; i < joins; i++) {
+        Watcher* slot = nullptr;
+        for (auto& w : watchers) {
+            if (!w.id) { slot = &w; break; }
+        }
+        AsyncWebSocketClient* client = ws.client(join[i]);
+        if (!client) continue;  // Already gone
+        uint8_t* base = slot ? (uint8_t*)calloc(PREVIEW_PIXELS, 3) : nullptr;
+        if (!base) {
+            client->close();
+            continue;
+        }
+        slot->id = join[i];
+        slot->base = base;
+        slot->key = true;
+        watching++;
+    }
+
+    if (watching > 0 && !frame) {
+        frame = (uint8_t*)malloc(PREVIEW_PIXELS * 3);
+        packet = (uint8_t*)malloc(PREVIEW_MAX_MESSAGE(PREVIEW_PIXELS));
+        if (!frame || !packet) {
+            Logger::instance().log("[Preview] No memory for preview buffers");
+            for (auto& w : watchers) {
+                if (w.id) {
+                    if (AsyncWebSocketClient* client = ws.client(w.id)) client->close();
+                    release(w);
+                }
+            }
+        }
+    }
+    if (watching == 0 && frame) {
+        free(frame);
+        free(packet);
+        frame = packet = nullptr;
+    }
+}
+
+void LivePreview::capture() {
+    // Matrix 1 (left window) first, then Matrix 0
+    const CRGB* leds = display->getLeds();
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        const uint16_t* table = display->getIndexTable(m);
+        if (!table) continue;
+        int x0 = (MATRIX_COUNT - 1 - m) * COLS;
+        for (int y = 0; y < ROWS; y++) {
+            uint8_t* row = frame + ((size_t)y * PREVIEW_WIDTH + x0) * 3;
+            for (int x = 0; x < COLS; x++) {
+                const CRGB& c = leds[table[y * COLS + x]];
+                row[x * 3] = c.r;
+                row[x * 3 + 1] = c.g;
+                row[x * 3 + 2] = c.b;
+            }
+        }
+    }
+}
+
+void LivePreview::update() {
+    if (!display || (watching == 0 && joinedCount == 0 && leftCount == 0)) return;
+
+    if (requestedFps) {
+        setFps(requestedFps);
+        requestedFps = 0;
+    }
+
+    unsigned long now = millis();
+    if (now - lastFrame < 1000UL / fps) return;
+    lastFrame = now;
+    PROFILE_SCOPE("LivePreview frame");  // V16.7.2-2026-01-14T15:00:00Z
+
+    applyEvents();
+    ws.cleanupClients(PREVIEW_MAX_CLIENTS);
+    if (watching == 0 || !frame) return;
+
+    capture();
+    sequence++;
+    for (auto& w : watchers) {
+        if (!w.id) continue;
+        AsyncWebSocketClient* client = ws.client(w.id);
+        if (!client) {
+            release(w);
+            continue;
+        }
+        // Back-pressure: anything still queued means this client is behind - skip it
+        if (client->queueLen() > 0 || !client->canSend()) {
+            framesDropped++;
+            continue;
+        }
+        size_t len = previewEncode(frame, w.base, PREVIEW_WIDTH, PREVIEW_HEIGHT, w.key, sequence, packet);
+        w.key = false;
+        if (len == 0) continue;  // Nothing changed for this client
+        client->binary(packet, len);
+        framesSent++;
+        bytesSent += len;
+    }
+}
+
+bool LivePreview::setFps(int value) {
+    if (value < 1 || value > PREVIEW_FPS_MAX) return false;
+    if (value == fps) return true;
+    fps = value;
+    Preferences prefs;
+    prefs.begin("matrixshow", false);
+    prefs.putUChar("previewFps", fps);
+    prefs.end();
+    Logger::instance().log("[Preview] Rate: " + String(fps) + " fps");
+    return true;
+}
+
+int LivePreview::getClientCount() const {
+    return watching;
+}
@@ -0,0 +1,81 @@
+/* LivePreview.h
+   Live framebuffer preview over WebSocket (/ws/preview)
+   VERSION: V16.6.3-2026-01-13T21:00:00Z - Initial implementation
+
+   The logical frame (leds[] after show(), matrices side by side as they hang: Matrix 1
+   is the left window, Matrix 0 the right) is sampled at the preview rate and sent as a
+   binary message per client: a key frame on connect, then only the pixels that changed
+   since what that client last received, run-length coded (PreviewEncoder.h).
+   Each client keeps its own base frame, so a client that is still sending is simply
+   skipped - the frame is dropped for it, not queued - and its next message is a delta
+   against what it really has. With no client connected update() returns at once and no
+   buffers exist.
+   Rate: PREVIEW_FPS (Preferences "previewFps"), set by /api/preview?fps=N or a text
+   message "fps=N" on the socket.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include "Config.h"
+
+class MatrixDisplay;
+
+#define PREVIEW_WIDTH (MATRIX_COUNT * COLS)
+#define PREVIEW_HEIGHT ROWS
+#define PREVIEW_PIXELS (PREVIEW_WIDTH * PREVIEW_HEIGHT)
+
+class LivePreview {
+public:
+    LivePreview() {}
+
+    void begin(AsyncWebServer& server, MatrixDisplay* disp);
+    void update();  // Call from loop(), after rendering
+
+    bool setFps(int fps);  // 1..PREVIEW_FPS_MAX; saved
+    uint8_t getFps() const { return fps; }
+
+    // Stats (since boot)
+    int getClientCount() const;
+    uint32_t getFramesSent() const { return framesSent; }
+    uint32_t getFramesDropped() const { return framesDropped; }
+    uint32_t getBytesSent() const { return bytesSent; }
+
+private:
+    AsyncWebSocket ws{"/ws/preview"};
+    MatrixDisplay* display = nullptr;
+    uint8_t fps = PREVIEW_FPS;
+    unsigned long lastFrame = 0;
+    uint16_t sequence = 0;
+
+    struct Watcher {
+        uint32_t id = 0;            // 0 = free slot
+        uint8_t* base = nullptr;    // What this client shows (PREVIEW_PIXELS RGB)
+        bool key = true;
+    };
+    Watcher watchers[PREVIEW_MAX_CLIENTS];
+    int watching = 0;
+    uint8_t* frame = nullptr;       // Current logical frame
+    uint8_t* packet = nullptr;      // Encode buffer
+
+    // Socket events arrive on the TCP task; loop() applies them
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t joined[PREVIEW_MAX_CLIENTS] = {};
+    uint32_t left[PREVIEW_MAX_CLIENTS * 2] = {};
+    volatile int joinedCount = 0;
+    volatile int leftCount = 0;
+    volatile int requestedFps = 0;
+
+    uint32_t framesSent = 0;
+    uint32_t framesDropped = 0;
+    uint32_t bytesSent = 0;
+
+    void onEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len);
+    void applyEvents();
+    void release(Watcher& w);
+    void capture();
+};
+
+extern LivePreview livePreview;
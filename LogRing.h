@@ -0,0 +1,118 @@
+/* LogRing.h
+   Lock-free ring of fixed-size log entries
+   VERSION: V16.7.0-2026-01-14T09:00:00Z - Initial implementation
+
+   Writers on any task claim a sequence number with one atomic add and fill the slot it
+   maps to; nothing blocks and nothing is allocated. Each slot is a seqlock: its sequence
+   is 0 while being written and the entry's number once complete, so a reader that
+   copies a slot checks the number before and after and knows whether it got that entry,
+   a later one (it was overwritten: SLOTS newer entries exist) or a half-written one.
+   Readers keep their own cursor (last sequence seen); a cursor that falls more than
+   SLOTS behind skips ahead, and the jump in sequence numbers says how many were lost.
+   Plain C++ (no Arduino): tools/log_bench.cpp runs it on the host.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+template <size_t SLOTS, size_t TEXT>
+class LogRing {
+    static_assert((SLOTS & (SLOTS - 1)) == 0, "SLOTS must be a power of two");
+
+public:
+    struct Entry {
+        uint32_t seq;
+        uint32_t timeMs;
+        uint8_t level;
+        char text[TEXT];
+    };
+
+    // printf into the next slot (truncated to TEXT - 1); returns its sequence
+    uint32_t write(uint8_t level, uint32_t timeMs, const char* fmt, va_list args) {
+        uint32_t seq;
+        Slot& slot = claim(seq, level, timeMs);
+        vsnprintf(slot.text, TEXT, fmt, args);
+        slot.seq.store(seq, std::memory_order_release);
+        return seq;
+    }
+
+    uint32_t writeText(uint8_t level, uint32_t timeMs, const char* text) {
+        uint32_t seq;
+        Slot& slot = claim(seq, level, timeMs);
+        size_t n = strnlen(text, TEXT - 1);
+        memcpy(slot.text, text, n);
+        slot.text[n] = '\0';
+        slot.seq.store(seq, std::memory_order_release);
+        return seq;
+    }
+
+    // Oldest complete entry after `after` into out; false if there is none yet (or the
+    // next one is still being written - it is not skipped)
+    bool read(uint32_t after, Entry& out) const {
+        uint32_t want = after + 1;
+        while (true) {
+            uint32_t end = next.load(std::memory_order_acquire);
+            uint32_t low = floor.load(std::memory_order_acquire);
+            if (end > SLOTS && end - SLOTS > low) low = end - SLOTS;  // Older ones are overwritten
+            if (want < low) want = low;
+            if (want >= end) return false;
+
+            const Slot& slot = slots[want & (SLOTS - 1)];
+            uint32_t before = slot.seq.load(std::memory_order_acquire);
+            if (before != want) {
+                if (before == 0 || before < want) return false;  // Still being written
+                want++;                                            // Overwritten meanwhile
+                continue;
+            }
+            out.timeMs = slot.timeMs;
+            out.level = slot.level;
+            memcpy(out.text, slot.text, TEXT);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != want) {
+                want++;  // Overwritten while copying
+                continue;
+            }
+            out.text[TEXT - 1] = '\0';
+            out.seq = want;
+            return true;
+        }
+    }
+
+    uint32_t last() const { return next.load(std::memory_order_acquire) - 1; }
+
+    // Readers skip everything written so far; sequence numbers continue
+    void clear() { floor.store(next.load(std::memory_order_acquire), std::memory_order_release); }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> seq{0};
+        uint32_t timeMs = 0;
+        uint8_t level = 0;
+        char text[TEXT] = {};
+    };
+    Slot slots[SLOTS];
+    std::atomic<uint32_t> next{1};
+    std::atomic<uint32_t> floor{1};
+
+    Slot& claim(uint32_t& seq, uint8_t level, uint32_t timeMs) {
+        seq = next.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots[seq & (SLOTS - 1)];
+        slot.seq.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.level = level;
+        slot.timeMs = timeMs;
+        return slot;
+    }
+};
@@ -1,2 +1,68 @@
+/* Logger.cpp
+   Ring reads and the serial drain task
+   VERSION: V16.7.0-2026-01-14T09:00:00Z - Serial output from a background task; printf-style entries
+   V16.6.4-2026-01-14T00:00:00Z - Cursor reads (readAfter)
+*/
+
 #include "Logger.h"
-// Nothing else needed; all methods are inline or template
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+void Logger::begin() {
+    if (started) return;
+    started = true;
+    xTaskCreatePinnedToCore(drainTask, "logDrain", 3072, this, 1, nullptr, 0);
+}
+
+void Logger::logf(const char* fmt, ...) {
+    if (LOG_LEVEL < LOG_LEVEL_INFO) return;
+    va_list args;
+    va_start(args, fmt);
+    buffer.write(LOG_LEVEL_INFO, millis(), fmt, args);
+    va_end(args);
+}
+
+void Logger::logAt(uint8_t level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    buffer.write(level, millis(), fmt, args);
+    va_end(args);
+}
+
+void Logger::drainTask(void* arg) {
+    Logger* self = (Logger*)arg;
+    for (;;) {
+        self->drain();
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_MS));
+    }
+}
+
+void Logger::drain() {
+    LogEntry entry;
+    while (buffer.read(serialCursor, entry)) {
+        if (entry.seq > serialCursor + 1 && serialCursor != 0) {
+            Serial.printf("... %lu log lines lost\n", (unsigned long)(entry.seq - serialCursor - 1));
+        }
+        Serial.printf("[%6lu.%03lu] %c %s\n", (unsigned long)(entry.timeMs / 1000),
+                      (unsigned long)(entry.timeMs % 1000), levelLetter(entry.level), entry.text);
+        serialCursor = entry.seq;
+    }
+}
+
+std::vector<String> Logger::getRecentLogs() const {
+    std::vector<String> lines;
+    LogEntry entry;
+    uint32_t cursor = 0;
+    while (buffer.read(cursor, entry)) {
+        lines.push_back(entry.text);
+        cursor = entry.seq;
+    }
+    return lines;
+}
+
+uint32_t Logger::readAfter(uint32_t seq, String& line) const {
+    LogEntry entry;
+    if (!buffer.read(seq, entry)) return 0;
+    line = entry.text;
+    return entry.seq;
+}
@@ -1,12 +1,36 @@
 /* Logger.h
    Logging system with circular buffer storage
-   VERSION: V16.1.3-2026-01-09T05:20:00Z
+   VERSION: V16.7.0-2026-01-14T09:00:00Z - Lock-free fixed-slot ring (LogRing.h), levels, serial drained by a task
+   V16.6.4-2026-01-14T00:00:00Z - Sequence numbers and cursor reads (readAfter); buffer locked
+   V16.1.3-2026-01-09T05:20:00Z
+
+   Every entry gets a sequence number (1, 2, ...; never reused, also across clear()).
+   A reader keeps the last sequence it has seen and asks for the entries after it, so
+   it never copies the whole buffer and can tell when entries it missed have already
+   been dropped.
+   V16.7.0-2026-01-14T09:00:00Z - Entries are LOG_SLOTS preallocated slots of
+   LOG_SLOT_TEXT bytes with a timestamp and level; any task may log without a lock and
+   nothing is allocated. log() only stores: a low-priority task started by begin() prints
+   new entries to Serial every LOG_DRAIN_MS. Lines longer than a slot are truncated.
+   LOG_E/LOG_W/LOG_I/LOG_D take printf arguments, format straight into the slot and
+   compile to nothing below LOG_LEVEL (Config.h), arguments included - prefer them to
+   log(String), whose message is built by the caller either way.
 */
 
 #pragma once
 #include <Arduino.h>
+#include "Config.h"
+#include "LogRing.h"
 #include <vector>
 
+#define LOG_E(...) do { if (LOG_LEVEL >= LOG_LEVEL_ERROR) Logger::instance().logAt(LOG_LEVEL_ERROR, __VA_ARGS__); } while (0)
+#define LOG_W(...) do { if (LOG_LEVEL >= LOG_LEVEL_WARN) Logger::instance().logAt(LOG_LEVEL_WARN, __VA_ARGS__); } while (0)
+#define LOG_I(...) do { if (LOG_LEVEL >= LOG_LEVEL_INFO) Logger::instance().logAt(LOG_LEVEL_INFO, __VA_ARGS__); } while (0)
+#define LOG_D(...) do { if (LOG_LEVEL >= LOG_LEVEL_DEBUG) Logger::instance().logAt(LOG_LEVEL_DEBUG, __VA_ARGS__); } while (0)
+
+typedef LogRing<LOG_SLOTS, LOG_SLOT_TEXT> LogBuffer;
+typedef LogBuffer::Entry LogEntry;
+
 class Logger {
 public:
     static Logger& instance() {
@@ -14,29 +38,32 @@ public:
         return _instance;
     }
 
+    // V16.7.0-2026-01-14T09:00:00Z - Start the serial drain; entries logged before are kept
+    void begin();
+
+    // Info level
     void log(const String& message) {
-        Serial.println(message);
-        
-        // Store in circular buffer
-        if (logBuffer.size() >= maxLogs) {
-            logBuffer.erase(logBuffer.begin());
-        }
-        logBuffer.push_back(message);
+        if (LOG_LEVEL >= LOG_LEVEL_INFO) buffer.writeText(LOG_LEVEL_INFO, millis(), message.c_str());
     }
 
-    template<typename... Args>
-    void logf(const char* fmt, Args... args) {
-        char buf[256];
-        snprintf(buf, sizeof(buf), fmt, args...);
-        log(String(buf));
-    }
+    void logf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+    void logAt(uint8_t level, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
     
-    std::vector<String> getRecentLogs() const {
-        return logBuffer;
-    }
+    std::vector<String> getRecentLogs() const;
+    
+    // V16.6.4-2026-01-14T00:00:00Z - Sequence of the newest entry (0 = nothing logged yet)
+    uint32_t getLastSequence() const { return buffer.last(); }
+
+    // V16.6.4-2026-01-14T00:00:00Z - Oldest entry after `seq` into line; returns its
+    // sequence, 0 if there is none. More than one past seq means entries were dropped.
+    uint32_t readAfter(uint32_t seq, String& line) const;
+    // V16.7.0-2026-01-14T09:00:00Z - Same with time and level; false if there is none
+    bool readAfter(uint32_t seq, LogEntry& entry) const { return buffer.read(seq, entry); }
+
+    static char levelLetter(uint8_t level) { return "-EWID"[level <= LOG_LEVEL_DEBUG ? level : 0]; }
     
     void clear() {
-        logBuffer.clear();
+        buffer.clear();
         log("[Logger] Log buffer cleared");
     }
 
@@ -46,6 +73,10 @@ private:
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
     
-    std::vector<String> logBuffer;
-    const size_t maxLogs = 100;  // Keep last 100 log entries
+    LogBuffer buffer;
+    uint32_t serialCursor = 0;  // Drain task only
+    bool started = false;
+
+    static void drainTask(void* arg);
+    void drain();
 };
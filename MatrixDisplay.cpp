@@ -1,30 +1,61 @@
 /* MatrixDisplay.cpp
    Implementation of display management
-   VERSION: V15.2.3-2026-01-04T15:00:00Z - Added matrix dimension getters
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scopes in show() and present()
+   V16.7.1-2026-01-14T12:00:00Z - Brightness changes traced (TraceLog)
+   V16.6.6-2026-01-14T06:00:00Z - Render/show timing and frames per output (Metrics)
+   V16.5.6-2026-01-13T03:00:00Z - present() via cached resampling maps
    
+   V16.5.5-2026-01-13T00:00:00Z - Mega Tree output on PIN_MEGATREE
+   V16.5.4-2026-01-12T21:00:00Z - Per-frame power estimate and limiting
+   V16.5.4-2026-01-12T21:00:00Z - Over-budget frames are re-rendered at the limiter's scale
+                                  before FastLED.show()
+   V16.5.3-2026-01-12T18:00:00Z - FastLED brightness/correction/dither replaced by ColorPipeline;
+                                  gamma and white point per output persisted in NVS
+   V16.5.2-2026-01-12T15:00:00Z - PostFx applied to the output only; leds[] restored afterwards
+   V16.5.0-2026-01-12T09:00:00Z - getIndexTable() for effect kernels; dimension getters use MATRIXn_*
+   V16.4.3-2026-01-11T17:00:00Z - Index buffer expanded through the palette in show()
    V15.2.3-2026-01-04T15:00:00Z - Added getMatrixRows/Cols for per-matrix sizing
    v2.1 - Added drawCircle implementation
    FIXED: Row-major serpentine wiring (bottom-left start, horizontal rows)
 */
 
 #include "MatrixDisplay.h"
+#include "Metrics.h"
+#include "TraceLog.h"
+#include "Profiler.h"
 #include <Preferences.h>
 
 MatrixDisplay::MatrixDisplay() {}
 
 void MatrixDisplay::begin() {
-  FastLED.addLeds<LED_TYPE, PIN_LEFT, COLOR_ORDER>(leds, 0, MATRIX_LEDS).setCorrection(TypicalLEDStrip);
-  FastLED.addLeds<LED_TYPE, PIN_RIGHT, COLOR_ORDER>(leds, MATRIX_LEDS, MATRIX_LEDS).setCorrection(TypicalLEDStrip);
+  // V16.5.3-2026-01-12T18:00:00Z - FastLED sends the corrected out[] buffer, unscaled
+  FastLED.addLeds<LED_TYPE, PIN_LEFT, COLOR_ORDER>(out, 0, MATRIX_LEDS);
+  FastLED.addLeds<LED_TYPE, PIN_RIGHT, COLOR_ORDER>(out, MATRIX_LEDS, MATRIX_LEDS);
+#if ENABLE_MEGATREE
+  fill_solid(treeOut, MEGATREE_LEDS, CRGB::Black);
+  FastLED.addLeds<LED_TYPE, PIN_MEGATREE, COLOR_ORDER>(treeOut, MEGATREE_LEDS);
+#endif
 // V16.1.3-2026-01-09T05:25:00Z - Load saved brightness from NVS
    Preferences prefs;
    prefs.begin("matrixshow", true);
    uint8_t savedBrightness = prefs.getUChar("brightness", DEFAULT_BRIGHTNESS);
+   for (int o = 0; o < OUTPUT_COUNT; o++) {
+     const OutputColor& def = color.getOutput(o);
+     String key = String(o);
+     float gamma = prefs.getFloat(("gamma" + key).c_str(), def.gamma);
+     uint32_t white = prefs.getUInt(("white" + key).c_str(),
+                                     ((uint32_t)def.white.r << 16) | ((uint32_t)def.white.g << 8) | def.white.b);
+     color.setOutput(o, gamma, CRGB(white));
+   }
+   color.setDitherBelow(prefs.getUChar("dither", DITHER_BELOW_BRIGHTNESS));
    prefs.end();
-   FastLED.setBrightness(savedBrightness);
+   color.setBrightness(savedBrightness);
    Serial.printf("Brightness restored: %d\n", savedBrightness);
+  FastLED.setBrightness(255);
   FastLED.setMaxRefreshRate(30);
   FastLED.setDither(false);
   fill_solid(leds, TOTAL_LEDS, CRGB::Black);
+  fill_solid(out, TOTAL_LEDS, CRGB::Black);
   FastLED.show();
   
   Serial.println("FastLED initialized - Row-major serpentine");
@@ -33,20 +64,98 @@ void MatrixDisplay::begin() {
 }
 
 void MatrixDisplay::show() {
-  FastLED.show();
+  PROFILE_SCOPE("MatrixDisplay::show");  // V16.7.2-2026-01-14T15:00:00Z
+  // V16.4.3-2026-01-11T17:00:00Z - Single LUT pass from indices to CRGB
+  if (indexed && palette) {
+    PROFILE_SCOPE("palette LUT");
+    const uint8_t* src = indexBuf;
+    for (int i = 0; i < TOTAL_LEDS; i++) {
+      leds[i] = palette[src[i]];
+    }
+  }
+  // V16.5.2-2026-01-12T15:00:00Z - Process, output, then put the content frame back
+  bool processed = postFx.apply(*this, leds);
+  // V16.5.3-2026-01-12T18:00:00Z - One LUT pass per output into the FastLED buffer
+  // V16.5.4-2026-01-12T21:00:00Z - Same pass feeds the power estimate; redo if over budget
+  color.beginFrame();
+  ChannelSums sums[OUTPUT_COUNT];
+  renderOutputs(sums);
+  if (power.update(sums)) {
+    renderOutputs(sums);
+    power.measure(sums);
+  }
+  metrics.beginShow();  // V16.6.6-2026-01-14T06:00:00Z
+  {
+    PROFILE_SCOPE("FastLED.show");
+    FastLED.show();
+  }
+#if ENABLE_MEGATREE
+  metrics.endShow(treeSource != nullptr);
+#else
+  metrics.endShow(false);
+#endif
+  if (processed) {
+    postFx.restore(*this, leds);
+  }
+}
+
+void MatrixDisplay::renderOutputs(ChannelSums* sums) {
+  PROFILE_SCOPE("color + power pass");
+  color.apply(0, leds, out, MATRIX_LEDS, power.getScale(0), sums[0]);
+  color.apply(1, leds + MATRIX_LEDS, out + MATRIX_LEDS, MATRIX_LEDS, power.getScale(1), sums[1]);
+#if ENABLE_MEGATREE
+  if (treeSource) {
+    color.apply(2, treeSource, treeOut, MEGATREE_LEDS, power.getScale(2), sums[2]);
+  } else {
+    sums[2] = {0, 0, 0, MEGATREE_LEDS};
+  }
+#endif
 }
 
 void MatrixDisplay::clear() {
+  if (indexed) {
+    memset(indexBuf, 0, TOTAL_LEDS);
+  }
   fill_solid(leds, TOTAL_LEDS, CRGB::Black);
 }
 
 void MatrixDisplay::clearMatrix(int matrix) {
   int base = (matrix == 0) ? 0 : MATRIX_LEDS;
+  if (indexed) {
+    memset(indexBuf + base, 0, MATRIX_LEDS);
+  }
   for (int i = 0; i < MATRIX_LEDS; i++) {
     leds[base + i] = CRGB::Black;
   }
 }
 
+// V16.4.3-2026-01-11T17:00:00Z - Enter/leave palette-indexed mode
+void MatrixDisplay::setIndexedMode(bool enabled) {
+  if (enabled && !indexBuf) {
+    indexBuf = (uint8_t*)malloc(TOTAL_LEDS);
+    if (!indexBuf) {
+      Serial.println("Indexed mode unavailable - out of memory");
+      return;
+    }
+  }
+  if (enabled && !indexed) {
+    memset(indexBuf, 0, TOTAL_LEDS);  // Index 0 is black in every palette
+  }
+  indexed = enabled;
+}
+
+void MatrixDisplay::setPixelIndex(int matrix, int x, int y, uint8_t index) {
+  int idx = getIndex(matrix, x, y);
+  if (indexed && idx >= 0 && idx < TOTAL_LEDS) {
+    indexBuf[idx] = index;
+  }
+}
+
+uint8_t MatrixDisplay::getPixelIndex(int matrix, int x, int y) {
+  int idx = getIndex(matrix, x, y);
+  return (indexed && idx >= 0 && idx < TOTAL_LEDS) ? indexBuf[idx] : 0;
+}
+
 void MatrixDisplay::fadeAll(uint8_t amount) {
   for (int i = 0; i < TOTAL_LEDS; i++) {
     leds[i].nscale8(amount);
@@ -97,26 +206,70 @@ CRGB MatrixDisplay::getPixel(int matrix, int x, int y) {
 }
 
 void MatrixDisplay::setBrightness(uint8_t brightness) {
-  FastLED.setBrightness(brightness);
+  color.setBrightness(brightness);  // V16.5.3-2026-01-12T18:00:00Z - Tables rebuild on next show()
+  traceLog.event(TRACE_BRIGHTNESS, brightness);  // V16.7.1-2026-01-14T12:00:00Z
+}
+
+// V16.5.3-2026-01-12T18:00:00Z - Persist per-output gamma/white point and the dither threshold
+void MatrixDisplay::saveColorSettings() {
+  Preferences prefs;
+  prefs.begin("matrixshow", false);
+  for (int o = 0; o < OUTPUT_COUNT; o++) {
+    const OutputColor& oc = color.getOutput(o);
+    String key = String(o);
+    prefs.putFloat(("gamma" + key).c_str(), oc.gamma);
+    prefs.putUInt(("white" + key).c_str(), ((uint32_t)oc.white.r << 16) | ((uint32_t)oc.white.g << 8) | oc.white.b);
+  }
+  prefs.putUChar("dither", color.getDitherBelow());
+  prefs.end();
 }
 
 // V15.2.3-2026-01-04T15:00:00Z - Get matrix dimensions for auto-scaling/centering
+// V16.5.0-2026-01-12T09:00:00Z - Use the real MATRIXn_* sizes (0-based, matching Config.h)
 int MatrixDisplay::getMatrixRows(int matrix) {
-  if (matrix == 0) return MATRIX1_ROWS;  // V15.2.3-2026-01-04T15:00:00Z
-  if (matrix == 1) return MATRIX2_ROWS;  // V15.2.3-2026-01-04T15:00:00Z
+  if (matrix == 0) return MATRIX0_ROWS;
+  if (matrix == 1) return MATRIX1_ROWS;
   #if ENABLE_MEGAMATRIX
-    if (matrix == 2) return MATRIX3_ROWS;  // V15.2.3-2026-01-04T15:00:00Z
+    if (matrix == 2) return MATRIX2_ROWS;
   #endif
-  return MATRIX1_ROWS;  // V15.2.3-2026-01-04T15:00:00Z - Default fallback
+  return MATRIX0_ROWS;  // V15.2.3-2026-01-04T15:00:00Z - Default fallback
 }
 
 int MatrixDisplay::getMatrixCols(int matrix) {
-  if (matrix == 0) return MATRIX1_COLS;  // V15.2.3-2026-01-04T15:00:00Z
-  if (matrix == 1) return MATRIX2_COLS;  // V15.2.3-2026-01-04T15:00:00Z
+  if (matrix == 0) return MATRIX0_COLS;
+  if (matrix == 1) return MATRIX1_COLS;
   #if ENABLE_MEGAMATRIX
-    if (matrix == 2) return MATRIX3_COLS;  // V15.2.3-2026-01-04T15:00:00Z
+    if (matrix == 2) return MATRIX2_COLS;
   #endif
-  return MATRIX1_COLS;  // V15.2.3-2026-01-04T15:00:00Z - Default fallback
+  return MATRIX0_COLS;  // V15.2.3-2026-01-04T15:00:00Z - Default fallback
+}
+
+// V16.5.0-2026-01-12T09:00:00Z - LED index for every (x, y), row-major, built once per matrix
+const uint16_t* MatrixDisplay::getIndexTable(int matrix) {
+  if (matrix < 0 || matrix >= MATRIX_COUNT) return nullptr;
+  if (!indexTables[matrix]) {
+    int cols = getMatrixCols(matrix);
+    int rows = getMatrixRows(matrix);
+    uint16_t* table = (uint16_t*)malloc(cols * rows * sizeof(uint16_t));
+    if (!table) return nullptr;
+    for (int y = 0; y < rows; y++) {
+      for (int x = 0; x < cols; x++) {
+        table[y * cols + x] = (uint16_t)getIndex(matrix, x, y);
+      }
+    }
+    indexTables[matrix] = table;
+  }
+  return indexTables[matrix];
+}
+
+// V16.5.6-2026-01-13T03:00:00Z - Resampled straight into wiring order through the index table
+bool MatrixDisplay::present(int matrix, const CRGB* src, int srcCols, int srcRows,
+                            ResampleMode mode, uint8_t orient) {
+  PROFILE_SCOPE("MatrixDisplay::present");
+  const uint16_t* table = getIndexTable(matrix);
+  if (!table || !src || srcCols <= 0 || srcRows <= 0) return false;
+  return Resampler::present(src, srcCols, srcRows, leds, table,
+                            getMatrixCols(matrix), getMatrixRows(matrix), mode, orient);
 }
 
 // v2.1: Added circle drawing implementation using midpoint circle algorithm
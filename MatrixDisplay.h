@@ -1,7 +1,16 @@
 /* MatrixDisplay.h
    Low-level display management and coordinate mapping
-   VERSION: V15.2.3-2026-01-04T15:00:00Z - Added matrix dimension getters for auto-scaling
+   VERSION: V16.5.6-2026-01-13T03:00:00Z - present(): resample native-size content onto a matrix
    
+   V16.5.6-2026-01-13T03:00:00Z - present() draws a canvas of any size through Resampler maps
+   V16.5.5-2026-01-13T00:00:00Z - attachTree(): tree buffer goes through the same color/power pass
+   V16.5.4-2026-01-12T21:00:00Z - PowerLimiter scales each output from the sums of the LUT pass
+   V16.5.3-2026-01-12T18:00:00Z - FastLED sends out[]; show() fills it from leds[] through
+                                  ColorPipeline (gamma, white point, brightness, dither)
+   V16.5.2-2026-01-12T15:00:00Z - setPostFx(): blur/bloom/trails/clamp between content and output
+   V16.5.0-2026-01-12T09:00:00Z - getIndexTable(): (x, y) -> LED index without per-pixel mapping math
+   V16.4.3-2026-01-11T17:00:00Z - Indexed mode: content draws palette indices, show() expands
+                                  them through a 256-entry CRGB palette in one pass
    V15.2.3-2026-01-04T15:00:00Z - Added getMatrixRows/Cols for per-matrix sizing
    v2.1 - Added drawCircle method
 */
@@ -10,6 +19,10 @@
 #define MATRIX_DISPLAY_H
 
 #include "Config.h"
+#include "PostFx.h"
+#include "ColorPipeline.h"
+#include "PowerLimiter.h"
+#include "Resampler.h"
 
 class MatrixDisplay {
 public:
@@ -31,15 +44,63 @@ public:
   // v2.1: Added circle drawing method
   void drawCircle(int matrix, int cx, int cy, int radius, CRGB color, bool filled = false);
   
-  // V15.2.3-2026-01-04T15:00:00Z - Get matrix dimensions for auto-scaling
+  // V15.2.3-2026-01-04T15:00:00Z - Get matrix dimensions (native size for present())
   int getMatrixRows(int matrix);
   int getMatrixCols(int matrix);
   
+  // V16.5.0-2026-01-12T09:00:00Z - Row-major [y * cols + x] -> LED index; nullptr for unknown matrix
+  const uint16_t* getIndexTable(int matrix);
+  
+  // V16.5.6-2026-01-13T03:00:00Z - Scale a row-major canvas (any size) onto a whole matrix,
+  // with optional mirror/flip/rotation (ORIENT_* in Resampler.h). Does not call show().
+  bool present(int matrix, const CRGB* src, int srcCols, int srcRows,
+               ResampleMode mode = RESAMPLE_NEAREST, uint8_t orient = ORIENT_NONE);
+  
   // Utility
   void setBrightness(uint8_t brightness);
+  uint8_t getBrightness() const { return color.getBrightness(); }
+  
+  // V16.5.3-2026-01-12T18:00:00Z - Per-output correction (output 0 = PIN_LEFT, 1 = PIN_RIGHT)
+  ColorPipeline& getColorPipeline() { return color; }
+  void saveColorSettings();
+  
+  // V16.5.5-2026-01-13T00:00:00Z - Mega Tree content buffer (MegaTree.h), sent as output 2
+  void attachTree(const CRGB* treeLeds) { treeSource = treeLeds; }
+  
+  // V16.5.4-2026-01-12T21:00:00Z - Estimated draw of the last frame and limiter state
+  PowerLimiter& getPowerLimiter() { return power; }
+  
+  // V16.4.3-2026-01-11T17:00:00Z - Palette-indexed mode (1 byte per pixel)
+  // While enabled, clear() and clearMatrix() act on the index buffer and show()
+  // overwrites leds[] with palette[index]. Swapping the palette re-tints the frame.
+  void setIndexedMode(bool enabled);
+  bool isIndexedMode() const { return indexed; }
+  void setPalette(const CRGB* palette256) { palette = palette256; }
+  const CRGB* getPalette() const { return palette; }
+  uint8_t* getIndexBuffer() { return indexBuf; }
+  void setPixelIndex(int matrix, int x, int y, uint8_t index);
+  uint8_t getPixelIndex(int matrix, int x, int y);
+  
+  // V16.5.2-2026-01-12T15:00:00Z - Post-processing for the current content (see PostFx.h).
+  // Applied to the output only: leds[] still holds the content frame after show().
+  void setPostFx(const PostFxSettings& fx) { postFx.configure(fx); }
+  const PostFxSettings& getPostFx() const { return postFx.getSettings(); }
   
 private:
-  CRGB leds[TOTAL_LEDS];
+  CRGB leds[TOTAL_LEDS];           // Content frame
+  CRGB out[TOTAL_LEDS];            // V16.5.3 - Corrected frame, bound to FastLED
+  ColorPipeline color;
+  PowerLimiter power;
+  const CRGB* treeSource = nullptr;
+#if ENABLE_MEGATREE
+  CRGB treeOut[MEGATREE_LEDS];     // V16.5.5 - Corrected tree frame, bound to FastLED
+#endif
+  void renderOutputs(ChannelSums* sums);
+  uint8_t* indexBuf = nullptr;     // Allocated on first use of indexed mode
+  const CRGB* palette = nullptr;   // 256 entries, owned by ThemeManager
+  bool indexed = false;
+  uint16_t* indexTables[MATRIX_COUNT] = {};  // Built on first getIndexTable() call
+  PostFx postFx;
   int xyToIndex(int x, int y);
 };
 
@@ -0,0 +1,178 @@
+/* MegaTree.cpp
+   Mega Tree tables and effects
+   VERSION: V16.5.5-2026-01-13T00:00:00Z - Initial implementation
+*/
+
+#include "MegaTree.h"
+#include "MatrixDisplay.h"
+#include "ThemeManager.h"
+#include "Logger.h"
+#include <math.h>
+
+extern ThemeManager themeManager;
+
+#if ENABLE_MEGATREE
+MegaTree megaTree;  // ~8 KB of buffers and tables; only exists when the tree is wired
+#endif
+
+MegaTree::MegaTree() {}
+
+bool MegaTree::begin(MatrixDisplay* display) {
+    buildTables();
+    fill_solid(leds, MEGATREE_LEDS, CRGB::Black);
+    display->attachTree(leds);
+    ready = true;
+    Logger::instance().log("[MegaTree] " + String(MEGATREE_BRANCHES) + " branches x " +
+                           String(MEGATREE_LEDS_PER_BRANCH) + " LEDs on GPIO " + String(PIN_MEGATREE));
+    return true;
+}
+
+// Branch position (0 = first LED on the string) for a height step (0 = base)
+static int branchPos(int branch, int step) {
+    int pos = MEGATREE_TOP_FIRST ? (MEGATREE_LEDS_PER_BRANCH - 1 - step) : step;
+    if (MEGATREE_ZIGZAG && (branch & 1)) pos = MEGATREE_LEDS_PER_BRANCH - 1 - pos;
+    return pos;
+}
+
+void MegaTree::buildTables() {
+    const int per = MEGATREE_LEDS_PER_BRANCH;
+    const float center = (MEGATREE_GRID - 1) * 0.5f;
+
+    for (int b = 0; b < MEGATREE_BRANCHES; b++) {
+        float theta = b * 2.0f * (float)M_PI / MEGATREE_BRANCHES;
+        float c = cosf(theta);
+        float s = sinf(theta);
+        for (int step = 0; step < per; step++) {
+            int i = b * per + branchPos(b, step);
+            uint8_t h = (uint8_t)(step * 255 / (per - 1));
+            angle[i] = (uint8_t)(b * 256 / MEGATREE_BRANCHES);
+            height[i] = h;
+            radius[i] = 255 - h;
+
+            // Top-down view: the star is the grid center, the base ring touches the edges
+            float r = radius[i] / 255.0f * center;
+            int x = (int)lroundf(center + r * c);
+            int y = (int)lroundf(center + r * s);
+            sample[i] = (uint16_t)(constrain(y, 0, MEGATREE_GRID - 1) * MEGATREE_GRID +
+                                   constrain(x, 0, MEGATREE_GRID - 1));
+        }
+    }
+}
+
+int MegaTree::ledAt(int branch, uint8_t h) const {
+    int step = h * (MEGATREE_LEDS_PER_BRANCH - 1) / 255;
+    return branch * MEGATREE_LEDS_PER_BRANCH + branchPos(branch, step);
+}
+
+bool MegaTree::allocateGrid() {
+    if (grid) return true;
+    const int n = MEGATREE_GRID * MEGATREE_GRID;
+    grid = (CRGB*)malloc(n * sizeof(CRGB));
+    uint16_t* index = (uint16_t*)malloc(n * sizeof(uint16_t));
+    uint8_t* r = (uint8_t*)malloc(n);
+    uint8_t* a = (uint8_t*)malloc(n);
+    if (!grid || !index || !r || !a) {
+        free(grid);
+        free(index);
+        free(r);
+        free(a);
+        grid = nullptr;
+        Logger::instance().log("[MegaTree] No memory for sampling grid");
+        return false;
+    }
+    Effects::buildGeometry(gridGeometry, MEGATREE_GRID, MEGATREE_GRID, index, r, a);
+    return true;
+}
+
+bool MegaTree::run(const String& name, MatrixDisplay* disp) {
+    static unsigned long lastFrame = 0;
+    if (!ready || !name.startsWith("Tree ")) return false;
+
+    unsigned long now = millis();
+    if (now - lastFrame < EFFECT_FRAME_MS) return true;
+    lastFrame = now;
+
+    uint32_t t = now;
+    if (name == "Tree Spiral") spiral(t);
+    else if (name == "Tree Wipe") wipe(t);
+    else if (name == "Tree Bands") bands(t);
+    else if (name == "Tree Snow") snow();
+    else if (!sampled(name.substring(5), t)) return false;
+
+    disp->show();
+    return true;
+}
+
+// ========== Tree-native effects: linear walks over the polar tables ==========
+
+// Two palette stripes winding up the tree
+void MegaTree::spiral(uint32_t t) {
+    const CRGB* palette = themeManager.getPalette();
+    uint8_t phase = t >> 2;
+    for (int i = 0; i < MEGATREE_LEDS; i++) {
+        uint8_t s = angle[i] + height[i] * 2 - phase;           // 2 turns base to star
+        uint8_t level = (s & 0x7F) < 64 ? (s & 0x7F) * 4 : (127 - (s & 0x7F)) * 4;
+        CRGB c = palette[(s & 0x80) ? PALETTE_COLOR1 : PALETTE_COLOR3];
+        leds[i] = c.nscale8_video(level);
+    }
+}
+
+// Color fills from the base to the star, then the next palette color wipes over it
+void MegaTree::wipe(uint32_t t) {
+    const CRGB* palette = themeManager.getPalette();
+    const uint8_t colors[3] = {PALETTE_COLOR1, PALETTE_COLOR2, PALETTE_COLOR3};
+    uint32_t cycle = t / 2000;                                 // 2 s per wipe
+    uint8_t level = (uint8_t)((t % 2000) * 255 / 2000);
+    CRGB next = palette[colors[cycle % 3]];
+    CRGB prev = palette[colors[(cycle + 2) % 3]];
+    for (int i = 0; i < MEGATREE_LEDS; i++) {
+        leds[i] = (height[i] <= level) ? next : prev;
+    }
+}
+
+// Wedges of the theme gradient rotating around the trunk, slightly twisted
+void MegaTree::bands(uint32_t t) {
+    const CRGB* palette = themeManager.getPalette();
+    uint8_t phase = t >> 3;
+    for (int i = 0; i < MEGATREE_LEDS; i++) {
+        uint8_t v = angle[i] * 3 + (height[i] >> 2) + phase;   // 3 bands per turn
+        leds[i] = palette[1 + scale8(v, 254)];
+    }
+}
+
+// Flakes slide down random branches over a fading tree
+void MegaTree::snow() {
+    for (int i = 0; i < MEGATREE_LEDS; i++) {
+        leds[i].nscale8(180);
+    }
+
+    if (flakeCount < MEGATREE_MAX_FLAKES && random8() < 96) {
+        Flake& f = flakes[flakeCount++];
+        f.branch = random8(MEGATREE_BRANCHES);
+        f.h = 0xFF00;
+        f.speed = random8(96, 255);
+    }
+
+    for (int k = 0; k < flakeCount; ) {
+        Flake& f = flakes[k];
+        uint16_t fall = f.speed * 3;               // ~3-8 s from star to base
+        if (f.h <= fall) {
+            flakes[k] = flakes[--flakeCount];   // Landed
+            continue;
+        }
+        f.h -= fall;
+        leds[ledAt(f.branch, f.h >> 8)] = CRGB::White;
+        k++;
+    }
+}
+
+// ========== 2D effects through the polar -> cartesian map ==========
+
+bool MegaTree::sampled(const String& kernel, uint32_t t) {
+    if (!allocateGrid()) return false;
+    if (!Effects::renderKernel(kernel, grid, gridGeometry, t)) return false;
+    for (int i = 0; i < MEGATREE_LEDS; i++) {
+        leds[i] = grid[sample[i]];
+    }
+    return true;
+}
@@ -0,0 +1,80 @@
+/* MegaTree.h
+   Mega Tree output: polar LED tables, tree-native effects, 2D effect sampling
+   VERSION: V16.5.5-2026-01-13T00:00:00Z - Initial implementation
+
+   The tree is MEGATREE_BRANCHES strings of MEGATREE_LEDS_PER_BRANCH hanging from the
+   star to the base. begin() computes, once, per LED:
+     angle   branch direction around the trunk, 0..255 = full turn
+     height  0 = base, 255 = star
+     radius  distance from the trunk, 0 at the star, 255 at the base (cone)
+     sample  index into a MEGATREE_GRID x MEGATREE_GRID grid, from the top-down
+             polar -> cartesian projection (the only trig, done here)
+   Effects then walk the LEDs linearly reading those bytes - no per-frame trig.
+   Tree-native effects: "Tree Spiral", "Tree Wipe", "Tree Bands", "Tree Snow".
+   "Tree <kernel>" (e.g. "Tree Plasma") renders an Effects kernel into the grid and
+   samples it through the projection.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Config.h"
+#include "Effects.h"
+
+class MatrixDisplay;
+
+#define MEGATREE_MAX_FLAKES 48
+
+class MegaTree {
+public:
+    MegaTree();
+
+    // Build tables and attach the buffer to the display's output pipeline
+    bool begin(MatrixDisplay* display);
+    bool isReady() const { return ready; }
+
+    CRGB* getLeds() { return leds; }
+    const uint8_t* getAngles() const { return angle; }
+    const uint8_t* getHeights() const { return height; }
+    const uint8_t* getRadii() const { return radius; }
+
+    // One frame of a "Tree ..." effect (rate-limited, calls show()); false for unknown names
+    bool run(const String& name, MatrixDisplay* disp);
+
+    // LED index for a branch and height (0 = base, 255 = star)
+    int ledAt(int branch, uint8_t h) const;
+
+private:
+    CRGB leds[MEGATREE_LEDS];
+    uint8_t angle[MEGATREE_LEDS];
+    uint8_t height[MEGATREE_LEDS];
+    uint8_t radius[MEGATREE_LEDS];
+    uint16_t sample[MEGATREE_LEDS];
+    bool ready = false;
+
+    // 2D sampling grid, allocated on first "Tree <kernel>" frame
+    CRGB* grid = nullptr;
+    Effects::Geometry gridGeometry;
+
+    struct Flake {
+        uint8_t branch;
+        uint16_t h;       // 8.8 height
+        uint8_t speed;    // Fall rate, x3 in 8.8 height units per frame
+    };
+    Flake flakes[MEGATREE_MAX_FLAKES];
+    int flakeCount = 0;
+
+    void buildTables();
+    bool allocateGrid();
+
+    void spiral(uint32_t t);
+    void wipe(uint32_t t);
+    void bands(uint32_t t);
+    void snow();
+    bool sampled(const String& kernel, uint32_t t);
+};
+
+#if ENABLE_MEGATREE
+extern MegaTree megaTree;
+#endif
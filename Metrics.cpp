@@ -0,0 +1,147 @@
+/* Metrics.cpp
+   Metric recording and Prometheus text formatting
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Bucket bounds printed exactly (0.00025, not 0.0003)
+   V16.7.2-2026-01-14T15:00:00Z - Content image reads profiled
+   V16.7.1-2026-01-14T12:00:00Z - Stalled loop passes traced (TraceLog)
+   V16.6.6-2026-01-14T06:00:00Z - Initial implementation
+*/
+
+#include "Metrics.h"
+#include "TraceLog.h"
+#include "Profiler.h"
+#include <algorithm>
+
+Metrics metrics;
+
+const uint32_t Histogram::BOUNDS[Histogram::BUCKETS - 1] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000
+};
+
+void Histogram::format(String& out, const char* name, const char* help) const {
+    Metrics::header(out, name, "histogram", help);
+    uint32_t cumulative = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+        cumulative += counts[b];
+        // Seconds from the integer microseconds, all six decimals: rounding would merge
+        // or shift bounds and skew quantiles
+        char le[24] = "+Inf";
+        if (b < BUCKETS - 1) snprintf(le, sizeof(le), "%lu.%06lu", (unsigned long)(BOUNDS[b] / 1000000),
+                                      (unsigned long)(BOUNDS[b] % 1000000));
+        Metrics::sample(out, (String(name) + "_bucket").c_str(), String(cumulative), "le=\"" + String(le) + "\"");
+    }
+    Metrics::sample(out, (String(name) + "_sum").c_str(), String((double)sumUs / 1e6, 6));
+    Metrics::sample(out, (String(name) + "_count").c_str(), String(cumulative));
+}
+
+esp_err_t contentFlashRead(void* buffer, uint32_t address, size_t length) {
+    PROFILE_SCOPE("flash read");  // V16.7.2-2026-01-14T15:00:00Z
+    metrics.flashRead(length);
+    return esp_flash_read(NULL, buffer, address, length);
+}
+
+void Metrics::endShow(bool treeLive) {
+    uint32_t now = micros();
+    show.observe(now - showStart);
+    markUs = now;
+    for (int o = 0; o < OUTPUT_COUNT; o++) {
+        if (o < 2 || treeLive) frames[o]++;
+    }
+}
+
+void Metrics::endPass() {
+    uint32_t now = micros();
+    uint32_t us = now - passStart;
+    loopSamples[loopNext] = us;
+    loopNext = (loopNext + 1) % METRICS_LOOP_SAMPLES;
+    if (loopFilled < METRICS_LOOP_SAMPLES) loopFilled++;
+    if (us > loopMax) loopMax = us;
+    if (us > TRACE_STALL_US) traceLog.event(TRACE_STALL, us, ESP.getFreeHeap());  // V16.7.1-2026-01-14T12:00:00Z
+    passes++;
+
+    // Achieved frame rate per output, once a second
+    uint32_t elapsed = now - windowStart;
+    if (elapsed >= 1000000) {
+        for (int o = 0; o < OUTPUT_COUNT; o++) {
+            fps[o] = (frames[o] - windowFrames[o]) * 1e6f / elapsed;
+            windowFrames[o] = frames[o];
+        }
+        windowStart = now;
+    }
+}
+
+void Metrics::header(String& out, const char* name, const char* type, const char* help) {
+    out += "# HELP ";
+    out += name;
+    out += " ";
+    out += help;
+    out += "\n# TYPE ";
+    out += name;
+    out += " ";
+    out += type;
+    out += "\n";
+}
+
+void Metrics::sample(String& out, const char* name, const String& value, const String& labels) {
+    out += name;
+    if (labels.length()) {
+        out += "{";
+        out += labels;
+        out += "}";
+    }
+    out += " ";
+    out += value;
+    out += "\n";
+}
+
+String Metrics::label(const char* key, const String& value) {
+    String out = String(key) + "=\"";
+    for (const char* p = value.c_str(); *p; p++) {
+        if (*p == '\\' || *p == '"') out += '\\';
+        if (*p == '\n') {
+            out += "\\n";
+            continue;
+        }
+        out += *p;
+    }
+    return out + "\"";
+}
+
+void Metrics::format(String& out) {
+    render.format(out, "matrixshow_render_seconds", "Loop work before FastLED.show(), per shown frame");
+    show.format(out, "matrixshow_show_seconds", "FastLED.show() duration");
+    web.format(out, "matrixshow_web_request_seconds", "Web request queued to answered");
+
+    header(out, "matrixshow_output_frames_total", "counter", "Frames sent per output");
+    for (int o = 0; o < OUTPUT_COUNT; o++) sample(out, "matrixshow_output_frames_total", String(frames[o]), label("output", String(o)));
+    header(out, "matrixshow_output_fps", "gauge", "Frames per second per output over the last second");
+    for (int o = 0; o < OUTPUT_COUNT; o++) sample(out, "matrixshow_output_fps", String(fps[o], 1), label("output", String(o)));
+
+    // Loop pass quantiles over the recent window
+    uint32_t sorted[METRICS_LOOP_SAMPLES];
+    memcpy(sorted, loopSamples, loopFilled * sizeof(uint32_t));
+    std::sort(sorted, sorted + loopFilled);
+    auto quantile = [&](float q) -> float {
+        return loopFilled ? sorted[min<int>(loopFilled - 1, (int)(q * loopFilled))] / 1e6f : 0.0f;
+    };
+    header(out, "matrixshow_loop_seconds", "summary", "loop() pass duration without its delay");
+    sample(out, "matrixshow_loop_seconds", String(quantile(0.5f), 6), "quantile=\"0.5\"");
+    sample(out, "matrixshow_loop_seconds", String(quantile(0.99f), 6), "quantile=\"0.99\"");
+    sample(out, "matrixshow_loop_seconds_count", String(passes));
+    header(out, "matrixshow_loop_max_seconds", "gauge", "Longest loop() pass since the previous scrape");
+    sample(out, "matrixshow_loop_max_seconds", String(loopMax / 1e6f, 6));
+    loopMax = 0;
+
+    header(out, "matrixshow_heap_free_bytes", "gauge", "Free internal heap");
+    sample(out, "matrixshow_heap_free_bytes", String(ESP.getFreeHeap()));
+    header(out, "matrixshow_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+    sample(out, "matrixshow_heap_min_free_bytes", String(ESP.getMinFreeHeap()));
+    header(out, "matrixshow_heap_largest_block_bytes", "gauge", "Largest allocatable block");
+    sample(out, "matrixshow_heap_largest_block_bytes", String(ESP.getMaxAllocHeap()));
+    header(out, "matrixshow_psram_free_bytes", "gauge", "Free PSRAM");
+    sample(out, "matrixshow_psram_free_bytes", String(ESP.getFreePsram()));
+
+    header(out, "matrixshow_flash_reads_total", "counter", "Reads from the content image");
+    sample(out, "matrixshow_flash_reads_total", String(flashReads.load(std::memory_order_relaxed)));
+    header(out, "matrixshow_flash_read_bytes_total", "counter", "Bytes read from the content image");
+    sample(out, "matrixshow_flash_read_bytes_total", String(flashBytes.load(std::memory_order_relaxed)));
+}
@@ -0,0 +1,102 @@
+/* Metrics.h
+   Frame, loop, web and memory health counters for /metrics (Prometheus text format)
+   VERSION: V16.6.6-2026-01-14T06:00:00Z - Initial implementation
+
+   Recording is a few integer adds on the hot path; text is only built when /metrics is
+   scraped. Render, show, loop and web timings are written by the loop task, which is also
+   where the scrape handler runs, so they are plain counters. Flash reads also happen on
+   the TCP task (static assets), so those two counters are atomics.
+     render  loop pass start (or the previous show) -> just before FastLED.show(): effect
+             drawing, palette expansion, postFx, color LUT and power limit
+     show    FastLED.show() itself
+     loop    one loop() pass without its delay(); p50/p99 over the last
+             METRICS_LOOP_SAMPLES passes, max since the previous scrape
+     web     queued on the TCP task -> answered by the loop task
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "Config.h"
+#include "esp_spi_flash.h"
+
+// Latency histogram with fixed buckets (microseconds)
+class Histogram {
+public:
+    static const int BUCKETS = 12;  // Last one is +Inf
+
+    void observe(uint32_t us) {
+        int b = 0;
+        while (b < BUCKETS - 1 && us > BOUNDS[b]) b++;
+        counts[b]++;
+        sumUs += us;
+    }
+
+    // name_bucket{le=...}, name_sum, name_count in seconds
+    void format(String& out, const char* name, const char* help) const;
+
+private:
+    static const uint32_t BOUNDS[BUCKETS - 1];
+    uint32_t counts[BUCKETS] = {};
+    uint64_t sumUs = 0;
+};
+
+class Metrics {
+public:
+    Metrics() {}
+
+    // loop()
+    void beginPass() { passStart = markUs = micros(); }
+    void endPass();
+
+    // MatrixDisplay::show(), around FastLED.show(); treeLive: output 2 carried a frame
+    void beginShow() {
+        showStart = micros();
+        if (markUs) render.observe(showStart - markUs);  // 0 = before the first loop() pass
+    }
+    void endShow(bool treeLive);
+
+    void webRequest(uint32_t us) { web.observe(us); }
+
+    // Content image reads (contentFlashRead); any task
+    void flashRead(size_t bytes) {
+        flashReads.fetch_add(1, std::memory_order_relaxed);
+        flashBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    // Render/show/loop/web/heap/flash metrics; resets the loop max
+    void format(String& out);
+
+    // One-sample metric line helpers for other sources
+    static void header(String& out, const char* name, const char* type, const char* help);
+    static void sample(String& out, const char* name, const String& value, const String& labels = String());
+    static String label(const char* key, const String& value);  // key="escaped value"
+
+private:
+    Histogram render;
+    Histogram show;
+    Histogram web;
+    uint32_t passStart = 0;
+    uint32_t markUs = 0;
+    uint32_t showStart = 0;
+
+    uint32_t frames[OUTPUT_COUNT] = {};
+    uint32_t windowFrames[OUTPUT_COUNT] = {};
+    float fps[OUTPUT_COUNT] = {};
+    uint32_t windowStart = 0;
+
+    uint32_t loopSamples[METRICS_LOOP_SAMPLES] = {};
+    uint16_t loopNext = 0;
+    uint16_t loopFilled = 0;
+    uint32_t loopMax = 0;
+    uint32_t passes = 0;
+
+    std::atomic<uint32_t> flashReads{0};
+    std::atomic<uint32_t> flashBytes{0};
+};
+
+extern Metrics metrics;
+
+// V16.6.6-2026-01-14T06:00:00Z - esp_flash_read of the content image, counted
+esp_err_t contentFlashRead(void* buffer, uint32_t address, size_t length);
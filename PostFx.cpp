@@ -0,0 +1,214 @@
+/* PostFx.cpp
+   Post-processing implementation
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scope
+   V16.5.2-2026-01-12T15:00:00Z - Initial implementation
+*/
+
+#include "PostFx.h"
+#include "MatrixDisplay.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+namespace {
+
+// Two 8-bit channels per 32-bit word, each in a 16-bit lane: 0x00XX00YY.
+// The spare high byte of each lane absorbs sums and carries.
+const uint32_t LANES = 0x00FF00FF;
+const uint32_t GUARD = 0x01000100;
+
+inline uint32_t pack(const CRGB& c) {
+    return ((uint32_t)c.r << 16) | ((uint32_t)c.g << 8) | c.b;
+}
+
+inline CRGB unpack(uint32_t p) {
+    return CRGB((uint8_t)(p >> 16), (uint8_t)(p >> 8), (uint8_t)p);
+}
+
+// Split a packed pixel into R|B and G lanes, apply op to both, recombine
+template<typename Op>
+inline uint32_t perPixel(uint32_t a, uint32_t b, Op op) {
+    return op(a & LANES, b & LANES) | (op((a >> 8) & LANES, (b >> 8) & LANES) << 8);
+}
+
+// 0xFF in every lane where a >= b (no borrow can cross lanes thanks to the guard bit)
+inline uint32_t geMask(uint32_t a, uint32_t b) {
+    uint32_t t = ((a | GUARD) - b) & GUARD;
+    return t - (t >> 8);
+}
+
+inline uint32_t maxLanes(uint32_t a, uint32_t b) {
+    uint32_t m = geMask(a, b);
+    return (a & m) | (b & ~m & LANES);
+}
+
+inline uint32_t minLanes(uint32_t a, uint32_t b) {
+    uint32_t m = geMask(a, b);
+    return (b & m) | (a & ~m & LANES);
+}
+
+inline uint32_t addSatLanes(uint32_t a, uint32_t b) {
+    uint32_t s = a + b;
+    uint32_t overflow = s & GUARD;
+    return (s | (overflow - (overflow >> 8))) & LANES;
+}
+
+inline uint32_t scaleLanes(uint32_t a, uint8_t scale) {
+    return ((a * scale) >> 8) & LANES;  // 255 * 255 still fits each 16-bit lane
+}
+
+inline uint32_t blurLanes(uint32_t a, uint32_t b, uint32_t c, bool box) {
+    if (box) return (((a + b + c) * 85) >> 8) & LANES;  // Lane sum <= 765; * 85 < 65536
+    return ((a + (b << 1) + c) >> 2) & LANES;           // Lane sum <= 1020
+}
+
+// One 3-tap pass along a line of n pixels spaced stride apart; edges repeat
+void blurLine(const uint32_t* src, uint32_t* dst, int n, int stride, bool box) {
+    if (n < 2) {
+        if (n == 1) dst[0] = src[0];
+        return;
+    }
+    uint32_t prev = src[0];
+    uint32_t cur = src[0];
+    for (int i = 0; i < n; i++) {
+        uint32_t next = (i < n - 1) ? src[(i + 1) * stride] : cur;
+        uint32_t rb = blurLanes(prev & LANES, cur & LANES, next & LANES, box);
+        uint32_t g = blurLanes((prev >> 8) & LANES, (cur >> 8) & LANES, (next >> 8) & LANES, box);
+        dst[i * stride] = rb | (g << 8);
+        prev = cur;
+        cur = next;
+    }
+}
+
+} // namespace
+
+void PostFx::configure(const PostFxSettings& fx) {
+    settings = fx;
+    historyValid = false;
+}
+
+bool PostFx::allocate(MatrixDisplay& disp) {
+    if (!pixelCount) {
+        for (int m = 0; m < MATRIX_COUNT; m++) {
+            pixelCount += disp.getMatrixCols(m) * disp.getMatrixRows(m);
+        }
+    }
+    size_t bytes = pixelCount * sizeof(uint32_t);
+    if (!frame) frame = (uint32_t*)malloc(bytes);
+    if (!work) work = (uint32_t*)malloc(bytes);
+    if ((settings.blur || settings.bloomThreshold) && !temp) temp = (uint32_t*)malloc(bytes);
+    if (settings.bloomThreshold && !bright) bright = (uint32_t*)malloc(bytes);
+    if (settings.trail && !history) history = (uint32_t*)malloc(bytes);
+
+    bool ok = frame && work
+           && (temp || !(settings.blur || settings.bloomThreshold))
+           && (bright || !settings.bloomThreshold)
+           && (history || !settings.trail);
+    if (!ok) {
+        Logger::instance().log("[PostFx] Out of memory - post-processing disabled");
+        settings = PostFxSettings();
+    }
+    return ok;
+}
+
+// Separable blur of every matrix: rows into temp, then columns back into buf
+void PostFx::blur(MatrixDisplay& disp, uint32_t* buf, bool box) {
+    int base = 0;
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        int cols = disp.getMatrixCols(m);
+        int rows = disp.getMatrixRows(m);
+        for (int y = 0; y < rows; y++) {
+            blurLine(buf + base + y * cols, temp + base + y * cols, cols, 1, box);
+        }
+        for (int x = 0; x < cols; x++) {
+            blurLine(temp + base + x, buf + base + x, rows, cols, box);
+        }
+        base += cols * rows;
+    }
+}
+
+bool PostFx::apply(MatrixDisplay& disp, CRGB* leds) {
+    if (!settings.enabled() || !allocate(disp)) return false;
+    PROFILE_SCOPE("PostFx::apply");  // V16.7.2-2026-01-14T15:00:00Z
+
+    // Gather: wiring order -> logical row-major grids
+    int base = 0;
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        const uint16_t* idx = disp.getIndexTable(m);
+        int n = disp.getMatrixCols(m) * disp.getMatrixRows(m);
+        if (!idx) return false;
+        for (int i = 0; i < n; i++) {
+            frame[base + i] = pack(leds[idx[i]]);
+        }
+        base += n;
+    }
+    memcpy(work, frame, pixelCount * sizeof(uint32_t));
+
+    for (int pass = 0; pass < settings.blur; pass++) {
+        blur(disp, work, settings.boxKernel);
+    }
+
+    if (settings.bloomThreshold) {
+        uint8_t threshold = settings.bloomThreshold;
+        for (int i = 0; i < pixelCount; i++) {
+            uint32_t p = work[i];
+            uint8_t peak = max(max((uint8_t)(p >> 16), (uint8_t)(p >> 8)), (uint8_t)p);
+            bright[i] = (peak > threshold) ? p : 0;
+        }
+        blur(disp, bright, false);
+        blur(disp, bright, false);
+        uint8_t amount = settings.bloomAmount;
+        for (int i = 0; i < pixelCount; i++) {
+            work[i] = perPixel(work[i], bright[i], [amount](uint32_t a, uint32_t b) {
+                return addSatLanes(a, scaleLanes(b, amount));
+            });
+        }
+    }
+
+    if (settings.trail) {
+        if (!historyValid) {
+            memcpy(history, work, pixelCount * sizeof(uint32_t));
+            historyValid = true;
+        }
+        uint8_t trail = settings.trail;
+        for (int i = 0; i < pixelCount; i++) {
+            uint32_t out = perPixel(work[i], history[i], [trail](uint32_t a, uint32_t b) {
+                return maxLanes(a, scaleLanes(b, trail));
+            });
+            history[i] = out;
+            work[i] = out;
+        }
+    }
+
+    if (settings.clamp < 255) {
+        uint32_t ceiling = pack(CRGB(settings.clamp, settings.clamp, settings.clamp));
+        for (int i = 0; i < pixelCount; i++) {
+            work[i] = perPixel(work[i], ceiling, [](uint32_t a, uint32_t b) {
+                return minLanes(a, b);
+            });
+        }
+    }
+
+    // Scatter back to wiring order
+    base = 0;
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        const uint16_t* idx = disp.getIndexTable(m);
+        int n = disp.getMatrixCols(m) * disp.getMatrixRows(m);
+        for (int i = 0; i < n; i++) {
+            leds[idx[i]] = unpack(work[base + i]);
+        }
+        base += n;
+    }
+    return true;
+}
+
+void PostFx::restore(MatrixDisplay& disp, CRGB* leds) {
+    int base = 0;
+    for (int m = 0; m < MATRIX_COUNT; m++) {
+        const uint16_t* idx = disp.getIndexTable(m);
+        int n = disp.getMatrixCols(m) * disp.getMatrixRows(m);
+        for (int i = 0; i < n; i++) {
+            leds[idx[i]] = unpack(frame[base + i]);
+        }
+        base += n;
+    }
+}
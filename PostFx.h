@@ -0,0 +1,65 @@
+/* PostFx.h
+   Post-processing passes run by MatrixDisplay::show() between content and output
+   VERSION: V16.5.2-2026-01-12T15:00:00Z - Initial implementation
+
+   Passes, in order: blur -> bloom -> trails -> clamp.
+     blur    separable 3-tap filter, [1 2 1]/4 (gaussian) or [1 1 1]/3 (box), repeated N times
+     bloom   pixels whose brightest channel exceeds a threshold are blurred and added back
+     trails  each frame is max(frame, previous output * trail/256) - fade instead of clear
+     clamp   per-channel ceiling
+   Pixels are gathered through the per-matrix index tables into row-major logical grids,
+   so filters see true neighbours instead of serpentine wiring order. Each pixel is a
+   packed 0x00RRGGBB word processed as two SWAR halves (R|B and G in 16-bit lanes).
+   The content frame in leds[] is restored after output, so content that draws
+   incrementally (or holds a static frame) is never processed twice.
+
+   Content opts in with a "postfx" object in its JSON:
+     "postfx": {"blur": 1, "kernel": "gauss", "bloom": {"threshold": 160, "amount": 192},
+                "trail": 200, "clamp": 230}
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+class MatrixDisplay;
+
+// V16.5.2-2026-01-12T15:00:00Z - Per-content settings (all passes off by default)
+struct PostFxSettings {
+    uint8_t blur = 0;             // Blur passes (each = horizontal + vertical)
+    bool boxKernel = false;       // [1 1 1]/3 instead of [1 2 1]/4
+    uint8_t bloomThreshold = 0;   // 0 = bloom off
+    uint8_t bloomAmount = 128;    // Glow strength added back (0-255)
+    uint8_t trail = 0;            // 0 = off, higher = longer trails
+    uint8_t clamp = 255;          // Per-channel maximum
+
+    bool enabled() const { return blur || bloomThreshold || trail || clamp < 255; }
+};
+
+class PostFx {
+public:
+    // Settings change resets the trail history
+    void configure(const PostFxSettings& fx);
+    const PostFxSettings& getSettings() const { return settings; }
+
+    // Process leds[] in place; false (and leds[] untouched) when nothing is enabled
+    bool apply(MatrixDisplay& disp, CRGB* leds);
+    // Put back the unprocessed content frame after FastLED.show()
+    void restore(MatrixDisplay& disp, CRGB* leds);
+
+private:
+    PostFxSettings settings;
+    bool historyValid = false;
+
+    // One uint32 per logical pixel, all matrices back to back; allocated on first use
+    uint32_t* frame = nullptr;     // Gathered content frame (restored after output)
+    uint32_t* work = nullptr;
+    uint32_t* temp = nullptr;      // Separable filter scratch
+    uint32_t* bright = nullptr;    // Bloom bright-pass
+    uint32_t* history = nullptr;   // Previous output, for trails
+    int pixelCount = 0;
+
+    bool allocate(MatrixDisplay& disp);
+    void blur(MatrixDisplay& disp, uint32_t* buf, bool box);
+};
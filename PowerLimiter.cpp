@@ -0,0 +1,79 @@
+/* PowerLimiter.cpp
+   Power estimate and limiter implementation
+   VERSION: V16.5.4-2026-01-12T21:00:00Z - Initial implementation
+*/
+
+#include "PowerLimiter.h"
+
+PowerLimiter::PowerLimiter() : budgetW(POWER_BUDGET_W) {
+    const OutputPower defaults[3] = {
+        {OUTPUT0_VOLTS, OUTPUT0_MA_PER_CHANNEL, OUTPUT0_IDLE_MA, OUTPUT0_BUDGET_MA},
+        {OUTPUT1_VOLTS, OUTPUT1_MA_PER_CHANNEL, OUTPUT1_IDLE_MA, OUTPUT1_BUDGET_MA},
+        {OUTPUT2_VOLTS, OUTPUT2_MA_PER_CHANNEL, OUTPUT2_IDLE_MA, OUTPUT2_BUDGET_MA}   // Mega Tree
+    };
+    for (int o = 0; o < OUTPUT_COUNT; o++) {
+        outputs[o] = defaults[o];
+        scale[o] = 256;
+    }
+}
+
+void PowerLimiter::measure(const ChannelSums* sums) {
+    float totalW = 0;
+    for (int o = 0; o < OUTPUT_COUNT; o++) {
+        const OutputPower& p = outputs[o];
+        uint32_t channelSum = sums[o].r + sums[o].g + sums[o].b;
+        milliamps[o] = p.idleMa * sums[o].count + (float)channelSum * p.maPerChannel / 255.0f;
+        totalW += getWatts(o);
+    }
+    if (totalW > peakW) peakW = totalW;
+}
+
+float PowerLimiter::getTotalWatts() const {
+    float total = 0;
+    for (int o = 0; o < OUTPUT_COUNT; o++) total += getWatts(o);
+    return total;
+}
+
+bool PowerLimiter::update(const ChannelSums* sums) {
+    measure(sums);
+
+    // What each output would draw with no limiting (the frame was rendered at scale/256)
+    float idleMa[OUTPUT_COUNT];
+    float unscaledMa[OUTPUT_COUNT];
+    float idleW = 0;
+    float unscaledW = 0;
+    bool over = false;
+    for (int o = 0; o < OUTPUT_COUNT; o++) {
+        const OutputPower& p = outputs[o];
+        idleMa[o] = p.idleMa * sums[o].count;
+        unscaledMa[o] = (milliamps[o] - idleMa[o]) * 256.0f / max<uint16_t>(scale[o], 1);
+        idleW += idleMa[o] * p.volts / 1000.0f;
+        unscaledW += unscaledMa[o] * p.volts / 1000.0f;
+        if (p.budgetMa && milliamps[o] > p.budgetMa) over = true;
+    }
+    if (budgetW > 0 && getTotalWatts() > budgetW) over = true;
+
+    // Global budget: one uniform factor keeps the outputs balanced against each other
+    float globalTarget = 256.0f;
+    if (budgetW > 0 && unscaledW > 0) {
+        globalTarget = (budgetW - idleW) * 256.0f / unscaledW;
+    }
+
+    for (int o = 0; o < OUTPUT_COUNT; o++) {
+        float target = globalTarget;
+        uint32_t budgetMa = outputs[o].budgetMa;
+        if (budgetMa && unscaledMa[o] > 0) {
+            target = min(target, (budgetMa - idleMa[o]) * 256.0f / unscaledMa[o]);
+        }
+        uint16_t t = (uint16_t)constrain(target, 1.0f, 256.0f);
+
+        if (t < scale[o]) {
+            scale[o] = t;                                  // Attack: immediately
+        } else if (t > scale[o]) {
+            scale[o] += max(1, (t - scale[o]) >> 3);       // Release: ~8 frames
+        }
+    }
+
+    if (over) limitedFrames++;
+    return over;
+}
@@ -0,0 +1,59 @@
+/* PowerLimiter.h
+   Per-frame current estimate and brightness limiting per output
+   VERSION: V16.5.4-2026-01-12T21:00:00Z - Initial implementation
+
+   Model per output: each LED draws idleMa, plus maPerChannel * value/255 for each of
+   R, G and B. The channel sums come from ColorPipeline::apply(), the pass that fills the
+   FastLED buffer, so estimating costs three adds per LED.
+   Limiting: every output has a scale (256 = none) applied in that same pass. A frame
+   over an output budget or the global watt budget drops the scale at once and is
+   re-rendered before it is sent (attack); the scale then recovers over ~8 frames
+   (release), so a flash of white dims smoothly instead of pumping.
+   A budget of 0 means unlimited.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include "Config.h"
+#include "ColorPipeline.h"
+
+// V16.5.4-2026-01-12T21:00:00Z - Per-output electrical model
+struct OutputPower {
+    float volts;
+    uint16_t maPerChannel;   // One channel at 255, one LED
+    float idleMa;            // Per LED, all channels off
+    uint32_t budgetMa;       // 0 = no per-output limit
+};
+
+class PowerLimiter {
+public:
+    PowerLimiter();
+
+    void setOutput(int output, const OutputPower& power) { outputs[output] = power; }
+    const OutputPower& getOutput(int output) const { return outputs[output]; }
+    void setBudgetWatts(float watts) { budgetW = watts; }
+    float getBudgetWatts() const { return budgetW; }
+
+    uint16_t getScale(int output) const { return scale[output]; }
+
+    // After a render pass: record the estimate and adjust the scales. Returns true if
+    // the frame is over budget and should be rendered again at the new scales.
+    bool update(const ChannelSums* sums);
+    // Record the estimate only (after the re-render)
+    void measure(const ChannelSums* sums);
+
+    float getMilliamps(int output) const { return milliamps[output]; }
+    float getWatts(int output) const { return milliamps[output] * outputs[output].volts / 1000.0f; }
+    float getTotalWatts() const;
+    float getPeakWatts() const { return peakW; }
+    uint32_t getLimitedFrames() const { return limitedFrames; }
+
+private:
+    OutputPower outputs[OUTPUT_COUNT];
+    float budgetW;
+    uint16_t scale[OUTPUT_COUNT];
+    float milliamps[OUTPUT_COUNT] = {};
+    float peakW = 0;
+    uint32_t limitedFrames = 0;
+};
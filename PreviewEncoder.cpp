@@ -0,0 +1,86 @@
+/* PreviewEncoder.cpp
+   Skip/fill/literal runs over the changed pixels
+   VERSION: V16.6.3-2026-01-13T21:00:00Z - Initial implementation
+*/
+
+#include "PreviewEncoder.h"
+#include <string.h>
+
+static inline bool samePixel(const uint8_t* a, const uint8_t* b) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+static inline uint8_t* put16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+size_t previewEncode(const uint8_t* frame, uint8_t* base, uint16_t width, uint16_t height,
+                     bool key, uint16_t sequence, uint8_t* out) {
+    const size_t count = (size_t)width * height;
+    uint8_t* p = out;
+    *p++ = 'F';
+    *p++ = key ? 1 : 0;
+    p = put16(p, width);
+    p = put16(p, height);
+    p = put16(p, sequence);
+
+    uint16_t skip = 0;
+    size_t i = 0;
+    while (i < count) {
+        if (!key && samePixel(frame + i * 3, base + i * 3)) {
+            skip++;
+            i++;
+            continue;
+        }
+
+        // Changed run [i, end)
+        size_t end = i;
+        while (end < count && (key || !samePixel(frame + end * 3, base + end * 3))) end++;
+
+        // Split into fills (repeats of one color) and literals
+        size_t k = i;
+        while (k < end) {
+            size_t r = k + 1;
+            while (r < end && samePixel(frame + r * 3, frame + k * 3)) r++;
+            if (r - k >= PREVIEW_MIN_FILL) {
+                p = put16(p, skip);
+                p = put16(p, PREVIEW_FILL_FLAG | (uint16_t)(r - k));
+                memcpy(p, frame + k * 3, 3);
+                p += 3;
+                skip = 0;
+                k = r;
+                continue;
+            }
+
+            // Literal until the next repeat worth a fill
+            size_t start = k;
+            k = r;
+            while (k < end) {
+                r = k + 1;
+                while (r < end && samePixel(frame + r * 3, frame + k * 3)) r++;
+                if (r - k >= PREVIEW_MIN_FILL) break;
+                k = r;
+            }
+            p = put16(p, skip);
+            p = put16(p, (uint16_t)(k - start));
+            memcpy(p, frame + start * 3, (k - start) * 3);
+            p += (k - start) * 3;
+            skip = 0;
+        }
+
+        memcpy(base + i * 3, frame + i * 3, (end - i) * 3);
+        i = end;
+    }
+
+    size_t len = p - out;
+    return (len == PREVIEW_HEADER_BYTES && !key) ? 0 : len;
+}
+
+#ifdef PREVIEW_HOST_EXPORT
+extern "C" size_t preview_encode(const uint8_t* frame, uint8_t* base, uint16_t width, uint16_t height,
+                                 int key, uint16_t sequence, uint8_t* out) {
+    return previewEncode(frame, base, width, height, key != 0, sequence, out);
+}
+#endif
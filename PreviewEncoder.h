@@ -0,0 +1,40 @@
+/* PreviewEncoder.h
+   Delta/RLE encoding of the logical framebuffer for the live preview
+   VERSION: V16.6.3-2026-01-13T21:00:00Z - Initial implementation
+
+   Plain C++ with no Arduino or FastLED dependency, so a host build (tools/preview_sim.py
+   compiles this file into a shared library) produces byte-identical streams.
+
+   Message (little endian):
+     0  'F'
+     1  flags: bit 0 = key frame (every pixel sent; the receiver clears nothing first)
+     2  uint16 width      4  uint16 height      6  uint16 sequence
+     8  runs until the end of the message:
+          uint16 skip     pixels unchanged since the receiver's last frame
+          uint16 count    bit 15 set: 3 bytes RGB follow, repeated (count & 0x7FFF) times
+                          bit 15 clear: count literal RGB triplets follow
+   Pixels are row-major over the canvas, 3 bytes each (R, G, B).
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PREVIEW_HEADER_BYTES 8
+#define PREVIEW_FILL_FLAG 0x8000
+#define PREVIEW_MIN_FILL 3          // Shorter repeats are cheaper as literals
+
+// Largest message for a canvas of `pixels` (every other pixel changed)
+#define PREVIEW_MAX_MESSAGE(pixels) (PREVIEW_HEADER_BYTES + ((pixels) + 1) / 2 * 7 + 4)
+
+// Encode frame against base (what the receiver shows) and update base to frame.
+// Returns the message length, or 0 if nothing changed and key is false.
+// frame/base: width * height RGB triplets; width * height must be below 32768.
+size_t previewEncode(const uint8_t* frame, uint8_t* base, uint16_t width, uint16_t height,
+                     bool key, uint16_t sequence, uint8_t* out);
+
+#ifdef PREVIEW_HOST_EXPORT
+extern "C" size_t preview_encode(const uint8_t* frame, uint8_t* base, uint16_t width, uint16_t height,
+                                 int key, uint16_t sequence, uint8_t* out);
+#endif
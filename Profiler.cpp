@@ -0,0 +1,128 @@
+/* Profiler.cpp
+   Capture control, event recording and trace_event JSON
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Event offsets past 2^31 cycles (~8.9 s) no longer go negative
+   V16.7.2-2026-01-14T15:00:00Z - Initial implementation
+*/
+
+#include "Profiler.h"
+#include "Logger.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+Profiler profiler;
+
+// Deltas this close below 2^32 (~1.1 s at 240 MHz) are scopes that began before the base
+#define PROFILE_EARLY_CYCLES (0xFFFFFFFFu - (1u << 28))
+static_assert((uint64_t)PROFILE_MAX_MS * 240000 < PROFILE_EARLY_CYCLES,
+              "PROFILE_MAX_MS too long: late events would read as early ones at 240 MHz");
+
+bool Profiler::start(uint32_t ms) {
+    if (exporting.load() > 0) return false;
+    active = false;
+    if (!events) {
+        // Kept after the capture for the download, reused by the next one
+        events = (ProfileEvent*)heap_caps_malloc(PROFILE_EVENTS * sizeof(ProfileEvent), MALLOC_CAP_SPIRAM);
+        capacity = PROFILE_EVENTS;
+        if (!events) {
+            events = (ProfileEvent*)malloc(PROFILE_EVENTS_INTERNAL * sizeof(ProfileEvent));
+            capacity = PROFILE_EVENTS_INTERNAL;
+        }
+        if (!events) {
+            capacity = 0;
+            LOG_E("[Profiler] No memory for the event ring");
+            return false;
+        }
+    }
+    durationMs = constrain(ms, (uint32_t)1, (uint32_t)PROFILE_MAX_MS);
+    cyclesPerUs = ESP.getCpuFreqMHz();
+    next.store(0);
+    for (Base& b : base) b.set.store(false);
+    // This core's base now; the other core's at its first event
+    Base& own = base[xPortGetCoreID() & 1];
+    own.cycles = ESP.getCycleCount();
+    captureUs = own.us = esp_timer_get_time();
+    own.set.store(true);
+    startMs = millis();
+    active = true;
+    LOG_I("[Profiler] Capturing %lu ms into %lu slots", (unsigned long)durationMs, (unsigned long)capacity);
+    return true;
+}
+
+void Profiler::update() {
+    if (active && millis() - startMs >= durationMs) {
+        active = false;
+        LOG_I("[Profiler] Capture done: %lu events, %lu overwritten", (unsigned long)getEventCount(),
+              (unsigned long)getOverwritten());
+    }
+}
+
+void Profiler::record(const char* name, uint32_t start, uint32_t end) {
+    if (!active) return;  // Capture ended inside the scope
+    uint8_t core = xPortGetCoreID() & 1;
+    Base& b = base[core];
+    if (!b.set.load(std::memory_order_acquire)) {
+        b.cycles = ESP.getCycleCount();
+        b.us = esp_timer_get_time();
+        b.set.store(true, std::memory_order_release);
+    }
+    ProfileEvent& event = events[next.fetch_add(1, std::memory_order_relaxed) & (capacity - 1)];
+    event.name = name;
+    event.start = start;
+    event.cycles = end - start;
+    event.core = core;
+}
+
+uint32_t Profiler::getEventCount() const {
+    uint32_t n = next.load();
+    return n < capacity ? n : capacity;
+}
+
+uint32_t Profiler::getOverwritten() const {
+    uint32_t n = next.load();
+    return n > capacity ? n - capacity : 0;
+}
+
+// cursor: 0 = header, then events oldest first (16 per fragment), then the closing bracket
+bool Profiler::nextTraceFragment(uint32_t& cursor, String& out) const {
+    uint32_t count = events ? getEventCount() : 0;
+    if (cursor == 0) {
+        out += "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"captureMs\":" + String(durationMs) +
+               ",\"overwritten\":" + String(getOverwritten()) + ",\"cpuMHz\":" + String(cyclesPerUs) +
+               "},\"traceEvents\":["
+               "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"ESP32 MatrixShow\"}},"
+               "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"core 0 (WiFi, TCP)\"}},"
+               "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"core 1 (loop)\"}}";
+        cursor = 1;
+        return true;
+    }
+    if (cursor > count) {
+        if (cursor > count + 1) return false;
+        out += "]}";
+        cursor++;
+        return true;
+    }
+    uint32_t first = next.load() - count;  // Oldest event still in the ring
+    for (int n = 0; n < 16 && cursor <= count; n++, cursor++) {
+        appendEvent(events[(first + cursor - 1) & (capacity - 1)], out);
+    }
+    return true;
+}
+
+void Profiler::appendEvent(const ProfileEvent& event, String& out) const {
+    const Base& b = base[event.core];
+    if (!b.set.load(std::memory_order_acquire)) return;
+    // ns since the capture started. The cycle delta is unsigned - a 10 s capture is past
+    // 2^31 cycles - except just below 2^32, where the scope began shortly before this
+    // core's base was taken
+    uint32_t delta = event.start - b.cycles;
+    int64_t offset = delta > PROFILE_EARLY_CYCLES ? -(int64_t)(uint32_t)(0u - delta) : (int64_t)delta;
+    int64_t ns = (b.us - captureUs) * 1000 + offset * 1000 / cyclesPerUs;
+    if (ns < 0) ns = 0;
+    uint64_t durNs = (uint64_t)event.cycles * 1000 / cyclesPerUs;
+    char buf[160];
+    snprintf(buf, sizeof(buf), ",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%lu.%03u,\"dur\":%lu.%03u}",
+             event.name, (unsigned)event.core, (unsigned long)(ns / 1000), (unsigned)(ns % 1000),
+             (unsigned long)(durNs / 1000), (unsigned)(durNs % 1000));
+    out += buf;
+}
@@ -0,0 +1,100 @@
+/* Profiler.h
+   Scoped frame profiler with Chrome trace_event export
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Initial implementation
+
+   PROFILE_SCOPE("name") at the top of a block records one complete event - name, start
+   and length in CPU cycles, core - when the block exits. Events go into a ring allocated
+   when a capture starts (PSRAM when there is any); a slot is claimed with one atomic
+   add, so scopes on either core may record at once. Nested scopes nest in the viewer.
+   Outside a capture a scope costs one flag test on entry and one on exit; with
+   PROFILER_ENABLED false (Config.h) it compiles to nothing at all.
+   A capture runs for a given time (/api/profile?start=<ms>); the result is downloaded as
+   Chrome trace_event JSON (/api/profile?download=1) and opened in ui.perfetto.dev or
+   chrome://tracing. Cycle counts are per core and wrap after ~17 s at 240 MHz, so each
+   core's counter is pinned to esp_timer time (at start() for the loop core, at its first
+   event for the other) and captures are capped at PROFILE_MAX_MS.
+   Names must be string literals: only the pointer is stored.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "Config.h"
+
+struct ProfileEvent {
+    const char* name;
+    uint32_t start;   // CPU cycles
+    uint32_t cycles;
+    uint8_t core;
+};
+
+class Profiler {
+public:
+    Profiler() {}
+
+    // Loop task. false if a download is still reading the previous capture
+    bool start(uint32_t durationMs);
+    void stop() { active = false; }
+    void update();  // loop(): ends a capture when its time is up
+
+    bool isCapturing() const { return active; }
+    uint32_t getEventCount() const;      // In the ring
+    uint32_t getOverwritten() const;     // Oldest events lost to wrap-around
+    uint32_t getCapacity() const { return capacity; }
+    uint32_t getDurationMs() const { return durationMs; }
+
+    // Chrome trace JSON a fragment at a time (TCP task); cursor starts at 0. Returns false
+    // when done. beginExport/endExport bracket a download so start() waits for it.
+    void beginExport() { exporting.fetch_add(1); }
+    void endExport() { exporting.fetch_sub(1); }
+    bool nextTraceFragment(uint32_t& cursor, String& out) const;
+
+    void record(const char* name, uint32_t start, uint32_t end);
+
+    volatile bool active = false;
+
+private:
+    ProfileEvent* events = nullptr;
+    uint32_t capacity = 0;  // Power of two
+    std::atomic<uint32_t> next{0};
+    std::atomic<int> exporting{0};
+    uint32_t startMs = 0;
+    uint32_t durationMs = 0;
+    uint32_t cyclesPerUs = 240;
+
+    // Each core's counter at a known esp_timer time
+    struct Base {
+        std::atomic<bool> set{false};
+        uint32_t cycles = 0;
+        int64_t us = 0;
+    } base[2];
+    int64_t captureUs = 0;  // esp_timer at start(): ts 0 in the trace
+
+    void appendEvent(const ProfileEvent& event, String& out) const;
+};
+
+extern Profiler profiler;
+
+// Records the enclosing block; see above
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* n) : name(profiler.active ? n : nullptr) {
+        if (name) start = ESP.getCycleCount();
+    }
+    ~ProfileScope() {
+        if (name) profiler.record(name, start, ESP.getCycleCount());
+    }
+
+private:
+    const char* name;
+    uint32_t start = 0;
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) do {} while (0)
+#endif
@@ -0,0 +1,333 @@
+/* RealtimeProtocol.cpp
+   E1.31 and DDP parsing, sequence checks and frame boundaries
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Cut frames without the next frame's universe; terminate
+   checked after the universe range
+   V16.7.3-2026-01-14T18:00:00Z - Initial implementation
+*/
+
+#include "RealtimeProtocol.h"
+#include <string.h>
+
+// E1.31 offsets (ANSI E1.31-2018, section 4)
+#define E131_ROOT_VECTOR 18
+#define E131_FRAMING_VECTOR 40
+#define E131_SYNC_ADDRESS 109
+#define E131_SEQUENCE 111
+#define E131_OPTIONS 112
+#define E131_UNIVERSE 113
+#define E131_DMP_VECTOR 117
+#define E131_DMP_TYPE 118
+#define E131_VALUE_COUNT 123
+#define E131_START_CODE 125
+#define E131_SYNC_PACKET_ADDRESS 45
+#define E131_SYNC_PACKET_BYTES 49
+
+#define E131_VECTOR_ROOT_DATA 0x00000004
+#define E131_VECTOR_ROOT_EXTENDED 0x00000008
+#define E131_VECTOR_DATA_PACKET 0x00000002
+#define E131_VECTOR_EXTENDED_SYNC 0x00000001
+#define E131_OPTION_PREVIEW 0x80
+#define E131_OPTION_TERMINATED 0x40
+
+#define DDP_FLAG_VERSION_MASK 0xC0
+#define DDP_FLAG_VERSION_1 0x40
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_FLAG_QUERY 0x02
+#define DDP_FLAG_PUSH 0x01
+#define DDP_ID_DISPLAY 1
+#define DDP_ID_ALL 255
+#define DDP_TYPE_RGBW32 0x1B
+
+static const uint8_t ACN_ID[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+
+static inline uint16_t be16(const uint8_t* p) { return (uint16_t)((p[0] << 8) | p[1]); }
+static inline uint32_t be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+static inline uint64_t bit(int n) { return (uint64_t)1 << n; }
+
+bool RealtimeDecoder::begin(uint8_t* buffer, const uint16_t* pixelOrder, uint16_t pixels, uint16_t universe,
+                            uint16_t channelsPerUniverse) {
+    out = buffer;
+    order = pixelOrder;
+    pixelCount = pixels;
+    firstUniverse = universe;
+    uint16_t perUniverse = channelsPerUniverse / 3;
+    if (!out || pixels == 0 || perUniverse == 0 || perUniverse > 170) {
+        universeCount = 0;
+        return false;
+    }
+    uint32_t needed = ((uint32_t)pixels + perUniverse - 1) / perUniverse;
+    universeCount = needed < REALTIME_MAX_UNIVERSES ? needed : REALTIME_MAX_UNIVERSES;
+    for (uint16_t n = 0; n < universeCount; n++) {
+        uint32_t first = (uint32_t)n * perUniverse;
+        ranges[n].firstPixel = first;
+        ranges[n].pixels = pixels - first < perUniverse ? pixels - first : perUniverse;
+    }
+    resetSession();
+    resetStats();
+    return needed <= REALTIME_MAX_UNIVERSES;  // Otherwise the tail is DDP-only
+}
+
+void RealtimeDecoder::resetSession() {
+    e131SeqSeen = 0;
+    ddpSeq = 0;
+    received = 0;
+    expected = universeCount >= 64 ? ~(uint64_t)0 : bit(universeCount) - 1;
+    sent = 0;
+    windowFrames = 0;
+    syncAddress = 0;
+    pending = false;
+    carryUniverse = -1;
+}
+
+void RealtimeDecoder::resetStats() {
+    stats = RealtimeStats();
+}
+
+RealtimeResult RealtimeDecoder::handle(RealtimeSource source, const uint8_t* packet, size_t len, uint32_t nowUs) {
+    stats.packets++;
+    now = nowUs;
+    RealtimeResult result = source == RT_DDP ? handleDdp(packet, len) : handleE131(packet, len);
+    if (result == RT_IGNORED) stats.ignored++;
+    return result;
+}
+
+RealtimeResult RealtimeDecoder::handleE131(const uint8_t* p, size_t len) {
+    if (len < E131_SYNC_PACKET_BYTES || be16(p) != 0x0010 || memcmp(p + 4, ACN_ID, sizeof(ACN_ID)) != 0) {
+        stats.malformed++;
+        return RT_DROPPED;
+    }
+
+    uint32_t rootVector = be32(p + E131_ROOT_VECTOR);
+    if (rootVector == E131_VECTOR_ROOT_EXTENDED) {
+        // Sync or universe discovery; only sync matters
+        if (be32(p + E131_FRAMING_VECTOR) != E131_VECTOR_EXTENDED_SYNC) return RT_IGNORED;
+        stats.syncPackets++;
+        uint16_t address = be16(p + E131_SYNC_PACKET_ADDRESS);
+        if (!pending || address == 0 || address != syncAddress) return RT_IGNORED;
+        return endFrame();
+    }
+
+    if (rootVector != E131_VECTOR_ROOT_DATA || len < E131_HEADER_BYTES ||
+        be32(p + E131_FRAMING_VECTOR) != E131_VECTOR_DATA_PACKET || p[E131_DMP_VECTOR] != 0x02 ||
+        p[E131_DMP_TYPE] != 0xA1) {
+        stats.malformed++;
+        return RT_DROPPED;
+    }
+    int n = (int)be16(p + E131_UNIVERSE) - firstUniverse;
+    if (n < 0 || n >= universeCount) return RT_IGNORED;  // Before termination: another stream's
+    uint8_t options = p[E131_OPTIONS];
+    if (options & E131_OPTION_TERMINATED) return RT_TERMINATED;
+    if ((options & E131_OPTION_PREVIEW) || p[E131_START_CODE] != 0) return RT_IGNORED;
+
+    // Late or repeated: within 20 behind the last one (E1.31 6.7.2)
+    uint8_t seq = p[E131_SEQUENCE];
+    if (e131SeqSeen & bit(n)) {
+        int8_t diff = (int8_t)(seq - e131Seq[n]);
+        if (diff <= 0 && diff > -20) {
+            stats.outOfOrder++;
+            return RT_DROPPED;
+        }
+        if (diff > 1) stats.lost += diff - 1;
+    }
+    e131Seq[n] = seq;
+    e131SeqSeen |= bit(n);
+
+    uint16_t values = be16(p + E131_VALUE_COUNT);  // Start code + channels
+    if (values < 1 || E131_HEADER_BYTES + (size_t)values - 1 > len) {
+        stats.malformed++;
+        return RT_DROPPED;
+    }
+    uint32_t pixels = (values - 1) / 3;
+    if (pixels > ranges[n].pixels) pixels = ranges[n].pixels;
+
+    // Unsynchronized, a universe seen twice means the rest of the frame is not coming.
+    // The frame goes out as it is; this packet is held until frameShown().
+    syncAddress = be16(p + E131_SYNC_ADDRESS);
+    if (!syncAddress && (received & bit(n))) {
+        if (carryUniverse >= 0) applyCarry();  // Held since a cut that was never shown: this frame's
+        stats.partialFrames++;
+        nextFrame();
+        carryUniverse = n;
+        carryPixels = pixels;
+        carryUs = now;
+        memcpy(carry, p + E131_HEADER_BYTES, pixels * 3);
+        return RT_FRAME;
+    }
+    if (carryUniverse == n) carryUniverse = -1;  // Newer channels for the held universe
+    storeUniverse(n, p + E131_HEADER_BYTES, pixels);
+    if (syncAddress) return RT_DATA;  // Shown on the sync packet
+    if ((received & expected) == expected) return endFrame();
+    // The last universe ends the frame even when one before it was lost; waiting for the
+    // next frame instead would leave every later frame ending a universe late
+    if ((expected >> n) == 1) {
+        stats.partialFrames++;
+        nextFrame();
+        return RT_FRAME;
+    }
+    return RT_DATA;
+}
+
+RealtimeResult RealtimeDecoder::handleDdp(const uint8_t* p, size_t len) {
+    if (len < DDP_HEADER_BYTES || (p[0] & DDP_FLAG_VERSION_MASK) != DDP_FLAG_VERSION_1) {
+        stats.malformed++;
+        return RT_DROPPED;
+    }
+    uint8_t flags = p[0];
+    if ((flags & DDP_FLAG_QUERY) || (p[3] != DDP_ID_DISPLAY && p[3] != DDP_ID_ALL) || p[2] == DDP_TYPE_RGBW32) {
+        return RT_IGNORED;
+    }
+    size_t header = (flags & DDP_FLAG_TIMECODE) ? DDP_HEADER_BYTES + 4 : DDP_HEADER_BYTES;
+    uint32_t offset = be32(p + 4);
+    uint16_t length = be16(p + 8);
+    if (len < header || header + length > len) {
+        stats.malformed++;
+        return RT_DROPPED;
+    }
+
+    // 1-15, wrapping past 0 (not used). Some senders number frames rather than packets,
+    // so an unchanged number is accepted; only a step back is late.
+    uint8_t seq = p[1] & 0x0F;
+    if (seq) {
+        if (ddpSeq) {
+            uint8_t step = (uint8_t)((seq + 15 - ddpSeq) % 15);
+            if (step > 7) {
+                stats.outOfOrder++;
+                return RT_DROPPED;
+            }
+            if (step > 1) stats.lost += step - 1;
+        }
+        ddpSeq = seq;
+    }
+
+    if (length) {
+        writeBytes(offset, p + header, length);
+        stats.ddpPackets++;
+        markData();
+    }
+    if ((flags & DDP_FLAG_PUSH) && pending) return endFrame();
+    return length ? RT_DATA : RT_IGNORED;
+}
+
+void RealtimeDecoder::storeUniverse(int n, const uint8_t* rgb, uint32_t pixels) {
+    writePixels(ranges[n].firstPixel, rgb, pixels);
+    stats.e131Packets++;
+    markData();
+    received |= bit(n);
+    sent |= bit(n);
+    expected |= bit(n);
+}
+
+void RealtimeDecoder::applyCarry() {
+    uint32_t packetUs = now;
+    now = carryUs;  // Latency counts from the packet's arrival
+    storeUniverse(carryUniverse, carry, carryPixels);
+    now = packetUs;
+    carryUniverse = -1;
+}
+
+void RealtimeDecoder::markData() {
+    if (!pending) {
+        pending = true;
+        frameStartUs = now;
+    }
+}
+
+RealtimeResult RealtimeDecoder::endFrame() {
+    stats.frames++;
+    nextFrame();
+    return RT_FRAME;
+}
+
+// Universes the sender left out of a whole window of frames are not waited for
+void RealtimeDecoder::nextFrame() {
+    received = 0;
+    if (++windowFrames < REALTIME_EXPECT_WINDOW) return;
+    if (sent) expected = sent;
+    sent = 0;
+    windowFrames = 0;
+}
+
+bool RealtimeDecoder::frameStale(uint32_t nowUs, uint32_t maxUs) const {
+    return pending && nowUs - frameStartUs > maxUs;
+}
+
+uint32_t RealtimeDecoder::frameShown(uint32_t nowUs, bool stale) {
+    if (stale) {
+        stats.partialFrames++;
+        nextFrame();
+    }
+    uint32_t us = 0;
+    if (pending) {
+        us = nowUs - frameStartUs;
+        stats.latencyCount++;
+        stats.latencySumUs += us;
+        if (us > stats.latencyMaxUs) stats.latencyMaxUs = us;
+        pending = false;
+    }
+    if (carryUniverse >= 0) applyCarry();  // First universe of the next frame
+    return us;
+}
+
+void RealtimeDecoder::writePixels(uint32_t pixel, const uint8_t* rgb, uint32_t count) {
+    if (pixel >= pixelCount) return;
+    if (count > pixelCount - pixel) count = pixelCount - pixel;
+    if (!order) {
+        memcpy(out + pixel * 3, rgb, count * 3);
+        return;
+    }
+    const uint16_t* to = order + pixel;
+    for (uint32_t i = 0; i < count; i++, rgb += 3) {
+        uint8_t* dst = out + (uint32_t)to[i] * 3;
+        dst[0] = rgb[0];
+        dst[1] = rgb[1];
+        dst[2] = rgb[2];
+    }
+}
+
+// DDP offsets are in bytes and need not start or end on a pixel
+void RealtimeDecoder::writeBytes(uint32_t offset, const uint8_t* data, uint32_t count) {
+    uint32_t total = (uint32_t)pixelCount * 3;
+    if (offset >= total) return;
+    if (count > total - offset) count = total - offset;
+    if (!order) {
+        memcpy(out + offset, data, count);
+        return;
+    }
+    for (; count && offset % 3; count--, offset++) {
+        out[(uint32_t)order[offset / 3] * 3 + offset % 3] = *data++;
+    }
+    uint32_t whole = count / 3;
+    writePixels(offset / 3, data, whole);
+    data += whole * 3;
+    offset += whole * 3;
+    for (count -= whole * 3; count; count--, offset++) {
+        out[(uint32_t)order[offset / 3] * 3 + offset % 3] = *data++;
+    }
+}
+
+#ifdef REALTIME_HOST_EXPORT
+static RealtimeDecoder hostDecoder;
+
+extern "C" int realtime_begin(uint8_t* out, const uint16_t* order, uint16_t pixelCount, uint16_t firstUniverse,
+                              uint16_t channelsPerUniverse) {
+    return hostDecoder.begin(out, order, pixelCount, firstUniverse, channelsPerUniverse);
+}
+
+extern "C" int realtime_handle(int source, const uint8_t* packet, size_t len, uint32_t nowUs) {
+    return hostDecoder.handle((RealtimeSource)source, packet, len, nowUs);
+}
+
+extern "C" int realtime_frame_stale(uint32_t nowUs, uint32_t maxUs) {
+    return hostDecoder.frameStale(nowUs, maxUs);
+}
+
+extern "C" uint32_t realtime_frame_shown(uint32_t nowUs, int stale) {
+    return hostDecoder.frameShown(nowUs, stale != 0);
+}
+
+extern "C" void realtime_stats(RealtimeStats* stats) {
+    *stats = hostDecoder.getStats();
+}
+#endif
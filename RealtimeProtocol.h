@@ -0,0 +1,152 @@
+/* RealtimeProtocol.h
+   E1.31 (sACN) and DDP packet decoding straight into the framebuffer
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - A cut frame is shown without the packet that cut it;
+   stream termination only from our universes
+   V16.7.3-2026-01-14T18:00:00Z - Initial implementation
+
+   Plain C++ with no Arduino or FastLED dependency, so a host build (tools/realtime_sim.py
+   compiles this file into a shared library) decodes exactly what the firmware does.
+
+   The stream is pixelCount RGB triplets. E1.31 universe firstUniverse + n carries stream
+   pixels [n * ppu, n * ppu + ppu), ppu = channelsPerUniverse / 3; that universe -> pixel
+   range table is built once in begin(). DDP addresses the same stream by byte offset.
+   Channel data is copied from the packet into out[] - through order[] (stream pixel ->
+   out pixel) when given, with memcpy of whole ranges when not. Nothing is staged.
+
+   Frames end on:
+     E1.31  a sync packet for the sync address the data named, or - unsynchronized - when
+            every universe the sender uses has arrived (learned over REALTIME_EXPECT_WINDOW
+            frames); the last universe or a repeated one ends a frame that lost a packet.
+            A repeated universe belongs to the next frame: its channels are held back and
+            written by frameShown(), once the frame it ended is out
+     DDP    a packet with the push flag
+     either frameStale(): a partial frame waiting longer than the caller allows
+   Sequence numbers are per universe for E1.31 (late or repeated packets within 20 of
+   the last one are discarded, as the standard asks) and per stream for DDP (4 bits,
+   0 = not used). Gaps count as lost packets.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define E131_PORT 5568
+#define DDP_PORT 4048
+#define E131_HEADER_BYTES 126         // Up to and including the DMX start code
+#define E131_MAX_PACKET (E131_HEADER_BYTES + 512)
+#define DDP_HEADER_BYTES 10           // 14 with the timecode flag
+#define DDP_MAX_PACKET (14 + 1440)
+#define REALTIME_MAX_UNIVERSES 64     // One bit each in the frame masks
+#define REALTIME_EXPECT_WINDOW 16     // Frames over which the sender's universe set is learned
+
+enum RealtimeSource : uint8_t {
+    RT_E131 = 0,
+    RT_DDP = 1
+};
+
+enum RealtimeResult : uint8_t {
+    RT_IGNORED = 0,   // Not for us: other universe, preview data, discovery, DDP query
+    RT_DROPPED,       // Malformed, late or repeated; counted in the stats
+    RT_DATA,          // Channels written; the frame is not complete
+    RT_FRAME,         // Channels (if any) written and the frame is complete: show it
+    RT_TERMINATED     // The E1.31 source ended its stream
+};
+
+struct RealtimeStats {
+    uint32_t packets;        // Every packet handed in
+    uint32_t e131Packets;    // Data packets written
+    uint32_t ddpPackets;
+    uint32_t syncPackets;
+    uint32_t frames;         // Completed by sync, push or a full set of universes
+    uint32_t partialFrames;  // Shown with a universe missing, or by frameStale()
+    uint32_t lost;           // Sequence gaps
+    uint32_t outOfOrder;     // Late or repeated, discarded
+    uint32_t malformed;
+    uint32_t ignored;
+    uint32_t latencyCount;   // First packet of a frame -> frameShown()
+    uint32_t latencyMaxUs;
+    uint64_t latencySumUs;
+};
+
+struct UniverseRange {
+    uint16_t firstPixel;
+    uint16_t pixels;
+};
+
+class RealtimeDecoder {
+public:
+    // out: pixelCount RGB triplets. order: stream pixel -> out pixel, or nullptr when the
+    // stream is already in out[] order. channelsPerUniverse is rounded down to whole pixels.
+    bool begin(uint8_t* out, const uint16_t* order, uint16_t pixelCount, uint16_t firstUniverse,
+               uint16_t channelsPerUniverse);
+
+    RealtimeResult handle(RealtimeSource source, const uint8_t* packet, size_t len, uint32_t nowUs);
+
+    // A frame has data but no end after maxUs (sync never came, universes missing)
+    bool frameStale(uint32_t nowUs, uint32_t maxUs) const;
+    bool framePending() const { return pending; }
+    // After the frame is on the wire: next packet starts a new frame (a held-back universe
+    // is written now). Returns the latency (first packet -> now), 0 if nothing was pending.
+    // stale: shown by frameStale().
+    uint32_t frameShown(uint32_t nowUs, bool stale);
+
+    // Forget sequence numbers and the expected universe set (a new session)
+    void resetSession();
+    void resetStats();
+
+    const RealtimeStats& getStats() const { return stats; }
+    uint16_t getUniverseCount() const { return universeCount; }
+    uint16_t getFirstUniverse() const { return firstUniverse; }
+    const UniverseRange& getRange(int n) const { return ranges[n]; }
+    uint16_t getSyncAddress() const { return syncAddress; }   // Of the last data packet; 0 = none
+
+private:
+    uint8_t* out = nullptr;
+    const uint16_t* order = nullptr;
+    uint16_t pixelCount = 0;
+    uint16_t firstUniverse = 1;
+    uint16_t universeCount = 0;
+    UniverseRange ranges[REALTIME_MAX_UNIVERSES] = {};
+
+    uint8_t e131Seq[REALTIME_MAX_UNIVERSES] = {};
+    uint64_t e131SeqSeen = 0;
+    uint8_t ddpSeq = 0;              // 0 = none yet
+    uint64_t received = 0;           // Universes written this frame
+    uint64_t expected = 0;           // Universes that make a frame
+    uint64_t sent = 0;               // Universes seen in this window
+    uint8_t windowFrames = 0;
+    uint16_t syncAddress = 0;
+    bool pending = false;            // Data written since the last frameShown()
+    uint32_t frameStartUs = 0;
+    uint32_t now = 0;                // Of the packet being handled
+    RealtimeStats stats = {};
+
+    // V16.7.4-2026-01-15T09:00:00Z - Universe that cut the frame, until frameShown()
+    int16_t carryUniverse = -1;      // -1 = none
+    uint16_t carryPixels = 0;
+    uint32_t carryUs = 0;
+    uint8_t carry[170 * 3];
+
+    RealtimeResult handleE131(const uint8_t* p, size_t len);
+    RealtimeResult handleDdp(const uint8_t* p, size_t len);
+    void storeUniverse(int n, const uint8_t* rgb, uint32_t pixels);
+    void applyCarry();
+    void writePixels(uint32_t pixel, const uint8_t* rgb, uint32_t count);
+    void writeBytes(uint32_t offset, const uint8_t* data, uint32_t count);
+    void markData();
+    void nextFrame();
+    RealtimeResult endFrame();
+};
+
+#ifdef REALTIME_HOST_EXPORT
+// One decoder for tools/realtime_sim.py (ctypes)
+extern "C" {
+int realtime_begin(uint8_t* out, const uint16_t* order, uint16_t pixelCount, uint16_t firstUniverse,
+                   uint16_t channelsPerUniverse);
+int realtime_handle(int source, const uint8_t* packet, size_t len, uint32_t nowUs);
+int realtime_frame_stale(uint32_t nowUs, uint32_t maxUs);
+uint32_t realtime_frame_shown(uint32_t nowUs, int stale);
+void realtime_stats(RealtimeStats* stats);
+}
+#endif
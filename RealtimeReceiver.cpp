@@ -0,0 +1,184 @@
+/* RealtimeReceiver.cpp
+   UDP listeners, frame presentation and hand-back to scheduled content
+   VERSION: V16.7.3-2026-01-14T18:00:00Z - Initial implementation
+*/
+
+#include "RealtimeReceiver.h"
+#include "MatrixDisplay.h"
+#include "ContentManager.h"
+#include "ZoneManager.h"
+#include "TraceLog.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include <WiFi.h>
+#include <Preferences.h>
+#include <esp_timer.h>
+
+RealtimeReceiver realtime;
+
+static_assert(REALTIME_UNIVERSE_CHANNELS % 3 == 0 && REALTIME_UNIVERSE_CHANNELS <= 512,
+              "REALTIME_UNIVERSE_CHANNELS must be whole pixels within one universe");
+
+void RealtimeReceiver::begin(MatrixDisplay* display, ContentManager* content) {
+    disp = display;
+    contentMgr = content;
+
+    Preferences prefs;
+    prefs.begin("matrixshow", true);
+    enabled = prefs.getBool("rtEnabled", REALTIME_ENABLED);
+    prefs.end();
+
+    const uint16_t* pixelOrder = nullptr;
+#if REALTIME_ROW_ORDER
+    // Same walk as the live preview: canvas x across both windows, matrix 1 (left) first
+    const int width = MATRIX_COUNT * COLS;
+    for (int p = 0; p < REALTIME_PIXELS; p++) {
+        int x = p % width;
+        int y = p / width;
+        const uint16_t* table = disp->getIndexTable(MATRIX_COUNT - 1 - x / COLS);
+        order[p] = table ? table[y * COLS + x % COLS] : 0;
+    }
+    pixelOrder = order;
+#endif
+    if (!decoder.begin((uint8_t*)disp->getLeds(), pixelOrder, REALTIME_PIXELS, REALTIME_UNIVERSE,
+                       REALTIME_UNIVERSE_CHANNELS)) {
+        LOG_E("[Realtime] %d pixels need more than %d universes", REALTIME_PIXELS, REALTIME_MAX_UNIVERSES);
+    }
+
+    e131.onPacket([this](AsyncUDPPacket& packet) { onPacket(RT_E131, packet.data(), packet.length()); });
+    ddp.onPacket([this](AsyncUDPPacket& packet) { onPacket(RT_DDP, packet.data(), packet.length()); });
+    LOG_I("[Realtime] Universes %d-%d (%d channels each), DDP %d pixels, %s",
+          REALTIME_UNIVERSE, REALTIME_UNIVERSE + decoder.getUniverseCount() - 1, REALTIME_UNIVERSE_CHANNELS,
+          REALTIME_PIXELS, enabled ? "enabled" : "disabled");
+}
+
+void RealtimeReceiver::listen() {
+    listening = true;  // Once; a port that failed stays failed until reboot
+    if (!e131.listen(E131_PORT)) LOG_E("[Realtime] Cannot listen on UDP %d (E1.31)", E131_PORT);
+    if (!ddp.listen(DDP_PORT)) LOG_E("[Realtime] Cannot listen on UDP %d (DDP)", DDP_PORT);
+}
+
+// WiFi task. The decoder writes leds[] here, so the display is only touched by loop()
+// once it has been taken over (activate()).
+void RealtimeReceiver::onPacket(RealtimeSource from, const uint8_t* data, size_t len) {
+    if (!enabled) return;
+    uint32_t now = (uint32_t)esp_timer_get_time();
+    portENTER_CRITICAL(&lock);
+    RealtimeResult result = decoder.handle(from, data, len, now);
+    portEXIT_CRITICAL(&lock);
+
+    if (result == RT_DATA || result == RT_FRAME) {
+        source = from;
+        lastPacketMs = millis();
+        packetSeen = true;
+        if (result == RT_FRAME) frameReady = true;
+    } else if (result == RT_TERMINATED) {
+        terminated = true;
+    }
+}
+
+void RealtimeReceiver::update() {
+    if (!disp || !enabled) return;
+    if (!listening) {
+        if (WiFi.status() != WL_CONNECTED) return;
+        listen();
+    }
+
+    unsigned long nowMs = millis();
+    if (nowMs - rateMark >= 1000) {
+        RealtimeStats stats = getStats();
+        packetsPerSecond = (stats.packets - ratePackets) * 1000 / (nowMs - rateMark);
+        framesPerSecond = (stats.frames + stats.partialFrames - rateFrames) * 1000 / (nowMs - rateMark);
+        ratePackets = stats.packets;
+        rateFrames = stats.frames + stats.partialFrames;
+        rateMark = nowMs;
+    }
+
+    if (!active) {
+        if (!packetSeen) return;
+        activate();
+    }
+    if (terminated || nowMs - lastPacketMs > REALTIME_TIMEOUT_MS) {
+        release(terminated ? "Stream terminated" : "No packets");
+        return;
+    }
+
+    bool stale = false;
+    if (!frameReady) {
+        portENTER_CRITICAL(&lock);
+        stale = decoder.frameStale((uint32_t)esp_timer_get_time(), REALTIME_FRAME_HOLD_MS * 1000UL);
+        portEXIT_CRITICAL(&lock);
+        if (!stale) return;
+    }
+    frameReady = false;  // Before show(): a frame completing meanwhile is shown next pass
+    {
+        PROFILE_SCOPE("Realtime frame");
+        disp->show();
+    }
+    portENTER_CRITICAL(&lock);
+    uint32_t us = decoder.frameShown((uint32_t)esp_timer_get_time(), stale);
+    portEXIT_CRITICAL(&lock);
+    if (us) latency.observe(us);
+}
+
+void RealtimeReceiver::activate() {
+    active = true;
+    // Packets are RGB for the whole display: no palette expansion, no item effects
+    disp->setIndexedMode(false);
+    disp->setPostFx(PostFxSettings());
+    LOG_I("[Realtime] %s stream: display taken over", source == RT_DDP ? "DDP" : "E1.31");
+    traceLog.event(TRACE_REALTIME, 1, source);
+}
+
+void RealtimeReceiver::release(const char* why) {
+    active = false;
+    packetSeen = false;
+    terminated = false;
+    frameReady = false;
+    portENTER_CRITICAL(&lock);
+    decoder.resetSession();
+    portEXIT_CRITICAL(&lock);
+    LOG_I("[Realtime] %s: back to scheduled content", why);
+    traceLog.event(TRACE_REALTIME, 0, source);
+
+    // Zones that were playing start over; otherwise whatever played last comes back
+    bool zonesPlaying = false;
+    for (int z = 0; z < zones.getZoneCount(); z++) {
+        if (zones.getPlayer(z).isActive()) {
+            uint16_t id = zones.getPlayer(z).getItem().id;
+            zones.play(z, id);
+            zonesPlaying = true;
+        }
+    }
+    if (!zonesPlaying) {
+        disp->clear();
+        disp->show();
+        if (contentMgr->getLastRenderedId()) contentMgr->renderContent(contentMgr->getLastRenderedId());
+    }
+}
+
+void RealtimeReceiver::setEnabled(bool on) {
+    if (on == enabled) return;
+    enabled = on;
+    Preferences prefs;
+    prefs.begin("matrixshow", false);
+    prefs.putBool("rtEnabled", on);
+    prefs.end();
+    if (!on && active) release("Realtime input disabled");
+    LOG_I("[Realtime] %s", on ? "Enabled" : "Disabled");
+}
+
+RealtimeStats RealtimeReceiver::getStats() {
+    portENTER_CRITICAL(&lock);
+    RealtimeStats stats = decoder.getStats();
+    portEXIT_CRITICAL(&lock);
+    return stats;
+}
+
+void RealtimeReceiver::resetStats() {
+    portENTER_CRITICAL(&lock);
+    decoder.resetStats();
+    portEXIT_CRITICAL(&lock);
+    latency = Histogram();
+    ratePackets = rateFrames = 0;
+}
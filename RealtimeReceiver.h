@@ -0,0 +1,89 @@
+/* RealtimeReceiver.h
+   E1.31 (sACN) and DDP input from xLights, written straight into the framebuffer
+   VERSION: V16.7.3-2026-01-14T18:00:00Z - Initial implementation
+
+   Two AsyncUDP listeners - E1.31 unicast on port 5568, DDP on 4048 - hand each packet to
+   RealtimeDecoder (RealtimeProtocol.h) on the WiFi task, which copies its channels from
+   the packet buffer into MatrixDisplay's leds[]. The first packet takes the display
+   over: loop() stops stepping zones and content and shows each frame when it completes
+   (sync packet, DDP push, or every universe in), or REALTIME_FRAME_HOLD_MS after its
+   first packet if it never does. REALTIME_TIMEOUT_MS without packets, or an E1.31
+   stream-terminated flag, hands the display back: zones that were playing restart,
+   otherwise the last content item is rendered again.
+   Stream layout with REALTIME_ROW_ORDER: row-major over both windows, left window first,
+   as in the live preview - in xLights a 40 x 25 matrix model, horizontal, starting top
+   left. Without it the stream is leds[] in wiring order and ranges are copied with memcpy.
+   A packet landing during show()'s color pass can put one universe of the next frame into
+   the frame being sent; a sender's frame interval is many times that pass.
+   Output gamma (/api/color) still applies - set it to 1.0 if xLights corrects already.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include <freertos/FreeRTOS.h>
+#include "Config.h"
+#include "Metrics.h"
+#include "RealtimeProtocol.h"
+
+class MatrixDisplay;
+class ContentManager;
+
+#define REALTIME_PIXELS (MATRIX_COUNT * MATRIX_LEDS)
+
+class RealtimeReceiver {
+public:
+    RealtimeReceiver() {}
+
+    void begin(MatrixDisplay* display, ContentManager* content);
+    // loop(): listen once WiFi is up, show completed frames, hand back on timeout
+    void update();
+
+    bool isActive() const { return active; }
+    bool isEnabled() const { return enabled; }
+    void setEnabled(bool on);  // Saved; off also hands the display back
+    RealtimeSource getSource() const { return source; }
+    uint16_t getUniverseCount() const { return decoder.getUniverseCount(); }
+    uint16_t getSyncAddress() const { return decoder.getSyncAddress(); }
+
+    RealtimeStats getStats();  // Copy taken under the lock
+    void resetStats();
+    uint32_t getPacketsPerSecond() const { return packetsPerSecond; }
+    uint32_t getFramesPerSecond() const { return framesPerSecond; }
+    const Histogram& getLatency() const { return latency; }  // First packet -> show() done
+
+private:
+    MatrixDisplay* disp = nullptr;
+    ContentManager* contentMgr = nullptr;
+    AsyncUDP e131;
+    AsyncUDP ddp;
+    RealtimeDecoder decoder;          // Shared with the WiFi task: only under lock
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+#if REALTIME_ROW_ORDER
+    uint16_t order[REALTIME_PIXELS];  // Stream pixel -> leds[] index
+#endif
+
+    volatile bool enabled = REALTIME_ENABLED;
+    volatile bool active = false;
+    volatile bool frameReady = false;   // Set by the WiFi task, cleared by loop()
+    volatile bool terminated = false;
+    volatile bool packetSeen = false;
+    volatile uint32_t lastPacketMs = 0;
+    volatile RealtimeSource source = RT_E131;
+    bool listening = false;
+
+    Histogram latency;
+    uint32_t packetsPerSecond = 0;
+    uint32_t framesPerSecond = 0;
+    uint32_t rateMark = 0;
+    uint32_t ratePackets = 0;
+    uint32_t rateFrames = 0;
+
+    void listen();
+    void onPacket(RealtimeSource from, const uint8_t* data, size_t len);
+    void activate();
+    void release(const char* why);
+};
+
+extern RealtimeReceiver realtime;
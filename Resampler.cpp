@@ -0,0 +1,146 @@
+/* Resampler.cpp
+   Resampling map construction, cache and apply
+   VERSION: V16.5.6-2026-01-13T03:00:00Z - Initial implementation
+*/
+
+#include "Resampler.h"
+#include "Logger.h"
+
+namespace Resampler {
+
+namespace {
+
+ResampleMap cache[RESAMPLE_CACHE_SIZE];
+uint32_t useCounter = 0;
+
+void freeMap(ResampleMap& map) {
+    free(map.index);
+    free(map.wx);
+    free(map.wy);
+    map.index = nullptr;
+    map.wx = nullptr;
+    map.wy = nullptr;
+}
+
+// Destination pixel center -> continuous source coordinate, pixel centers aligned
+float toSource(int d, int dstSize, int srcSize) {
+    return (d + 0.5f) * srcSize / dstSize - 0.5f;
+}
+
+bool buildMap(ResampleMap& map) {
+    int n = map.dstCols * map.dstRows;
+    bool bilinear = map.mode == RESAMPLE_BILINEAR;
+    map.index = (uint16_t*)malloc(n * sizeof(uint16_t));
+    map.wx = bilinear ? (uint8_t*)malloc(n) : nullptr;
+    map.wy = bilinear ? (uint8_t*)malloc(n) : nullptr;
+    if (!map.index || (bilinear && (!map.wx || !map.wy))) {
+        freeMap(map);
+        return false;
+    }
+
+    // Orientation acts on the source: its oriented size is what gets scaled
+    bool transpose = map.orient & ORIENT_TRANSPOSE;
+    int orientedCols = transpose ? map.srcRows : map.srcCols;
+    int orientedRows = transpose ? map.srcCols : map.srcRows;
+
+    for (int y = 0; y < map.dstRows; y++) {
+        for (int x = 0; x < map.dstCols; x++) {
+            float u = toSource(x, map.dstCols, orientedCols);
+            float v = toSource(y, map.dstRows, orientedRows);
+            if (map.orient & ORIENT_FLIP_X) u = orientedCols - 1 - u;
+            if (map.orient & ORIENT_FLIP_Y) v = orientedRows - 1 - v;
+            float sx = transpose ? v : u;
+            float sy = transpose ? u : v;
+
+            int i = y * map.dstCols + x;
+            if (!bilinear) {
+                int ix = constrain((int)lroundf(sx), 0, map.srcCols - 1);
+                int iy = constrain((int)lroundf(sy), 0, map.srcRows - 1);
+                map.index[i] = (uint16_t)(iy * map.srcCols + ix);
+                continue;
+            }
+
+            // Top-left tap kept one in from the right/bottom edge so +1 / +cols stay inside
+            sx = constrain(sx, 0.0f, (float)(map.srcCols - 1));
+            sy = constrain(sy, 0.0f, (float)(map.srcRows - 1));
+            int x0 = min((int)sx, map.srcCols - 2);
+            int y0 = min((int)sy, map.srcRows - 2);
+            map.index[i] = (uint16_t)(y0 * map.srcCols + x0);
+            map.wx[i] = (uint8_t)min(255.0f, (sx - x0) * 256.0f);
+            map.wy[i] = (uint8_t)min(255.0f, (sy - y0) * 256.0f);
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+const ResampleMap* getMap(int srcCols, int srcRows, int dstCols, int dstRows,
+                          ResampleMode mode, uint8_t orient) {
+    // Bilinear needs a 2x2 neighbourhood
+    if (srcCols < 2 || srcRows < 2) mode = RESAMPLE_NEAREST;
+
+    ResampleMap* victim = &cache[0];
+    for (auto& map : cache) {
+        if (map.index && map.srcCols == srcCols && map.srcRows == srcRows &&
+            map.dstCols == dstCols && map.dstRows == dstRows &&
+            map.mode == mode && map.orient == orient) {
+            map.lastUsed = ++useCounter;
+            return &map;
+        }
+        if (!map.index) victim = &map;                      // Prefer an empty slot...
+        else if (victim->index && map.lastUsed < victim->lastUsed) victim = &map;  // ...else LRU
+    }
+
+    freeMap(*victim);
+    victim->srcCols = srcCols;
+    victim->srcRows = srcRows;
+    victim->dstCols = dstCols;
+    victim->dstRows = dstRows;
+    victim->mode = mode;
+    victim->orient = orient;
+    victim->lastUsed = ++useCounter;
+    if (!buildMap(*victim)) {
+        Logger::instance().log("[Resampler] Out of memory for " + String(srcCols) + "x" + String(srcRows) +
+                               " -> " + String(dstCols) + "x" + String(dstRows));
+        return nullptr;
+    }
+    return victim;
+}
+
+bool present(const CRGB* src, int srcCols, int srcRows,
+             CRGB* leds, const uint16_t* dstIndex, int dstCols, int dstRows,
+             ResampleMode mode, uint8_t orient) {
+    const ResampleMap* map = getMap(srcCols, srcRows, dstCols, dstRows, mode, orient);
+    if (!map || !dstIndex) return false;
+    int n = dstCols * dstRows;
+
+    if (map->mode == RESAMPLE_NEAREST) {
+        for (int i = 0; i < n; i++) {
+            leds[dstIndex[i]] = src[map->index[i]];
+        }
+        return true;
+    }
+
+    for (int i = 0; i < n; i++) {
+        const CRGB* p = src + map->index[i];
+        uint8_t fx = map->wx[i];
+        uint8_t fy = map->wy[i];
+        CRGB top = blend(p[0], p[1], fx);
+        CRGB bottom = blend(p[srcCols], p[srcCols + 1], fx);
+        leds[dstIndex[i]] = blend(top, bottom, fy);
+    }
+    return true;
+}
+
+uint8_t parseOrientation(const String& name) {
+    if (name == "mirror") return ORIENT_FLIP_X;
+    if (name == "flip") return ORIENT_FLIP_Y;
+    if (name == "rot90") return ORIENT_ROT90;
+    if (name == "rot180") return ORIENT_ROT180;
+    if (name == "rot270") return ORIENT_ROT270;
+    if (name == "transpose") return ORIENT_TRANSPOSE;
+    return ORIENT_NONE;
+}
+
+} // namespace Resampler
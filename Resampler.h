@@ -0,0 +1,62 @@
+/* Resampler.h
+   Resolution-independent content: precomputed resampling maps between grid sizes
+   VERSION: V16.5.6-2026-01-13T03:00:00Z - Initial implementation
+
+   Content draws into a row-major canvas at its native size (scenes are authored at
+   20x25); Resampler::present() maps that canvas onto an output of any size.
+   For each (source size, destination size, mode, orientation) a map is built once
+   and kept in a small LRU cache:
+     nearest   one source index per destination pixel
+     bilinear  top-left source index + 8-bit x/y weights per destination pixel
+   Orientation (mirror, flip, transpose, rotations) is applied while the map is built,
+   so it costs nothing per frame. Destination pixels are written through the output's
+   index table, i.e. straight into wiring order.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#define RESAMPLE_CACHE_SIZE 6
+
+enum ResampleMode : uint8_t {
+    RESAMPLE_NEAREST = 0,
+    RESAMPLE_BILINEAR = 1
+};
+
+// Orientation bits, applied to the source: transpose first, then flips
+#define ORIENT_NONE      0
+#define ORIENT_FLIP_X    0x01   // Mirror left/right
+#define ORIENT_FLIP_Y    0x02   // Upside down
+#define ORIENT_TRANSPOSE 0x04
+#define ORIENT_ROT90     (ORIENT_TRANSPOSE | ORIENT_FLIP_X)   // Clockwise
+#define ORIENT_ROT180    (ORIENT_FLIP_X | ORIENT_FLIP_Y)
+#define ORIENT_ROT270    (ORIENT_TRANSPOSE | ORIENT_FLIP_Y)
+
+struct ResampleMap {
+    uint16_t srcCols, srcRows;
+    uint16_t dstCols, dstRows;
+    ResampleMode mode;
+    uint8_t orient;
+    uint16_t* index;   // Per destination pixel (row-major): source index (bilinear: top-left tap)
+    uint8_t* wx;       // Bilinear only: weight of the right/lower taps, 0..255
+    uint8_t* wy;
+    uint32_t lastUsed;
+};
+
+namespace Resampler {
+
+// Cached map for a size pair; nullptr if out of memory
+const ResampleMap* getMap(int srcCols, int srcRows, int dstCols, int dstRows,
+                          ResampleMode mode, uint8_t orient);
+
+// Resample src (srcCols x srcRows, row-major) into leds[dstIndex[y * dstCols + x]]
+bool present(const CRGB* src, int srcCols, int srcRows,
+             CRGB* leds, const uint16_t* dstIndex, int dstCols, int dstRows,
+             ResampleMode mode, uint8_t orient);
+
+// "none", "mirror", "flip", "rot90", "rot180", "rot270", "transpose"
+uint8_t parseOrientation(const String& name);
+
+} // namespace Resampler
@@ -0,0 +1,107 @@
+/* ResponseCache.cpp
+   Generation-keyed response cache with ETag revalidation
+   VERSION: V16.6.2-2026-01-13T18:00:00Z - Initial implementation
+*/
+
+#include "ResponseCache.h"
+#include "WebController.h"
+#include "WebPages.h"
+#include "ContentManager.h"
+#include "ThemeManager.h"
+#include "MatrixDisplay.h"
+
+// FNV-1a, for the key mix and the ETag
+static uint32_t fnv1a(const uint8_t* data, size_t len, uint32_t hash = 2166136261u) {
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t mix(uint32_t hash, uint32_t value) {
+    return fnv1a((const uint8_t*)&value, sizeof(value), hash);
+}
+
+void ResponseCache::begin(ContentManager* content, ThemeManager* themes, MatrixDisplay* display) {
+    contentMgr = content;
+    themeMgr = themes;
+    disp = display;
+}
+
+uint32_t ResponseCache::keyFor(uint8_t deps) const {
+    uint32_t key = mix(2166136261u, deps);
+    if (deps & CACHE_DEP_CONTENT) key = mix(key, contentMgr->getContentGeneration());
+    if (deps & CACHE_DEP_SETTINGS) {
+        key = mix(key, contentMgr->getSettingsGeneration());
+        key = mix(key, disp->getColorPipeline().getBrightness());
+    }
+    if (deps & CACHE_DEP_THEME) key = mix(key, themeMgr->getThemeGeneration());
+    return key;
+}
+
+ResponseCache::Entry* ResponseCache::find(const char* path) {
+    for (auto& entry : entries) {
+        if (strcmp(entry.path, path) == 0) return &entry;
+    }
+    return nullptr;
+}
+
+size_t ResponseCache::getBytes() const {
+    size_t bytes = 0;
+    for (const auto& entry : entries) bytes += entry.body->length();
+    return bytes;
+}
+
+void ResponseCache::send(AsyncWebServerRequest* request, const char* path, uint8_t deps,
+                         const char* contentType, const PageFactory& factory) {
+    uint32_t key = keyFor(deps);
+    Entry* entry = find(path);
+
+    if (entry && entry->key == key) {
+        hits++;
+    } else {
+        misses++;
+        auto body = std::make_shared<String>();
+        std::unique_ptr<PageSource> page(factory());
+        while (page->next(*body)) {
+            if (body->length() > WEB_CACHE_MAX_BODY) {
+                // Too big to keep: stream a fresh copy instead
+                oversize++;
+                if (entry) entries.erase(entries.begin() + (entry - entries.data()));
+                WebController::sendPage(request, factory(), contentType);
+                return;
+            }
+        }
+
+        if (!entry) {
+            entries.push_back(Entry{path, 0, nullptr, String()});
+            entry = &entries.back();
+        }
+        entry->key = key;
+        entry->body = body;
+        char etag[20];
+        snprintf(etag, sizeof(etag), "\"%08x-%x\"",
+                 (unsigned)fnv1a((const uint8_t*)body->c_str(), body->length()), (unsigned)body->length());
+        entry->etag = etag;
+    }
+
+    if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == entry->etag) {
+        notModified++;
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", entry->etag);
+        request->send(response);
+        return;
+    }
+
+    std::shared_ptr<String> body = entry->body;
+    AsyncWebServerResponse* response = request->beginResponse(contentType, body->length(),
+        [body](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            size_t n = min(maxLen, body->length() - index);
+            memcpy(buffer, body->c_str() + index, n);
+            return n;
+        });
+    response->addHeader("ETag", entry->etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
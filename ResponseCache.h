@@ -0,0 +1,81 @@
+/* ResponseCache.h
+   Generated pages and JSON kept until what they show changes
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - If-None-Match registered by WebController::on()
+   V16.6.2-2026-01-13T18:00:00Z - Initial implementation
+
+   A cached endpoint names the state it depends on (CACHE_DEP_* bits). Its entry is keyed
+   by the generation counters of that state - ContentManager bumps one when the registry
+   is rebuilt and one when a schedule/random setting changes, ThemeManager one per theme
+   change; brightness is keyed by value. While the key matches, the stored body is sent
+   as is; otherwise it is rebuilt once from the page source. Each response carries an
+   ETag (hash of the body) with Cache-Control: no-cache, so browsers revalidate and an
+   unchanged page costs a 304 with no body.
+   Bodies over WEB_CACHE_MAX_BODY are streamed uncached (WebController::sendPage).
+   Loop task only (handlers registered with WebController::on(), whose filter registers
+   If-None-Match - ESPAsyncWebServer discards headers nobody asked for); a response being sent
+   holds its own reference to the body, so replacing an entry never frees it mid-send.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "Config.h"
+
+class ContentManager;
+class ThemeManager;
+class MatrixDisplay;
+class PageSource;
+
+#define CACHE_DEP_CONTENT  0x01   // Content registry (discovery)
+#define CACHE_DEP_SETTINGS 0x02   // Random mode, interval, filter, scheduler, brightness
+#define CACHE_DEP_THEME    0x04   // Current color theme
+
+typedef std::function<PageSource*()> PageFactory;
+
+class ResponseCache {
+public:
+    ResponseCache() {}
+
+    void begin(ContentManager* content, ThemeManager* themes, MatrixDisplay* display);
+
+    // 200 with the cached body (built by factory on a miss) or 304 if If-None-Match matches
+    void send(AsyncWebServerRequest* request, const char* path, uint8_t deps,
+              const char* contentType, const PageFactory& factory);
+
+    void invalidateAll() { entries.clear(); }
+
+    // Stats (since boot / last resetStats)
+    uint32_t getHits() const { return hits; }               // Served without building
+    uint32_t getMisses() const { return misses; }           // Body built
+    uint32_t getNotModified() const { return notModified; } // 304s (part of hits)
+    uint32_t getOversize() const { return oversize; }       // Too big to keep, streamed
+    float getHitRate() const { return (hits + misses) ? (float)hits / (hits + misses) : 0.0f; }
+    size_t getBytes() const;
+    size_t getEntryCount() const { return entries.size(); }
+    void resetStats() { hits = misses = notModified = oversize = 0; }
+
+private:
+    struct Entry {
+        const char* path;
+        uint32_t key;
+        std::shared_ptr<String> body;
+        String etag;
+    };
+    std::vector<Entry> entries;
+
+    ContentManager* contentMgr = nullptr;
+    ThemeManager* themeMgr = nullptr;
+    MatrixDisplay* disp = nullptr;
+
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t notModified = 0;
+    uint32_t oversize = 0;
+
+    uint32_t keyFor(uint8_t deps) const;
+    Entry* find(const char* path);
+};
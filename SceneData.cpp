@@ -2,25 +2,26 @@
 #include <FS.h>
 #include <FFat.h>
 #include <memory> // V16.1.1-2026-01-08T14:40:00Z
+// V16.7.0-2026-01-14T09:00:00Z - Level macros
 
 SceneData::SceneData(const String& filePath)
     : _filePath(filePath) {}
 
 bool SceneData::load() {
     if (_filePath.length() == 0) {
-        Logger::instance().log("[SceneData] Empty file path");
+        LOG_W("[SceneData] Empty file path");
         return false;
     }
 
     // V16.1.1-2026-01-08T14:40:00Z - Ensure FFat is mounted
     if (!FFat.begin(true)) {
-        Logger::instance().log("[SceneData] FFat mount failed");
+        LOG_E("[SceneData] FFat mount failed");
         return false;
     }
 
     File file = FFat.open(_filePath, "r");
     if (!file) {
-        Logger::instance().log("[SceneData] File not found: " + _filePath);
+        LOG_W("[SceneData] File not found: %s", _filePath.c_str());
         return false;
     }
 
@@ -32,12 +33,12 @@ bool SceneData::load() {
     DynamicJsonDocument doc(4096);
     auto err = deserializeJson(doc, buf.get());
     if (err) {
-        Logger::instance().log("[SceneData] JSON error: " + String(err.c_str()));
+        LOG_W("[SceneData] JSON error: %s", err.c_str());
         return false;
     }
 
     if (!doc.containsKey("frames")) {
-        Logger::instance().log("[SceneData] Missing frames in: " + _filePath);
+        LOG_W("[SceneData] Missing frames in: %s", _filePath.c_str());
         return false;
     }
 
@@ -49,6 +50,6 @@ bool SceneData::load() {
         _frames.push_back(f);
     }
 
-    Logger::instance().log("[SceneData] Loaded " + String(_frames.size()) + " frames");
+    LOG_D("[SceneData] Loaded %u frames", (unsigned)_frames.size());
     return true;
 }
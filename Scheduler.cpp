@@ -1,6 +1,11 @@
 /* Scheduler.cpp
    Complete scheduler with support for all content types
-   VERSION: V16.2.0-2026-01-10T18:35:00Z - Full implementation
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scope per played item
+   V16.7.0-2026-01-14T09:00:00Z - Level macros
+   V16.5.6-2026-01-13T03:00:00Z - Scenes rendered (resampled) via ContentManager::renderScene
+   V16.5.2-2026-01-12T15:00:00Z - Item postfx active while it plays
+   V16.5.0-2026-01-12T09:00:00Z - Procedurals via Animations::runProcedural
+   V16.2.0-2026-01-10T18:35:00Z - Full implementation
 */
 
 #include "Scheduler.h"
@@ -12,12 +17,13 @@
 #include "Scroll.h"
 #include "Countdown.h"
 #include "Logger.h"
-#include <NTPClient.h>
+#include "Profiler.h"
+#include "TimeService.h"
 
 // V16.2.0-2026-01-10T18:35:00Z - External references
 extern MatrixDisplay matrix;
 extern ThemeManager themeManager;
-extern NTPClient timeClient;
+extern TimeService timeService;
 
 Scheduler::Scheduler() {}
 
@@ -46,7 +52,7 @@ void Scheduler::update() {
     int idx = random(allContent.size());
     const ContentItem& item = allContent[idx];
     
-    Logger::instance().log("[Scheduler] Playing: " + item.name);
+    LOG_I("[Scheduler] Playing: %s", item.name.c_str());
     
     // Play content based on type
     playContent(item);
@@ -55,17 +61,17 @@ void Scheduler::update() {
 }
 
 void Scheduler::playContent(const ContentItem& item) {
+    PROFILE_SCOPE("Scheduler::playContent");  // V16.7.2-2026-01-14T15:00:00Z
     // V16.3.0-2026-01-10T23:00:00Z - Use durationMs from item
     unsigned long startTime = millis();
     unsigned long duration = item.durationMs;  // Use content-specific duration
+    matrix.setPostFx(item.postfx);  // V16.5.2-2026-01-12T15:00:00Z
     
     switch (item.type) {
         case CONTENT_SCENE: {
             // V16.2.5-2026-01-10T22:16:00Z - Load and display static scene
-            SceneData scene(item.path);
-            if (scene.load()) {
-                // TODO: scene.render(&matrix);
-                matrix.show();
+            // V16.5.6-2026-01-13T03:00:00Z - Pixels come from ContentManager::renderScene (resampled)
+            if (contentMgr->renderScene(item)) {
                 // Hold for duration
                 while (millis() - startTime < duration) {
                     delay(100);
@@ -104,7 +110,7 @@ void Scheduler::playContent(const ContentItem& item) {
         
         case CONTENT_COUNTDOWN: {
             // Show countdown timer
-            Countdown countdown(&matrix, &themeManager, &timeClient);
+            Countdown countdown(&matrix, &themeManager, &timeService);
             if (countdown.loadFromJSON(item.path)) {
                 countdown.begin();
                 // V16.3.0-2026-01-10T23:01:00Z - Use item.durationMs
@@ -119,17 +125,8 @@ void Scheduler::playContent(const ContentItem& item) {
         case CONTENT_PROCEDURAL: {
             // V16.3.0-2026-01-10T23:01:00Z - Run procedural animations with item.durationMs
             while (millis() - startTime < duration) {
-                if (item.name == "Chase") {
-                    Animations::chase(&matrix);
-                } else if (item.name == "Snowfall") {
-                    Animations::snowfall(&matrix);
-                } else if (item.name == "Snowfall Gentle") {
-                    Animations::snowfallGentle(&matrix);
-                } else if (item.name == "Snowfall Heavy") {
-                    Animations::snowfallHeavy(&matrix);
-                } else if (item.name == "Sparkling Stars") {
-                    Animations::sparklingStars(&matrix);
-                }
+                // V16.5.0-2026-01-12T09:00:00Z - Shared dispatcher (includes effect kernels)
+                if (!Animations::runProcedural(item.name, &matrix)) break;
                 delay(10);
             }
             break;
@@ -141,9 +138,11 @@ void Scheduler::playContent(const ContentItem& item) {
         }
         
         default:
-            Logger::instance().log("[Scheduler] Unknown content type");
+            LOG_W("[Scheduler] Unknown content type");
             break;
     }
+    
+    matrix.setPostFx(PostFxSettings());
 }
 
 void Scheduler::setContentDuration(unsigned long durationMs) {
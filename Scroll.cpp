@@ -1,97 +1,50 @@
 /* Scroll.cpp
    Scrolling text display implementation
-   VERSION: V16.2.0-2026-01-10T18:00:00Z - Initial implementation with theme color cycling
+   VERSION: V16.7.2-2026-01-14T15:00:00Z - Profiler scope in drawFrame()
+   V16.7.0-2026-01-14T09:00:00Z - Level macros; load lines at debug
+   V16.6.6-2026-01-14T06:00:00Z - Content image reads counted (contentFlashRead)
+   V16.5.7-2026-01-13T06:00:00Z - Zone-aware strip; drawFrame() for composited playback
+
+   V16.5.7-2026-01-13T06:00:00Z - Segments are the zone's matrices at their real width (20), not 2 x 25
+   V16.4.0-2026-01-11T09:00:00Z - UTF-8 text, variable-width glyphs, optional "font" key
+   V16.2.0-2026-01-10T18:00:00Z - Initial implementation with theme color cycling
 */
 
 #include "Scroll.h"
 #include "MatrixDisplay.h"
 #include "ThemeManager.h"
 #include "Logger.h"
+#include "Profiler.h"
+#include "Font.h"
 #include <ArduinoJson.h>
 #include "esp_partition.h"
 #include "esp_spi_flash.h"
+#include "Metrics.h"  // V16.6.6 - contentFlashRead()
 
 #define DATA_PARTITION_OFFSET 0x290000
 
-// V16.2.0-2026-01-10T18:00:00Z - 5x7 font definition (ASCII 32-90)
-const uint8_t Scroll::FONT_5X7[][5] = {
-  {0x00, 0x00, 0x00, 0x00, 0x00}, // space (32)
-  {0x00, 0x00, 0x5F, 0x00, 0x00}, // ! (33)
-  {0x00, 0x07, 0x00, 0x07, 0x00}, // " (34)
-  {0x14, 0x7F, 0x14, 0x7F, 0x14}, // # (35)
-  {0x24, 0x2A, 0x7F, 0x2A, 0x12}, // $ (36)
-  {0x23, 0x13, 0x08, 0x64, 0x62}, // % (37)
-  {0x36, 0x49, 0x55, 0x22, 0x50}, // & (38)
-  {0x00, 0x05, 0x03, 0x00, 0x00}, // ' (39)
-  {0x00, 0x1C, 0x22, 0x41, 0x00}, // ( (40)
-  {0x00, 0x41, 0x22, 0x1C, 0x00}, // ) (41)
-  {0x14, 0x08, 0x3E, 0x08, 0x14}, // * (42)
-  {0x08, 0x08, 0x3E, 0x08, 0x08}, // + (43)
-  {0x00, 0x50, 0x30, 0x00, 0x00}, // , (44)
-  {0x08, 0x08, 0x08, 0x08, 0x08}, // - (45)
-  {0x00, 0x60, 0x60, 0x00, 0x00}, // . (46)
-  {0x20, 0x10, 0x08, 0x04, 0x02}, // / (47)
-  {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0 (48)
-  {0x00, 0x42, 0x7F, 0x40, 0x00}, // 1 (49)
-  {0x42, 0x61, 0x51, 0x49, 0x46}, // 2 (50)
-  {0x21, 0x41, 0x45, 0x4B, 0x31}, // 3 (51)
-  {0x18, 0x14, 0x12, 0x7F, 0x10}, // 4 (52)
-  {0x27, 0x45, 0x45, 0x45, 0x39}, // 5 (53)
-  {0x3C, 0x4A, 0x49, 0x49, 0x30}, // 6 (54)
-  {0x01, 0x71, 0x09, 0x05, 0x03}, // 7 (55)
-  {0x36, 0x49, 0x49, 0x49, 0x36}, // 8 (56)
-  {0x06, 0x49, 0x49, 0x29, 0x1E}, // 9 (57)
-  {0x00, 0x36, 0x36, 0x00, 0x00}, // : (58)
-  {0x00, 0x56, 0x36, 0x00, 0x00}, // ; (59)
-  {0x08, 0x14, 0x22, 0x41, 0x00}, // < (60)
-  {0x14, 0x14, 0x14, 0x14, 0x14}, // = (61)
-  {0x00, 0x41, 0x22, 0x14, 0x08}, // > (62)
-  {0x02, 0x01, 0x51, 0x09, 0x06}, // ? (63)
-  {0x32, 0x49, 0x79, 0x41, 0x3E}, // @ (64)
-  {0x7E, 0x11, 0x11, 0x11, 0x7E}, // A (65)
-  {0x7F, 0x49, 0x49, 0x49, 0x36}, // B (66)
-  {0x3E, 0x41, 0x41, 0x41, 0x22}, // C (67)
-  {0x7F, 0x41, 0x41, 0x22, 0x1C}, // D (68)
-  {0x7F, 0x49, 0x49, 0x49, 0x41}, // E (69)
-  {0x7F, 0x09, 0x09, 0x09, 0x01}, // F (70)
-  {0x3E, 0x41, 0x49, 0x49, 0x7A}, // G (71)
-  {0x7F, 0x08, 0x08, 0x08, 0x7F}, // H (72)
-  {0x00, 0x41, 0x7F, 0x41, 0x00}, // I (73)
-  {0x20, 0x40, 0x41, 0x3F, 0x01}, // J (74)
-  {0x7F, 0x08, 0x14, 0x22, 0x41}, // K (75)
-  {0x7F, 0x40, 0x40, 0x40, 0x40}, // L (76)
-  {0x7F, 0x02, 0x0C, 0x02, 0x7F}, // M (77)
-  {0x7F, 0x04, 0x08, 0x10, 0x7F}, // N (78)
-  {0x3E, 0x41, 0x41, 0x41, 0x3E}, // O (79)
-  {0x7F, 0x09, 0x09, 0x09, 0x06}, // P (80)
-  {0x3E, 0x41, 0x51, 0x21, 0x5E}, // Q (81)
-  {0x7F, 0x09, 0x19, 0x29, 0x46}, // R (82)
-  {0x46, 0x49, 0x49, 0x49, 0x31}, // S (83)
-  {0x01, 0x01, 0x7F, 0x01, 0x01}, // T (84)
-  {0x3F, 0x40, 0x40, 0x40, 0x3F}, // U (85)
-  {0x1F, 0x20, 0x40, 0x20, 0x1F}, // V (86)
-  {0x3F, 0x40, 0x38, 0x40, 0x3F}, // W (87)
-  {0x63, 0x14, 0x08, 0x14, 0x63}, // X (88)
-  {0x07, 0x08, 0x70, 0x08, 0x07}, // Y (89)
-  {0x61, 0x51, 0x49, 0x45, 0x43}  // Z (90)
-};
-
 Scroll::Scroll(MatrixDisplay* display, ThemeManager* themeMgr) 
-    : disp(display), themes(themeMgr), scrollSpeed(50), scrollPos(0), 
-      lastUpdate(0), currentColorIndex(0), repeatCount(0) {
+    : disp(display), themes(themeMgr), font(&FONT_5X7), scrollSpeed(50), scrollPos(0), 
+      textWidth(0), lastUpdate(0), currentColorIndex(0), repeatCount(0),
+      zoneFirst(0), zoneCount(MATRIX_COUNT), stripWidth(0) {
     scrollText = "HELLO";
 }
 
+void Scroll::setZone(int firstMatrix, int matrixCount) {
+    zoneFirst = constrain(firstMatrix, 0, MATRIX_COUNT - 1);
+    zoneCount = constrain(matrixCount, 1, MATRIX_COUNT - zoneFirst);
+}
+
 bool Scroll::loadFromJSON(const String& jsonPath) {
     // V16.2.0-2026-01-10T18:00:00Z - Read JSON from flash storage
-    Logger::instance().log("[Scroll] Loading: " + jsonPath);
+    LOG_D("[Scroll] Loading: %s", jsonPath.c_str());
     
     // Find file in flash storage (same method as ContentManager)
     uint32_t flash_addr = DATA_PARTITION_OFFSET;
     uint32_t file_count = 0;
     
-    if (esp_flash_read(NULL, &file_count, flash_addr, 4) != ESP_OK) {
-        Logger::instance().log("[Scroll] Failed to read file count");
+    if (contentFlashRead(&file_count, flash_addr, 4) != ESP_OK) {
+        LOG_E("[Scroll] Failed to read file count");
         return false;
     }
     
@@ -100,23 +53,23 @@ bool Scroll::loadFromJSON(const String& jsonPath) {
     // Search for the file
     for (uint32_t i = 0; i < file_count; i++) {
         uint16_t path_len = 0;
-        if (esp_flash_read(NULL, &path_len, flash_addr, 2) != ESP_OK) break;
+        if (contentFlashRead(&path_len, flash_addr, 2) != ESP_OK) break;
         flash_addr += 2;
         
         char path_buf[256];
-        if (esp_flash_read(NULL, path_buf, flash_addr, path_len) != ESP_OK) break;
+        if (contentFlashRead(path_buf, flash_addr, path_len) != ESP_OK) break;
         flash_addr += path_len;
         path_buf[path_len] = '\0';
         
         uint32_t content_len = 0;
-        if (esp_flash_read(NULL, &content_len, flash_addr, 4) != ESP_OK) break;
+        if (contentFlashRead(&content_len, flash_addr, 4) != ESP_OK) break;
         flash_addr += 4;
         
         // Check if this is our file
         if (String(path_buf) == jsonPath) {
             // Found it! Read content
             char* content = new char[content_len + 1];
-            if (esp_flash_read(NULL, content, flash_addr, content_len) == ESP_OK) {
+            if (contentFlashRead(content, flash_addr, content_len) == ESP_OK) {
                 content[content_len] = '\0';
                 
                 // Parse JSON
@@ -125,7 +78,7 @@ bool Scroll::loadFromJSON(const String& jsonPath) {
                 delete[] content;
                 
                 if (error) {
-                    Logger::instance().log("[Scroll] JSON parse error: " + String(error.c_str()));
+                    LOG_W("[Scroll] JSON parse error: %s", error.c_str());
                     return false;
                 }
                 
@@ -136,8 +89,17 @@ bool Scroll::loadFromJSON(const String& jsonPath) {
                 if (doc.containsKey("speed")) {
                     scrollSpeed = doc["speed"];
                 }
+                // V16.4.0-2026-01-11T09:00:00Z - Optional font: "3x5", "5x7" (default), "7x12"
+                if (doc.containsKey("font")) {
+                    const Font* f = Fonts::byName(doc["font"].as<String>());
+                    if (f) {
+                        font = f;
+                    } else {
+                        Logger::instance().log("[Scroll] Unknown font: " + doc["font"].as<String>());
+                    }
+                }
                 
-                Logger::instance().log("[Scroll] Loaded: '" + scrollText + "' @ " + String(scrollSpeed) + "ms");
+                LOG_D("[Scroll] Loaded: '%s' @ %dms", scrollText.c_str(), (int)scrollSpeed);
                 return true;
             }
             delete[] content;
@@ -150,12 +112,18 @@ bool Scroll::loadFromJSON(const String& jsonPath) {
         flash_addr += padding;
     }
     
-    Logger::instance().log("[Scroll] File not found: " + jsonPath);
+    LOG_W("[Scroll] File not found: %s", jsonPath.c_str());
     return false;
 }
 
 void Scroll::begin() {
-    scrollPos = 50;  // V16.2.0-2026-01-10T18:00:00Z - Start off right edge (50 pixels = 2 matrices)
+    // V16.5.7-2026-01-13T06:00:00Z - The strip is the zone's matrices side by side
+    stripWidth = 0;
+    for (int m = zoneFirst; m < zoneFirst + zoneCount; m++) {
+        stripWidth += disp->getMatrixCols(m);
+    }
+    scrollPos = stripWidth;  // V16.2.0-2026-01-10T18:00:00Z - Start off right edge
+    textWidth = Fonts::textWidth(*font, scrollText.c_str());  // V16.4.0-2026-01-11T09:00:00Z - Measure once
     currentColorIndex = 0;
     repeatCount = 0;
     lastUpdate = millis();
@@ -166,71 +134,53 @@ void Scroll::update() {
     if (now - lastUpdate < scrollSpeed) return;
     lastUpdate = now;
     
-    disp->clear();
+    drawFrame();
+    disp->show();
+}
+
+void Scroll::drawFrame() {
+    PROFILE_SCOPE("Scroll::drawFrame");  // V16.7.2-2026-01-14T15:00:00Z
+    for (int m = zoneFirst; m < zoneFirst + zoneCount; m++) {
+        disp->clearMatrix(m);
+    }
     
     // V16.2.0-2026-01-10T18:00:00Z - Get current theme color
     CRGB color = getCurrentColor();
     
-    int charSpacing = 6;  // 5 pixels width + 1 pixel gap
-    int totalWidth = scrollText.length() * charSpacing;
+    // V16.4.0-2026-01-11T09:00:00Z - Center vertically in the segment (rows 9-15 for 5x7)
+    int y = (disp->getMatrixRows(zoneFirst) - font->height) / 2;
     
-    // Draw each character
-    for (size_t i = 0; i < scrollText.length(); i++) {
-        char c = scrollText.charAt(i);
-        int charPos = scrollPos + (i * charSpacing);
-        
-        // Only draw if visible on either matrix
-        if (charPos >= -charSpacing && charPos < 50) {
-            drawCharacter(c, charPos, color);
+    // Draw each glyph that overlaps the strip
+    int x = scrollPos;
+    const char* p = scrollText.c_str();
+    uint32_t cp;
+    while ((cp = Fonts::nextCodepoint(p)) != 0 && x < stripWidth) {
+        const Glyph* glyph = Fonts::findGlyph(*font, cp);
+        if (x + glyph->width > 0) {
+            drawGlyph(glyph, x, y, color);
         }
+        x += Fonts::advance(*font, glyph);
     }
     
     // Move position
     scrollPos--;
-    if (scrollPos < -totalWidth) {
-        scrollPos = 50;  // Reset to right edge
+    if (scrollPos < -textWidth) {
+        scrollPos = stripWidth;  // Reset to right edge
         repeatCount++;
         currentColorIndex = (currentColorIndex + 1) % 3;  // V16.2.0-2026-01-10T18:00:00Z - Cycle colors
     }
-    
-    disp->show();
 }
 
-void Scroll::drawCharacter(char c, int globalX, CRGB color) {
-    // V16.2.0-2026-01-10T18:00:00Z - Draw character at global X position (0-49 across both matrices)
-    int fontIndex = -1;
-    if (c >= 32 && c <= 90) {
-        fontIndex = c - 32;
-    }
-    
-    if (fontIndex < 0) return;
-    
-    // Draw 5x7 character
-    for (int col = 0; col < 5; col++) {
-        int x = globalX + col;
-        
-        // Determine which matrix and local position
-        int matrix = 0;
-        int localX = x;
-        if (x >= 25) {
-            matrix = 1;
-            localX = x - 25;
-        }
-        
-        // Only draw if in valid range
-        if (x >= 0 && x < 50 && localX >= 0 && localX < 25) {
-            uint8_t columnData = FONT_5X7[fontIndex][col];
-            
-            // Draw vertical column
-            for (int row = 0; row < 7; row++) {
-                if (columnData & (1 << row)) {
-                    int y = 9 + row;  // Center vertically (rows 9-15)
-                    if (y < 20) {
-                        disp->setPixel(matrix, localX, y, color);
-                    }
-                }
-            }
+void Scroll::drawGlyph(const Glyph* glyph, int globalX, int y, CRGB color) {
+    // V16.4.0-2026-01-11T09:00:00Z - Global X spans the strip; the blitter clips each side
+    // V16.5.7-2026-01-13T06:00:00Z - Drawn into every zone matrix the glyph overlaps
+    int left = 0;
+    for (int m = zoneFirst; m < zoneFirst + zoneCount; m++) {
+        int width = disp->getMatrixCols(m);
+        if (globalX < left + width && globalX + glyph->width > left) {
+            Fonts::drawGlyph(disp, m, globalX - left, y, *font, glyph, color);
         }
+        left += width;
     }
 }
 
@@ -246,6 +196,7 @@ CRGB Scroll::getCurrentColor() {
 
 void Scroll::setText(const String& text) {
     scrollText = text;
+    textWidth = Fonts::textWidth(*font, scrollText.c_str());
 }
 
 void Scroll::setSpeed(int speedMs) {
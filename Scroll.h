@@ -1,8 +1,10 @@
 /* Scroll.h
    Scrolling text display system with JSON configuration
-   VERSION: V16.2.0-2026-01-10T18:00:00Z - Initial implementation
+   VERSION: V16.5.7-2026-01-13T06:00:00Z - Scrolls across a zone of matrices (setZone)
    
    Supports JSON-driven scrolling text with theme color cycling
+   V16.5.7-2026-01-13T06:00:00Z - Strip width from the zone's real matrix widths (was 2 x 25)
+   V16.4.0-2026-01-11T09:00:00Z - UTF-8 text, selectable font ("font": "5x7")
 */
 
 #pragma once
@@ -12,6 +14,8 @@
 
 class MatrixDisplay;
 class ThemeManager;
+struct Font;
+struct Glyph;
 
 class Scroll {
 public:
@@ -24,24 +28,34 @@ public:
     void begin();
     void update();
     
+    // V16.5.7-2026-01-13T06:00:00Z - Draw the next step into the zone only: no timing, no show()
+    void drawFrame();
+    
     // Manual configuration
     void setText(const String& text);
     void setSpeed(int speedMs);
+    int getSpeed() const { return scrollSpeed; }
+    
+    // V16.5.7-2026-01-13T06:00:00Z - Matrices the text scrolls across, left to right
+    // (default: all). Call before begin().
+    void setZone(int firstMatrix, int matrixCount);
     
 private:
     MatrixDisplay* disp;
     ThemeManager* themes;
+    const Font* font;       // V16.4.0-2026-01-11T09:00:00Z
     
     String scrollText;
     int scrollSpeed;
     int scrollPos;
+    int textWidth;          // V16.4.0-2026-01-11T09:00:00Z - Cached pixel width of scrollText
     unsigned long lastUpdate;
     int currentColorIndex;  // V16.2.0-2026-01-10T18:00:00Z - Cycle through theme colors
     int repeatCount;        // V16.2.0-2026-01-10T18:00:00Z - Track color changes
+    int zoneFirst;          // V16.5.7-2026-01-13T06:00:00Z
+    int zoneCount;
+    int stripWidth;         // V16.5.7-2026-01-13T06:00:00Z - Sum of the zone's matrix widths
     
-    // V16.2.0-2026-01-10T18:00:00Z - 5x7 font for text rendering
-    static const uint8_t FONT_5X7[][5];
-    
-    void drawCharacter(char c, int globalX, CRGB color);
+    void drawGlyph(const Glyph* glyph, int globalX, int y, CRGB color);
     CRGB getCurrentColor();
 };
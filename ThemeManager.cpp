@@ -1,29 +1,81 @@
 /* ThemeManager.cpp
    Theme control implementation
-   VERSION: V16.1.2-2026-01-08T15:00:00Z
+   VERSION: V16.7.1-2026-01-14T12:00:00Z - Theme changes traced (TraceLog)
+   V16.6.2-2026-01-13T18:00:00Z - Theme generation counter
+   V16.4.4-2026-01-11T20:00:00Z - Data-driven themes, RAM palettes, timed blends
+   V16.4.3-2026-01-11T17:00:00Z - Theme palettes replace hardcoded color switches
+   V16.1.2-2026-01-08T15:00:00Z
 */
 
 #include "ThemeManager.h"
 #include "MatrixDisplay.h"
 #include "ContentManager.h"
 #include "Logger.h"
+#include "TraceLog.h"
+#include "Config.h"
+#include <ArduinoJson.h>
 
 ThemeManager::ThemeManager() {}
 
 void ThemeManager::begin(MatrixDisplay* display, ContentManager* content) {
     disp = display;
     contentMgr = content;
-    currentTheme = 0;
-    Logger::instance().log("[ThemeManager] Initialized");
+
+    // V16.4.4-2026-01-11T20:00:00Z - Compiled-in themes first; theme files may replace them
+    addBuiltinTheme(THEME_OFF, "off", CRGB::White, CRGB::Blue, CRGB::Red);
+    addBuiltinTheme(THEME_CHRISTMAS, "christmas", CHRISTMAS_COLOR_1, CHRISTMAS_COLOR_2, CHRISTMAS_COLOR_3);
+    addBuiltinTheme(THEME_HALLOWEEN, "halloween", HALLOWEEN_COLOR_1, HALLOWEEN_COLOR_2, HALLOWEEN_COLOR_3);
+    addBuiltinTheme(THEME_THANKSGIVING, "thanksgiving", THANKSGIVING_COLOR_1, THANKSGIVING_COLOR_2, THANKSGIVING_COLOR_3);
+    addBuiltinTheme(THEME_NEWYEAR, "newyear", NEWYEAR_COLOR_1, NEWYEAR_COLOR_2, NEWYEAR_COLOR_3);
+    addBuiltinTheme(THEME_OSU, "osu", OSU_COLOR_1, OSU_COLOR_2, OSU_COLOR_3);
+    loadThemeFiles();
+
+    setTheme(THEME_OFF);
+    Logger::instance().log("[ThemeManager] Initialized with " + String(themes.size()) + " themes");
 }
 
-void ThemeManager::setTheme(uint8_t theme) {
+bool ThemeManager::setTheme(uint8_t theme, uint16_t blendMs) {
     currentTheme = theme;
-    Logger::instance().log("[ThemeManager] Theme set to " + String(theme));
+    themeGeneration++;  // V16.6.2-2026-01-13T18:00:00Z
+    const ThemeDef* def = findTheme(theme);
+    if (!def) {
+        // Random/test modes and unknown ids use the neutral palette
+        def = findTheme(THEME_OFF);
+    }
+    activate(*def, blendMs);  // V16.4.3-2026-01-11T17:00:00Z - One palette swap re-tints indexed content
+    traceLog.event(TRACE_THEME, theme, blendMs);  // V16.7.1-2026-01-14T12:00:00Z
+    Logger::instance().log("[ThemeManager] Theme set to " + String(theme) + " (" + def->name + ")");
+    return def->id == theme;
+}
+
+bool ThemeManager::setThemeByName(const String& name, uint16_t blendMs) {
+    for (const auto& def : themes) {
+        if (def.name.equalsIgnoreCase(name)) {
+            return setTheme(def.id, blendMs);
+        }
+    }
+    Logger::instance().log("[ThemeManager] Unknown theme: " + name);
+    return false;
 }
 
 void ThemeManager::update() {
-    // V16.1.2 - Future: auto-cycling, theme-based updates
+    // V16.4.4-2026-01-11T20:00:00Z - Advance a timed palette blend (one 256-entry pass per call)
+    if (blendDurationMs == 0) return;
+
+    unsigned long elapsed = millis() - blendStartMs;
+    if (elapsed >= blendDurationMs) {
+        blendDurationMs = 0;
+        publish(blendTarget);
+        return;
+    }
+
+    uint8_t amount = (uint8_t)((elapsed * 255) / blendDurationMs);
+    CRGB* out = blendScratch[blendScratchIndex];
+    blendScratchIndex ^= 1;  // Never rewrite the palette the display is using
+    for (int i = 0; i < PALETTE_SIZE; i++) {
+        out[i] = blend(blendFrom[i], blendTarget[i], amount);
+    }
+    publish(out);
 }
 
 void ThemeManager::renderContent(uint16_t contentId) {
@@ -32,39 +84,196 @@ void ThemeManager::renderContent(uint16_t contentId) {
     }
 }
 
+// V16.4.4-2026-01-11T20:00:00Z - Palette expansion
+void ThemeManager::expandGradient(const PaletteStop* stops, int count, CRGB* out) {
+    if (count <= 0) {
+        fill_solid(out, PALETTE_SIZE, CRGB::Black);
+        return;
+    }
+
+    int seg = 0;
+    for (int i = 1; i < PALETTE_SIZE; i++) {
+        while (seg < count - 1 && i >= stops[seg + 1].pos) seg++;
+
+        const PaletteStop& a = stops[seg];
+        if (i <= a.pos || seg == count - 1) {
+            out[i] = a.color;  // Before the first stop / after the last
+            continue;
+        }
+        const PaletteStop& b = stops[seg + 1];
+        uint8_t t = (uint8_t)(((i - a.pos) * 255) / (b.pos - a.pos));
+        out[i] = blend(a.color, b.color, t);
+    }
+    out[PALETTE_BLACK] = CRGB::Black;  // Reserved: clear/background in indexed mode
+}
+
+ThemeDef* ThemeManager::addTheme(uint8_t id, const String& name) {
+    // Same id or name replaces the existing definition (palette memory is reused)
+    for (auto& def : themes) {
+        if (def.id == id || def.name.equalsIgnoreCase(name)) {
+            def.id = id;
+            def.name = name;
+            return &def;
+        }
+    }
+
+    ThemeDef def;
+    def.id = id;
+    def.name = name;
+    def.palette = new CRGB[PALETTE_SIZE];
+    themes.push_back(def);
+    return &themes.back();
+}
+
+void ThemeManager::addBuiltinTheme(uint8_t id, const char* name, CRGB c1, CRGB c2, CRGB c3) {
+    PaletteStop stops[3] = {
+        {PALETTE_COLOR1, c1},
+        {PALETTE_COLOR2, c2},
+        {PALETTE_COLOR3, c3}
+    };
+    ThemeDef* def = addTheme(id, name);
+    expandGradient(stops, 3, def->palette);
+}
+
+const ThemeDef* ThemeManager::findTheme(uint8_t id) const {
+    for (const auto& def : themes) {
+        if (def.id == id) return &def;
+    }
+    return nullptr;
+}
+
+void ThemeManager::loadThemeFiles() {
+    if (!contentMgr) return;
+
+    for (const auto& entry : contentMgr->getFiles()) {
+        if (entry.path.startsWith(THEME_FILE_PREFIX) && entry.path.endsWith(".json")) {
+            loadThemeFile(entry.path);
+        }
+    }
+}
+
+// "#RRGGBB", "RRGGBB" or [r, g, b]
+static bool parseColor(JsonVariant value, CRGB& out) {
+    if (value.is<JsonArray>()) {
+        JsonArray rgb = value.as<JsonArray>();
+        if (rgb.size() != 3) return false;
+        out = CRGB(rgb[0].as<uint8_t>(), rgb[1].as<uint8_t>(), rgb[2].as<uint8_t>());
+        return true;
+    }
+
+    const char* text = value.as<const char*>();
+    if (!text) return false;
+    if (*text == '#') text++;
+    if (strlen(text) != 6) return false;
+
+    char* end;
+    uint32_t rgb = strtoul(text, &end, 16);
+    if (*end != '\0') return false;
+    out = CRGB((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF);
+    return true;
+}
+
+bool ThemeManager::loadThemeFile(const String& path) {
+    const FileEntry* entry = contentMgr->findFile(path);
+    String json;
+    if (!entry || !contentMgr->readFile(*entry, json)) return false;
+
+    DynamicJsonDocument doc(2048);
+    DeserializationError error = deserializeJson(doc, json);
+    if (error) {
+        Logger::instance().log("[ThemeManager] JSON error in " + path + ": " + String(error.c_str()));
+        return false;
+    }
+
+    String name = doc["name"] | path.substring(path.lastIndexOf('/') + 1, path.lastIndexOf('.'));
+
+    PaletteStop stops[MAX_PALETTE_STOPS];
+    int count = 0;
+
+    if (doc["stops"].is<JsonArray>()) {
+        for (JsonVariant stop : doc["stops"].as<JsonArray>()) {
+            if (count >= MAX_PALETTE_STOPS) break;
+            int pos = stop["pos"] | -1;
+            if (pos < 0 || pos > 255 || !parseColor(stop["color"], stops[count].color)) {
+                Logger::instance().log("[ThemeManager] Bad stop in " + path);
+                return false;
+            }
+            stops[count].pos = (uint8_t)pos;
+            if (count > 0 && stops[count].pos <= stops[count - 1].pos) {
+                Logger::instance().log("[ThemeManager] Stops must be in increasing order: " + path);
+                return false;
+            }
+            count++;
+        }
+    } else if (doc["colors"].is<JsonArray>()) {
+        // Three-color shorthand, same layout as the built-in themes
+        static const uint8_t POSITIONS[3] = {PALETTE_COLOR1, PALETTE_COLOR2, PALETTE_COLOR3};
+        JsonArray colors = doc["colors"].as<JsonArray>();
+        for (size_t i = 0; i < colors.size() && i < 3; i++) {
+            if (!parseColor(colors[i], stops[count].color)) {
+                Logger::instance().log("[ThemeManager] Bad color in " + path);
+                return false;
+            }
+            stops[count].pos = POSITIONS[i];
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        Logger::instance().log("[ThemeManager] No stops/colors in " + path);
+        return false;
+    }
+
+    // Files without an id take the next free custom id (unless they replace a theme by name)
+    int id = doc["id"] | -1;
+    if (id < 0) {
+        id = THEME_FIRST_CUSTOM_ID;
+        for (const auto& def : themes) {
+            if (def.name.equalsIgnoreCase(name)) { id = def.id; break; }
+            if (def.id >= id) id = def.id + 1;
+        }
+    }
+    if (id > 255) return false;
+
+    ThemeDef* def = addTheme((uint8_t)id, name);
+    expandGradient(stops, count, def->palette);
+    Logger::instance().log("[ThemeManager] Loaded theme " + String(id) + ": " + name +
+                           " (" + String(count) + " stops)");
+    return true;
+}
+
+void ThemeManager::activate(const ThemeDef& theme, uint16_t blendMs) {
+    if (blendMs == 0 || activePalette == nullptr) {
+        blendDurationMs = 0;
+        publish(theme.palette);
+        return;
+    }
+
+    // Snapshot what is on screen now (possibly mid-blend) as the blend source
+    memcpy(blendFrom, activePalette, sizeof(blendFrom));
+    blendTarget = theme.palette;
+    blendStartMs = millis();
+    blendDurationMs = blendMs;
+}
+
+void ThemeManager::publish(const CRGB* palette) {
+    activePalette = palette;
+    paletteGeneration++;
+    if (disp) {
+        disp->setPalette(palette);
+    }
+}
+
 // V16.2.2-2026-01-10T19:00:00Z - Color accessors for themed content
+// V16.4.3-2026-01-11T17:00:00Z - Read from the active palette
 CRGB ThemeManager::getColor1() const {
-    // Theme-specific primary colors
-    switch (currentTheme) {
-        case 0: return CRGB::Red;      // Christmas
-        case 1: return CRGB::Orange;   // Halloween
-        case 2: return CRGB::Orange;   // Thanksgiving
-        case 3: return CRGB::Gold;     // New Year
-        case 4: return CRGB::Red;      // OSU
-        default: return CRGB::White;
-    }
+    return activePalette[PALETTE_COLOR1];
 }
 
 CRGB ThemeManager::getColor2() const {
-    // Theme-specific secondary colors
-    switch (currentTheme) {
-        case 0: return CRGB::Green;    // Christmas
-        case 1: return CRGB::Purple;   // Halloween
-        case 2: return CRGB::Brown;    // Thanksgiving
-        case 3: return CRGB::Silver;   // New Year
-        case 4: return CRGB::Grey;     // OSU
-        default: return CRGB::Blue;
-    }
+    return activePalette[PALETTE_COLOR2];
 }
 
 CRGB ThemeManager::getColor3() const {
-    // Theme-specific accent colors
-    switch (currentTheme) {
-        case 0: return CRGB::White;    // Christmas
-        case 1: return CRGB::Green;    // Halloween
-        case 2: return CRGB::Yellow;   // Thanksgiving
-        case 3: return CRGB::Blue;     // New Year
-        case 4: return CRGB::White;    // OSU
-        default: return CRGB::Red;
-    }
+    return activePalette[PALETTE_COLOR3];
 }
@@ -1,16 +1,53 @@
 /* ThemeManager.h
    Theme control and content rendering
-   VERSION: V16.2.2-2026-01-10T19:00:00Z - Added color accessors for themed content
+   VERSION: V16.6.2-2026-01-13T18:00:00Z - getThemeGeneration() (web response cache)
+   V16.4.4-2026-01-11T20:00:00Z - Data-driven themes from themes/<name>.json
+
+   V16.4.4-2026-01-11T20:00:00Z - Themes are gradient stops expanded once into RAM palettes;
+                                  activation is a pointer swap, optionally with a timed blend
+   V16.4.3-2026-01-11T17:00:00Z - Theme colors come from Config.h keyed by THEME_* constants
+                                  (the old switch was off by one: case 0 was Christmas)
+   V16.2.2-2026-01-10T19:00:00Z - Added color accessors for themed content
+
+   Theme file format (content partition, themes/<name>.json):
+     {"id": 20, "name": "candycane",
+      "stops": [{"pos": 1, "color": "#FF0000"}, {"pos": 255, "color": "#FFFFFF"}]}
+   or the three-color shorthand {"name": "...", "colors": ["#RRGGBB", "#RRGGBB", "#RRGGBB"]}.
+   "id" is optional (files without one get 20+); a file reusing a built-in id/name replaces it.
 */
 
 #pragma once
 
 #include <Arduino.h>
 #include <FastLED.h>
+#include <vector>
 
 class MatrixDisplay;
 class ContentManager;
 
+// V16.4.3-2026-01-11T17:00:00Z - Palette layout: 0 = black, 1..255 = color1 -> color2 -> color3
+#define PALETTE_SIZE 256
+#define PALETTE_BLACK 0
+#define PALETTE_COLOR1 1
+#define PALETTE_COLOR2 128
+#define PALETTE_COLOR3 255
+
+// V16.4.4-2026-01-11T20:00:00Z - Theme definitions
+#define THEME_FILE_PREFIX "themes/"
+#define THEME_FIRST_CUSTOM_ID 20
+#define MAX_PALETTE_STOPS 16
+
+struct PaletteStop {
+    uint8_t pos;
+    CRGB color;
+};
+
+struct ThemeDef {
+    uint8_t id;
+    String name;
+    CRGB* palette;   // PALETTE_SIZE entries, expanded once at load
+};
+
 class ThemeManager {
 public:
     ThemeManager();
@@ -18,18 +55,53 @@ public:
     void begin(MatrixDisplay* display, ContentManager* content);
     void update();
 
-    void setTheme(uint8_t theme);
+    // V16.4.4-2026-01-11T20:00:00Z - blendMs > 0 cross-fades from the current palette
+    bool setTheme(uint8_t theme, uint16_t blendMs = 0);
+    bool setThemeByName(const String& name, uint16_t blendMs = 0);
     uint8_t getCurrentTheme() const { return currentTheme; }
-    
+    uint32_t getThemeGeneration() const { return themeGeneration; }  // V16.6.2 - Bumped per setTheme()
+    const std::vector<ThemeDef>& getThemes() const { return themes; }
+
     void renderContent(uint16_t contentId); // V16.1.2
-    
+
     // V16.2.2-2026-01-10T19:00:00Z - Color accessors for themed content
     CRGB getColor1() const;
     CRGB getColor2() const;
     CRGB getColor3() const;
 
+    // V16.4.3-2026-01-11T17:00:00Z - Active palette (also bound to the display for indexed mode)
+    // V16.4.4-2026-01-11T20:00:00Z - Effects sample with one lookup: getPalette()[index]
+    const CRGB* getPalette() const { return activePalette; }
+    CRGB getPaletteColor(uint8_t index) const { return activePalette[index]; }
+    uint32_t getPaletteGeneration() const { return paletteGeneration; }  // Bumped on every swap
+    bool isBlending() const { return blendDurationMs != 0; }
+
+    // Expand gradient stops (sorted by pos) into a PALETTE_SIZE table; entry 0 stays black
+    static void expandGradient(const PaletteStop* stops, int count, CRGB* out);
+
 private:
     MatrixDisplay* disp = nullptr;
     ContentManager* contentMgr = nullptr;
     uint8_t currentTheme = 0;
+    uint32_t themeGeneration = 0;
+
+    std::vector<ThemeDef> themes;
+    const CRGB* activePalette = nullptr;
+    uint32_t paletteGeneration = 0;
+
+    // V16.4.4-2026-01-11T20:00:00Z - Timed blend: snapshot -> target through two scratch palettes
+    CRGB blendFrom[PALETTE_SIZE];
+    CRGB blendScratch[2][PALETTE_SIZE];
+    uint8_t blendScratchIndex = 0;
+    const CRGB* blendTarget = nullptr;
+    unsigned long blendStartMs = 0;
+    uint16_t blendDurationMs = 0;
+
+    void addBuiltinTheme(uint8_t id, const char* name, CRGB c1, CRGB c2, CRGB c3);
+    ThemeDef* addTheme(uint8_t id, const String& name);
+    void loadThemeFiles();
+    bool loadThemeFile(const String& path);
+    const ThemeDef* findTheme(uint8_t id) const;
+    void activate(const ThemeDef& theme, uint16_t blendMs);
+    void publish(const CRGB* palette);
 };
@@ -0,0 +1,447 @@
+/* TimeMath.cpp
+   Platform-independent time math implementation
+   VERSION: V16.4.2-2026-01-11T14:00:00Z - Initial implementation
+*/
+
+#include "TimeMath.h"
+#include <string.h>
+
+namespace TimeMath {
+
+// Howard Hinnant's civil calendar algorithms (valid far beyond +/-10000 years)
+int64_t daysFromCivil(int year, unsigned month, unsigned day) {
+    year -= (month <= 2);
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yoe = (unsigned)(year - era * 400);
+    const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+void civilFromDays(int64_t days, int& year, unsigned& month, unsigned& day) {
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = (unsigned)(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    day = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = (int)(yoe + era * 400) + (month <= 2);
+}
+
+bool isLeapYear(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+uint8_t daysInMonth(int year, unsigned month) {
+    static const uint8_t DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && isLeapYear(year)) return 29;
+    return DAYS[(month - 1) % 12];
+}
+
+static int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+void breakDown(int64_t epochSec, DateTime& out) {
+    int64_t days = floorDiv(epochSec, 86400);
+    int32_t secs = (int32_t)(epochSec - days * 86400);
+
+    int year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+
+    out.year = (int16_t)year;
+    out.month = (uint8_t)month;
+    out.day = (uint8_t)day;
+    out.hour = (uint8_t)(secs / 3600);
+    out.minute = (uint8_t)((secs / 60) % 60);
+    out.second = (uint8_t)(secs % 60);
+    out.weekday = (uint8_t)((days % 7 + 11) % 7);  // 1970-01-01 was a Thursday (4)
+}
+
+int64_t toEpoch(const DateTime& dt) {
+    return daysFromCivil(dt.year, dt.month, dt.day) * 86400
+         + dt.hour * 3600 + dt.minute * 60 + dt.second;
+}
+
+// Read exactly `count` digits
+static bool readDigits(const char*& p, int count, int& value) {
+    value = 0;
+    for (int i = 0; i < count; i++) {
+        if (p[i] < '0' || p[i] > '9') return false;
+        value = value * 10 + (p[i] - '0');
+    }
+    p += count;
+    return true;
+}
+
+bool parseDateTime(const char* text, DateTime& out, bool& hasOffset, int32_t& offsetSec) {
+    // V16.4.2-2026-01-11T14:00:00Z - "YYYY-MM-DD HH:MM[:SS][Z|+hh:mm]"
+    const char* p = text;
+    int year, month, day, hour, minute, second = 0;
+
+    while (*p == ' ') p++;
+    if (!readDigits(p, 4, year) || *p++ != '-') return false;
+    if (!readDigits(p, 2, month) || *p++ != '-') return false;
+    if (!readDigits(p, 2, day)) return false;
+    if (*p != ' ' && *p != 'T') return false;
+    p++;
+    if (!readDigits(p, 2, hour) || *p++ != ':') return false;
+    if (!readDigits(p, 2, minute)) return false;
+    if (*p == ':') {
+        p++;
+        if (!readDigits(p, 2, second)) return false;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) return false;
+    if (hour > 23 || minute > 59 || second > 59) return false;
+
+    hasOffset = false;
+    offsetSec = 0;
+    if (*p == 'Z') {
+        hasOffset = true;
+        p++;
+    } else if (*p == '+' || *p == '-') {
+        int sign = (*p == '-') ? -1 : 1;
+        int oh, om = 0;
+        p++;
+        if (!readDigits(p, 2, oh)) return false;
+        if (*p == ':') p++;
+        if (*p >= '0' && *p <= '9' && !readDigits(p, 2, om)) return false;
+        if (oh > 23 || om > 59) return false;
+        hasOffset = true;
+        offsetSec = sign * (oh * 3600 + om * 60);
+    }
+    while (*p == ' ') p++;
+    if (*p != '\0') return false;
+
+    out.year = (int16_t)year;
+    out.month = (uint8_t)month;
+    out.day = (uint8_t)day;
+    out.hour = (uint8_t)hour;
+    out.minute = (uint8_t)minute;
+    out.second = (uint8_t)second;
+    out.weekday = (uint8_t)((daysFromCivil(year, month, day) % 7 + 11) % 7);
+    return true;
+}
+
+} // namespace TimeMath
+
+// ========== PosixTimeZone ==========
+
+namespace {
+
+bool isAlpha(char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); }
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// std/dst name: 3+ letters, or <...> quoted form ("<+0530>")
+bool parseZoneName(const char*& p, char* out, size_t outSize) {
+    size_t n = 0;
+    if (*p == '<') {
+        p++;
+        while (*p && *p != '>') {
+            if (n + 1 < outSize) out[n++] = *p;
+            p++;
+        }
+        if (*p != '>') return false;
+        p++;
+    } else {
+        while (isAlpha(*p)) {
+            if (n + 1 < outSize) out[n++] = *p;
+            p++;
+        }
+        if (n < 3) return false;
+    }
+    out[n] = '\0';
+    return n > 0;
+}
+
+// [+-]hh[:mm[:ss]] -> seconds
+bool parseClock(const char*& p, int32_t& seconds, int maxHours) {
+    int sign = 1;
+    if (*p == '+' || *p == '-') {
+        if (*p == '-') sign = -1;
+        p++;
+    }
+    if (!isDigit(*p)) return false;
+
+    int32_t parts[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        if (i > 0) {
+            if (*p != ':') break;
+            p++;
+        }
+        if (!isDigit(*p)) return false;
+        int32_t v = 0;
+        while (isDigit(*p)) v = v * 10 + (*p++ - '0');
+        parts[i] = v;
+    }
+    if (parts[0] > maxHours || parts[1] > 59 || parts[2] > 59) return false;
+    seconds = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+    return true;
+}
+
+bool parseNumber(const char*& p, int16_t& value) {
+    if (!isDigit(*p)) return false;
+    int v = 0;
+    while (isDigit(*p)) v = v * 10 + (*p++ - '0');
+    value = (int16_t)v;
+    return true;
+}
+
+} // namespace
+
+PosixTimeZone::PosixTimeZone()
+    : stdOffset(0), dstOffset(0), hasDst(false), cachedYear(-32768), cachedStart(0), cachedEnd(0) {
+    strcpy(stdName, "UTC");
+    strcpy(dstName, "UTC");
+    startRule = {'M', 3, 2, 0, 7200};
+    endRule = {'M', 11, 1, 0, 7200};
+}
+
+bool PosixTimeZone::parse(const char* spec) {
+    // V16.4.2-2026-01-11T14:00:00Z - std offset [dst [offset] [,start[/time],end[/time]]]
+    // POSIX offsets are hours WEST of UTC; stored here as seconds east
+    const char* p = spec;
+    char newStd[8], newDst[8];
+    int32_t west;
+    Rule newStart = {'M', 3, 2, 0, 7200};   // US rules when the spec omits them
+    Rule newEnd = {'M', 11, 1, 0, 7200};
+
+    if (!parseZoneName(p, newStd, sizeof(newStd))) return false;
+    if (!parseClock(p, west, 24)) return false;
+    int32_t newStdOffset = -west;
+    int32_t newDstOffset = newStdOffset;
+    bool newHasDst = false;
+
+    if (*p) {
+        if (!parseZoneName(p, newDst, sizeof(newDst))) return false;
+        newHasDst = true;
+        newDstOffset = newStdOffset + 3600;
+        if (*p && *p != ',') {
+            if (!parseClock(p, west, 24)) return false;
+            newDstOffset = -west;
+        }
+        if (*p == ',') {
+            Rule* rules[2] = {&newStart, &newEnd};
+            for (int i = 0; i < 2; i++) {
+                if (*p++ != ',') return false;
+                Rule& r = *rules[i];
+                r.month = r.week = r.day = 0;
+                r.time = 7200;
+                if (*p == 'M') {
+                    p++;
+                    r.type = 'M';
+                    if (!parseNumber(p, r.month) || *p++ != '.') return false;
+                    if (!parseNumber(p, r.week) || *p++ != '.') return false;
+                    if (!parseNumber(p, r.day)) return false;
+                    if (r.month < 1 || r.month > 12 || r.week < 1 || r.week > 5 || r.day > 6) return false;
+                } else if (*p == 'J') {
+                    p++;
+                    r.type = 'J';
+                    if (!parseNumber(p, r.day) || r.day < 1 || r.day > 365) return false;
+                } else {
+                    r.type = 'N';
+                    if (!parseNumber(p, r.day) || r.day > 365) return false;
+                }
+                if (*p == '/') {
+                    p++;
+                    if (!parseClock(p, r.time, 167)) return false;
+                }
+            }
+        }
+    }
+    if (*p) return false;
+
+    strcpy(stdName, newStd);
+    strcpy(dstName, newHasDst ? newDst : newStd);
+    stdOffset = newStdOffset;
+    dstOffset = newDstOffset;
+    hasDst = newHasDst;
+    startRule = newStart;
+    endRule = newEnd;
+    cachedYear = -32768;
+    return true;
+}
+
+int64_t PosixTimeZone::ruleLocalSeconds(int year, const Rule& rule) const {
+    int64_t days;
+    if (rule.type == 'M') {
+        int64_t first = TimeMath::daysFromCivil(year, rule.month, 1);
+        int firstWeekday = (int)((first % 7 + 11) % 7);
+        int day = 1 + (rule.day - firstWeekday + 7) % 7 + (rule.week - 1) * 7;
+        int dim = TimeMath::daysInMonth(year, rule.month);
+        while (day > dim) day -= 7;  // Week 5 = last occurrence
+        days = first + day - 1;
+    } else if (rule.type == 'J') {
+        int doy = rule.day - 1;  // Feb 29 is never counted
+        if (TimeMath::isLeapYear(year) && rule.day >= 60) doy++;
+        days = TimeMath::daysFromCivil(year, 1, 1) + doy;
+    } else {
+        days = TimeMath::daysFromCivil(year, 1, 1) + rule.day;
+    }
+    return days * 86400 + rule.time;
+}
+
+void PosixTimeZone::transitionsFor(int year, int64_t& start, int64_t& end) const {
+    if (year != cachedYear) {
+        // Start is expressed in standard time, end in daylight time
+        cachedStart = ruleLocalSeconds(year, startRule) - stdOffset;
+        cachedEnd = ruleLocalSeconds(year, endRule) - dstOffset;
+        cachedYear = year;
+    }
+    start = cachedStart;
+    end = cachedEnd;
+}
+
+bool PosixTimeZone::isDstAt(int64_t utcSec) const {
+    if (!hasDst) return false;
+
+    TimeMath::DateTime local;
+    TimeMath::breakDown(utcSec + stdOffset, local);
+
+    int64_t start, end;
+    transitionsFor(local.year, start, end);
+    if (start < end) {
+        return utcSec >= start && utcSec < end;
+    }
+    return utcSec >= start || utcSec < end;  // Southern hemisphere
+}
+
+int32_t PosixTimeZone::offsetAt(int64_t utcSec) const {
+    return isDstAt(utcSec) ? dstOffset : stdOffset;
+}
+
+const char* PosixTimeZone::abbreviation(int64_t utcSec) const {
+    return isDstAt(utcSec) ? dstName : stdName;
+}
+
+int64_t PosixTimeZone::fromLocal(const TimeMath::DateTime& local) const {
+    int64_t wall = TimeMath::toEpoch(local);
+    int64_t asStd = wall - stdOffset;
+    if (!hasDst) return asStd;
+
+    int64_t asDst = wall - dstOffset;
+    bool dstValid = isDstAt(asDst);
+    bool stdValid = !isDstAt(asStd);
+
+    if (dstValid && stdValid) return asDst < asStd ? asDst : asStd;  // Overlap: first instance
+    if (dstValid) return asDst;
+    return asStd;  // Valid standard time, or the spring-forward gap
+}
+
+// ========== Ntp ==========
+
+namespace Ntp {
+
+static const int64_t NTP_UNIX_DELTA = 2208988800LL;  // 1900-01-01 -> 1970-01-01
+
+uint64_t toTimestamp(int64_t unixUs) {
+    if (unixUs < 0) unixUs = 0;
+    uint64_t secs = (uint64_t)(unixUs / 1000000 + NTP_UNIX_DELTA) & 0xFFFFFFFFULL;  // Era wraps in 2036
+    uint64_t frac = ((uint64_t)(unixUs % 1000000) << 32) / 1000000;
+    return (secs << 32) | frac;
+}
+
+int64_t fromTimestamp(uint64_t ntpTimestamp) {
+    int64_t secs = (int64_t)(ntpTimestamp >> 32);
+    uint64_t frac = ntpTimestamp & 0xFFFFFFFFULL;
+    if (secs < 0x80000000LL) secs += 0x100000000LL;  // Era 1 (after 2036-02-07)
+    return (secs - NTP_UNIX_DELTA) * 1000000 + (int64_t)((frac * 1000000 + 0x80000000ULL) >> 32);
+}
+
+static uint64_t read64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v = (v << 8) | p[i];
+    return v;
+}
+
+static void write64(uint8_t* p, uint64_t v) {
+    for (int i = 7; i >= 0; i--) {
+        p[i] = (uint8_t)v;
+        v >>= 8;
+    }
+}
+
+void buildRequest(uint8_t* packet, int64_t t1Us) {
+    memset(packet, 0, PACKET_SIZE);
+    packet[0] = (0 << 6) | (4 << 3) | 3;   // LI none, version 4, mode client
+    write64(packet + 40, toTimestamp(t1Us));  // Transmit - echoed back as originate
+}
+
+bool parseResponse(const uint8_t* packet, size_t len, int64_t t1Us, int64_t t4Us, Sample& out) {
+    if (len < PACKET_SIZE) return false;
+
+    uint8_t leap = packet[0] >> 6;
+    uint8_t version = (packet[0] >> 3) & 0x07;
+    uint8_t mode = packet[0] & 0x07;
+    uint8_t stratum = packet[1];
+
+    if (mode != 4 || version < 3) return false;
+    if (leap == 3) return false;                         // Server not synchronized
+    if (stratum == 0 || stratum > 15) return false;      // Kiss-o'-death / invalid
+    if (read64(packet + 24) != toTimestamp(t1Us)) return false;  // Not a reply to our request
+
+    uint64_t rx = read64(packet + 32);
+    uint64_t tx = read64(packet + 40);
+    if (rx == 0 || tx == 0) return false;
+
+    int64_t t2Us = fromTimestamp(rx);
+    int64_t t3Us = fromTimestamp(tx);
+
+    out.offsetUs = ((t2Us - t1Us) + (t3Us - t4Us)) / 2;
+    out.delayUs = (t4Us - t1Us) - (t3Us - t2Us);
+    if (out.delayUs < 0) out.delayUs = 0;
+    out.stratum = stratum;
+    return true;
+}
+
+} // namespace Ntp
+
+// ========== ClockModel ==========
+
+ClockModel::ClockModel()
+    : baseMonoUs(0), baseEpochUs(0), slewUs(0), lastSyncMonoUs(0), driftPpb(0), synced(false) {}
+
+int64_t ClockModel::epochUs(int64_t monoUs) const {
+    int64_t elapsed = monoUs - baseMonoUs;
+    if (elapsed < 0) elapsed = 0;
+
+    int64_t drift = elapsed * driftPpb / 1000000000LL;
+    int64_t slew = (elapsed >= SLEW_WINDOW_US) ? slewUs : slewUs * elapsed / SLEW_WINDOW_US;
+    return baseEpochUs + elapsed + drift + slew;
+}
+
+void ClockModel::apply(int64_t monoUs, int64_t offsetUs) {
+    int64_t estimate = epochUs(monoUs);
+    int64_t magnitude = offsetUs < 0 ? -offsetUs : offsetUs;
+
+    if (!synced || magnitude > STEP_THRESHOLD_US) {
+        // First sync or a large error: step
+        baseMonoUs = monoUs;
+        baseEpochUs = estimate + offsetUs;
+        slewUs = 0;
+        lastSyncMonoUs = monoUs;
+        synced = true;
+        return;
+    }
+
+    // Residual error accumulated since the last sync is frequency error
+    int64_t interval = monoUs - lastSyncMonoUs;
+    if (interval >= 60000000LL) {
+        int64_t measuredPpb = offsetUs * 1000000000LL / interval;
+        int64_t drift = driftPpb + measuredPpb / 2;  // Damped
+        if (drift > MAX_DRIFT_PPB) drift = MAX_DRIFT_PPB;
+        if (drift < -MAX_DRIFT_PPB) drift = -MAX_DRIFT_PPB;
+        driftPpb = (int32_t)drift;
+    }
+
+    // Rebase at the current estimate and slew the error out
+    baseMonoUs = monoUs;
+    baseEpochUs = estimate;
+    slewUs = offsetUs;
+    lastSyncMonoUs = monoUs;
+}
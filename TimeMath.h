@@ -0,0 +1,139 @@
+/* TimeMath.h
+   Platform-independent time math: civil dates, POSIX TZ rules, NTP packets
+   VERSION: V16.4.2-2026-01-11T14:00:00Z - Initial implementation
+
+   No Arduino or ESP-IDF dependencies - this file and TimeMath.cpp build
+   unchanged on a Linux host (g++ -std=c++17) for testing against
+   tools/ntp/ntp_standin.py.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace TimeMath {
+
+// Broken-down calendar time (proleptic Gregorian)
+struct DateTime {
+    int16_t year;
+    uint8_t month;     // 1-12
+    uint8_t day;       // 1-31
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t weekday;   // 0 = Sunday
+};
+
+// Days since 1970-01-01 <-> civil date
+int64_t daysFromCivil(int year, unsigned month, unsigned day);
+void civilFromDays(int64_t days, int& year, unsigned& month, unsigned& day);
+bool isLeapYear(int year);
+uint8_t daysInMonth(int year, unsigned month);
+
+// Epoch seconds <-> DateTime, fields taken as-is (no zone applied)
+void breakDown(int64_t epochSec, DateTime& out);
+int64_t toEpoch(const DateTime& dt);
+
+// Parse "YYYY-MM-DD HH:MM[:SS]" (or 'T' separator) with optional "Z" or
+// "+hh:mm" suffix. hasOffset tells whether the text pinned its own offset;
+// offsetSec is seconds east of UTC when it did.
+bool parseDateTime(const char* text, DateTime& out, bool& hasOffset, int32_t& offsetSec);
+
+} // namespace TimeMath
+
+// V16.4.2-2026-01-11T14:00:00Z - POSIX TZ string ("EST5EDT,M3.2.0,M11.1.0")
+// DST transitions are computed per year and cached; not thread-safe on its own.
+class PosixTimeZone {
+public:
+    PosixTimeZone();
+
+    bool parse(const char* spec);
+    bool hasDaylightTime() const { return hasDst; }
+
+    // Seconds east of UTC in effect at the given UTC instant
+    int32_t offsetAt(int64_t utcSec) const;
+    bool isDstAt(int64_t utcSec) const;
+    const char* abbreviation(int64_t utcSec) const;
+    int64_t toLocal(int64_t utcSec) const { return utcSec + offsetAt(utcSec); }
+
+    // Local wall-clock fields -> UTC. Times in the fall-back overlap resolve to
+    // the first (DST) instance; times in the spring-forward gap use standard time.
+    int64_t fromLocal(const TimeMath::DateTime& local) const;
+
+private:
+    struct Rule {
+        char type;       // 'M' month.week.day, 'J' Julian 1-365, 'N' zero-based day 0-365
+        int16_t month;
+        int16_t week;
+        int16_t day;
+        int32_t time;    // Seconds after local midnight (may be negative or > 24h)
+    };
+
+    char stdName[8];
+    char dstName[8];
+    int32_t stdOffset;   // Seconds east of UTC
+    int32_t dstOffset;
+    bool hasDst;
+    Rule startRule;
+    Rule endRule;
+
+    // Cached transitions (UTC) for one calendar year
+    mutable int cachedYear;
+    mutable int64_t cachedStart;
+    mutable int64_t cachedEnd;
+
+    void transitionsFor(int year, int64_t& start, int64_t& end) const;
+    int64_t ruleLocalSeconds(int year, const Rule& rule) const;
+};
+
+// V16.4.2-2026-01-11T14:00:00Z - SNTP client packet codec (RFC 4330)
+namespace Ntp {
+
+const size_t PACKET_SIZE = 48;
+const uint16_t PORT = 123;
+
+struct Sample {
+    int64_t offsetUs;      // Server clock minus local clock
+    int64_t delayUs;       // Round-trip network delay
+    uint8_t stratum;
+};
+
+// t1Us: local transmit time (epoch us), echoed by the server as "originate"
+void buildRequest(uint8_t* packet, int64_t t1Us);
+
+// t4Us: local receive time. Rejects kiss-o'-death, unsynchronized servers,
+// wrong mode and replies whose originate stamp does not match t1Us.
+bool parseResponse(const uint8_t* packet, size_t len, int64_t t1Us, int64_t t4Us, Sample& out);
+
+uint64_t toTimestamp(int64_t unixUs);
+int64_t fromTimestamp(uint64_t ntpTimestamp);
+
+} // namespace Ntp
+
+// V16.4.2-2026-01-11T14:00:00Z - Disciplined clock: monotonic CPU time -> epoch
+// Small corrections are slewed so the epoch never jumps; the residual error
+// between syncs trains a frequency (drift) correction.
+class ClockModel {
+public:
+    ClockModel();
+
+    int64_t epochUs(int64_t monoUs) const;
+    void apply(int64_t monoUs, int64_t offsetUs);
+
+    bool isSynced() const { return synced; }
+    int32_t getDriftPpb() const { return driftPpb; }
+    int64_t getLastSyncMonoUs() const { return lastSyncMonoUs; }
+
+    static const int64_t STEP_THRESHOLD_US = 128000;   // Larger errors are stepped
+    static const int64_t SLEW_WINDOW_US = 60000000;    // Slew spread over 60 s
+    static const int32_t MAX_DRIFT_PPB = 500000;       // +/-500 ppm
+
+private:
+    int64_t baseMonoUs;
+    int64_t baseEpochUs;
+    int64_t slewUs;
+    int64_t lastSyncMonoUs;
+    int32_t driftPpb;
+    bool synced;
+};
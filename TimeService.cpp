@@ -0,0 +1,201 @@
+/* TimeService.cpp
+   Background NTP time service implementation
+   VERSION: V16.4.2-2026-01-11T14:00:00Z - Initial implementation
+*/
+
+#include "TimeService.h"
+#include "Config.h"
+#include "Logger.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "esp_timer.h"
+
+#define NTP_LOCAL_PORT 2390
+#define NTP_SAMPLES 3               // Best (lowest delay) of N per sync
+#define NTP_REPLY_TIMEOUT_MS 1500
+
+TimeService timeService;
+
+TimeService::TimeService()
+    : task(nullptr), syncCount(0), lastDelayUs(0), logPending(false) {
+    lock = portMUX_INITIALIZER_UNLOCKED;
+    pendingLog[0] = '\0';
+}
+
+void TimeService::begin(const char* ntpServer, const char* posixTz) {
+    server = ntpServer;
+
+    if (!zone.parse(posixTz)) {
+        Logger::instance().log("[Time] Invalid TZ '" + String(posixTz) + "' - using UTC");
+        zone.parse("UTC0");
+    } else {
+        Logger::instance().log("[Time] Zone: " + String(posixTz));
+    }
+
+    if (task == nullptr) {
+        xTaskCreatePinnedToCore(taskEntry, "ntp", 4096, this, 1, &task, 0);
+    }
+}
+
+void TimeService::update() {
+    if (!logPending) return;
+
+    char msg[sizeof(pendingLog)];
+    portENTER_CRITICAL(&lock);
+    memcpy(msg, pendingLog, sizeof(msg));
+    logPending = false;
+    portEXIT_CRITICAL(&lock);
+
+    Logger::instance().log(msg);
+}
+
+void TimeService::postLog(const char* msg) {
+    // Logger is not thread-safe; hand the message to the main loop
+    portENTER_CRITICAL(&lock);
+    strncpy(pendingLog, msg, sizeof(pendingLog) - 1);
+    pendingLog[sizeof(pendingLog) - 1] = '\0';
+    logPending = true;
+    portEXIT_CRITICAL(&lock);
+}
+
+int64_t TimeService::epochUsAt(int64_t monoUs) {
+    portENTER_CRITICAL(&lock);
+    int64_t us = clock.epochUs(monoUs);
+    portEXIT_CRITICAL(&lock);
+    return us;
+}
+
+int64_t TimeService::nowEpochMs() {
+    return epochUsAt(esp_timer_get_time()) / 1000;
+}
+
+bool TimeService::isSynced() {
+    return clock.isSynced();
+}
+
+int32_t TimeService::getDriftPpb() {
+    return clock.getDriftPpb();
+}
+
+int64_t TimeService::getLastDelayUs() {
+    portENTER_CRITICAL(&lock);
+    int64_t us = lastDelayUs;
+    portEXIT_CRITICAL(&lock);
+    return us;
+}
+
+// Zone lookups share the lock because PosixTimeZone caches per-year transitions
+void TimeService::localTime(time_t utc, TimeMath::DateTime& out) {
+    portENTER_CRITICAL(&lock);
+    int64_t local = zone.toLocal(utc);
+    portEXIT_CRITICAL(&lock);
+    TimeMath::breakDown(local, out);
+}
+
+int32_t TimeService::utcOffsetAt(time_t utc) {
+    portENTER_CRITICAL(&lock);
+    int32_t offset = zone.offsetAt(utc);
+    portEXIT_CRITICAL(&lock);
+    return offset;
+}
+
+time_t TimeService::parseLocalDateTime(const String& text) {
+    TimeMath::DateTime dt;
+    bool hasOffset;
+    int32_t offsetSec;
+    if (!TimeMath::parseDateTime(text.c_str(), dt, hasOffset, offsetSec)) {
+        return 0;
+    }
+    if (hasOffset) {
+        return (time_t)(TimeMath::toEpoch(dt) - offsetSec);
+    }
+
+    portENTER_CRITICAL(&lock);
+    int64_t utc = zone.fromLocal(dt);
+    portEXIT_CRITICAL(&lock);
+    return (time_t)utc;
+}
+
+void TimeService::taskEntry(void* arg) {
+    static_cast<TimeService*>(arg)->run();
+}
+
+void TimeService::run() {
+    WiFiUDP udp;
+    bool udpOpen = false;
+    uint32_t retryMs = NTP_RETRY_MIN_MS;
+
+    for (;;) {
+        if (WiFi.status() != WL_CONNECTED) {
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+        if (!udpOpen) {
+            udpOpen = udp.begin(NTP_LOCAL_PORT);
+        }
+
+        // DNS runs here so a slow resolver never stalls loop()
+        IPAddress serverIP;
+        bool ok = udpOpen && WiFi.hostByName(server.c_str(), serverIP) && syncOnce(udp, serverIP);
+
+        if (ok) {
+            retryMs = NTP_RETRY_MIN_MS;
+            vTaskDelay(pdMS_TO_TICKS(NTP_SYNC_INTERVAL_MS));
+        } else {
+            postLog("[Time] NTP sync failed - retrying");
+            vTaskDelay(pdMS_TO_TICKS(retryMs));
+            retryMs = min(retryMs * 2, (uint32_t)NTP_RETRY_MAX_MS);
+        }
+    }
+}
+
+bool TimeService::syncOnce(WiFiUDP& udp, IPAddress& serverIP) {
+    uint8_t packet[Ntp::PACKET_SIZE];
+    Ntp::Sample best;
+    bool haveSample = false;
+
+    for (int i = 0; i < NTP_SAMPLES; i++) {
+        while (udp.parsePacket() > 0) udp.flush();  // Drop stale replies
+
+        int64_t t1 = epochUsAt(esp_timer_get_time());
+        Ntp::buildRequest(packet, t1);
+        if (!udp.beginPacket(serverIP, Ntp::PORT)) continue;
+        udp.write(packet, Ntp::PACKET_SIZE);
+        if (!udp.endPacket()) continue;
+
+        int64_t deadline = esp_timer_get_time() + NTP_REPLY_TIMEOUT_MS * 1000LL;
+        while (esp_timer_get_time() < deadline) {
+            int len = udp.parsePacket();
+            if (len > 0) {
+                int64_t t4 = epochUsAt(esp_timer_get_time());
+                int n = udp.read(packet, sizeof(packet));
+                Ntp::Sample sample;
+                if (Ntp::parseResponse(packet, n, t1, t4, sample)) {
+                    if (!haveSample || sample.delayUs < best.delayUs) {
+                        best = sample;
+                        haveSample = true;
+                    }
+                    break;
+                }
+                continue;  // Late reply to an earlier request - keep waiting
+            }
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+    }
+    if (!haveSample) return false;
+
+    portENTER_CRITICAL(&lock);
+    bool wasSynced = clock.isSynced();
+    clock.apply(esp_timer_get_time(), best.offsetUs);
+    lastDelayUs = best.delayUs;
+    int32_t drift = clock.getDriftPpb();
+    portEXIT_CRITICAL(&lock);
+    syncCount++;
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "[Time] NTP %s: offset %lld ms, delay %lld ms, drift %ld ppb",
+             wasSynced ? "sync" : "initial sync",
+             (long long)(best.offsetUs / 1000), (long long)(best.delayUs / 1000), (long)drift);
+    postLog(msg);
+    return true;
+}
@@ -0,0 +1,67 @@
+/* TimeService.h
+   Background NTP time service with timezone rules
+   VERSION: V16.4.2-2026-01-11T14:00:00Z - Initial implementation
+
+   NTP runs in its own FreeRTOS task; nothing on the render path touches the network.
+   nowEpochMs() reads the CPU clock (esp_timer) through a drift-corrected model.
+   Local time uses a POSIX TZ string so DST changes need no code changes.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "TimeMath.h"
+
+class WiFiUDP;
+
+class TimeService {
+public:
+    TimeService();
+
+    // Parse the zone and start the background sync task (safe before WiFi is up)
+    void begin(const char* ntpServer, const char* posixTz);
+
+    // Called from loop(): forwards sync results from the task to Logger
+    void update();
+
+    // Current UTC time. Before the first sync this is time since boot.
+    int64_t nowEpochMs();
+    time_t nowEpoch() { return (time_t)(nowEpochMs() / 1000); }
+    bool isSynced();
+
+    // UTC <-> local wall-clock time using the configured zone
+    void localTime(time_t utc, TimeMath::DateTime& out);
+    int32_t utcOffsetAt(time_t utc);
+
+    // "YYYY-MM-DD HH:MM[:SS]" as local time (or as given if it carries Z/+hh:mm); 0 on error
+    time_t parseLocalDateTime(const String& text);
+
+    // Diagnostics
+    int32_t getDriftPpb();
+    uint32_t getSyncCount() const { return syncCount; }
+    int64_t getLastDelayUs();
+
+private:
+    String server;
+    PosixTimeZone zone;
+    ClockModel clock;
+    portMUX_TYPE lock;
+    TaskHandle_t task;
+
+    volatile uint32_t syncCount;
+    int64_t lastDelayUs;        // Guarded by lock
+
+    // One pending message from the task, drained by update()
+    char pendingLog[96];
+    volatile bool logPending;
+
+    static void taskEntry(void* arg);
+    void run();
+    bool syncOnce(WiFiUDP& udp, IPAddress& serverIP);
+    int64_t epochUsAt(int64_t monoUs);
+    void postLog(const char* msg);
+};
+
+extern TimeService timeService;
@@ -0,0 +1,367 @@
+/* TraceLog.cpp
+   Trace event recording, flash ring and decoding
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - pendingPages(): no allocation inside the critical section
+   V16.7.1-2026-01-14T12:00:00Z - Initial implementation
+*/
+
+#include "TraceLog.h"
+#include "Logger.h"
+#include <WiFi.h>
+#include <time.h>
+#include <algorithm>
+#include "esp_system.h"
+
+TraceLog traceLog;
+
+// Pages waiting for flash, head being filled. Kept over resets (not power loss); begin()
+// trusts it only after a reset and when it checks out.
+struct TraceRtc {
+    uint32_t magic;
+    uint16_t boot;
+    uint8_t head;      // Page being filled
+    uint8_t tail;      // Oldest page not in flash yet (== head: none filled)
+    uint32_t dropped;  // Events lost because every page was waiting for flash
+    TracePage pages[TRACE_RAM_PAGES];
+};
+
+static RTC_NOINIT_ATTR TraceRtc rtc;
+
+struct TraceEventInfo {
+    const char* name;
+    const char* a;
+    const char* b;
+};
+
+static const TraceEventInfo EVENT_INFO[TRACE_EVENT_COUNT] = {
+#define TRACE_INFO(id, name, a, b) {name, a, b},
+    TRACE_EVENTS(TRACE_INFO)
+#undef TRACE_INFO
+};
+
+// CRC-32 as zlib computes it, a nibble at a time (16-entry table); once per page
+static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t length) {
+    static const uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ TABLE[crc & 15];
+        crc = (crc >> 4) ^ TABLE[crc & 15];
+    }
+    return ~crc;
+}
+
+static uint32_t pageCrc(const TracePage& page) {
+    uint32_t crc = crc32(0, (const uint8_t*)&page, offsetof(TracePage, crc));
+    return crc32(crc, (const uint8_t*)page.records, page.count * sizeof(TraceRecord));
+}
+
+static bool pageValid(const TracePage& page) {
+    return page.magic == TRACE_MAGIC && page.version == TRACE_VERSION &&
+           page.count <= TRACE_PAGE_RECORDS && page.crc == pageCrc(page);
+}
+
+static void sealPage(TracePage& page, uint32_t seq) {
+    page.magic = TRACE_MAGIC;
+    page.version = TRACE_VERSION;
+    page.seq = seq;
+    page.crc = pageCrc(page);
+}
+
+static bool rtcValid() {
+    if (rtc.magic != TRACE_MAGIC || rtc.head >= TRACE_RAM_PAGES || rtc.tail >= TRACE_RAM_PAGES) return false;
+    for (int i = 0; i < TRACE_RAM_PAGES; i++) {
+        if (rtc.pages[i].count > TRACE_PAGE_RECORDS) return false;
+    }
+    return true;
+}
+
+static void startPage(TracePage& page, uint16_t boot) {
+    page.magic = 0;  // Not sequenced
+    page.boot = boot;
+    page.count = 0;
+}
+
+void TraceLog::begin() {
+    if (started) return;
+    int reason = esp_reset_reason();
+    bool kept = reason != ESP_RST_POWERON && rtcValid();
+
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)TRACE_PARTITION_SUBTYPE,
+                                         TRACE_PARTITION_LABEL);
+    uint16_t lastBoot = kept ? rtc.boot : 0;
+    if (partition) {
+        slots = partition->size / TRACE_PAGE_BYTES;
+        findHead(lastBoot);
+    }
+    boot = lastBoot + 1;
+
+    // What the reset caught before update() wrote it; pages whose write had finished are
+    // already in flash
+    uint32_t recoveredEvents = 0;
+    uint32_t recoveredPages = 0;
+    if (kept) {
+        for (uint8_t i = rtc.tail;; i = (i + 1) % TRACE_RAM_PAGES) {
+            TracePage& page = rtc.pages[i];
+            if (page.count > 0 && !inFlash(page) && writePage(page)) {
+                recoveredEvents += page.count;
+                recoveredPages++;
+            }
+            if (i == rtc.head) break;
+        }
+    }
+
+    rtc.magic = TRACE_MAGIC;
+    rtc.boot = boot;
+    rtc.head = rtc.tail = 0;
+    rtc.dropped = 0;
+    startPage(rtc.pages[0], boot);
+    started = true;
+
+    event(TRACE_BOOT, reason, ESP.getFreeHeap());
+    if (recoveredPages) event(TRACE_RECOVERED, recoveredEvents, recoveredPages);
+
+    if (partition) {
+        LOG_I("[Trace] Boot %u after %s reset; %u KB ring at page %lu, %lu events recovered", boot,
+              resetReasonName(reason), (unsigned)(partition->size / 1024), (unsigned long)nextSeq,
+              (unsigned long)recoveredEvents);
+    } else {
+        LOG_W("[Trace] No '%s' partition - events are not kept", TRACE_PARTITION_LABEL);
+    }
+}
+
+void TraceLog::event(TraceEvent id, int32_t a, int32_t b) {
+    if (!started) return;
+    uint32_t now = millis();
+    portENTER_CRITICAL(&lock);
+    TracePage* page = &rtc.pages[rtc.head];
+    if (page->count == TRACE_PAGE_RECORDS) {
+        uint8_t next = (rtc.head + 1) % TRACE_RAM_PAGES;
+        if (next == rtc.tail) {  // Every page waiting for flash
+            rtc.dropped++;
+            portEXIT_CRITICAL(&lock);
+            return;
+        }
+        rtc.head = next;
+        page = &rtc.pages[next];
+        startPage(*page, boot);
+    }
+    TraceRecord& record = page->records[page->count];
+    record.timeMs = now;
+    record.event = id;
+    record.core = xPortGetCoreID();
+    record.reserved = 0;
+    record.a = a;
+    record.b = b;
+    page->count++;
+    // A full page is handed to update() at once, so the queue drains without new events
+    if (page->count == TRACE_PAGE_RECORDS) {
+        uint8_t next = (rtc.head + 1) % TRACE_RAM_PAGES;
+        if (next != rtc.tail) {
+            rtc.head = next;
+            startPage(rtc.pages[next], boot);
+        }
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+void TraceLog::update() {
+    if (!started) return;
+
+    // Filled pages, oldest first. event() never touches a page between tail and head.
+    while (true) {
+        portENTER_CRITICAL(&lock);
+        if (rtc.pages[rtc.head].count == TRACE_PAGE_RECORDS) {  // Filled while the queue was full
+            uint8_t next = (rtc.head + 1) % TRACE_RAM_PAGES;
+            if (next != rtc.tail) {
+                rtc.head = next;
+                startPage(rtc.pages[next], boot);
+            }
+        }
+        uint8_t tail = rtc.tail;
+        bool filled = tail != rtc.head;
+        portEXIT_CRITICAL(&lock);
+        if (!filled) break;
+        writePage(rtc.pages[tail]);
+        portENTER_CRITICAL(&lock);
+        rtc.tail = (tail + 1) % TRACE_RAM_PAGES;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    uint32_t dropped = getDropped();
+    if (dropped != droppedReported) {
+        event(TRACE_DROPPED, dropped - droppedReported);
+        droppedReported = dropped;
+    }
+
+    uint32_t now = millis();
+    if (now - lastCheckMs < 1000) return;
+    lastCheckMs = now;
+
+    int wifi = WiFi.status();
+    if (wifi != lastWifi) {
+        lastWifi = wifi;
+        event(TRACE_WIFI, wifi, wifi == WL_CONNECTED ? WiFi.RSSI() : 0);
+    }
+    if (!clockTraced) {
+        time_t wall = time(nullptr);
+        if (wall > 1600000000) {  // Synced; ties this boot's millis() to wall time
+            clockTraced = true;
+            event(TRACE_CLOCK, (int32_t)wall);
+        }
+    }
+    if (now - lastHeapMs >= TRACE_HEAP_MS) {
+        lastHeapMs = now;
+        event(TRACE_HEAP, ESP.getFreeHeap(), ESP.getMinFreeHeap());
+    }
+}
+
+uint32_t TraceLog::getDropped() const {
+    return started ? rtc.dropped : 0;
+}
+
+// Newest valid page decides where the ring is up to; boot numbers continue from the
+// highest one seen
+void TraceLog::findHead(uint16_t& lastBoot) {
+    bool any = false;
+    uint32_t newest = 0;
+    for (uint32_t slot = 0; slot < slots; slot++) {
+        if (!readSlot(slot, scratch) || scratch.seq % slots != slot) continue;
+        if (!any || scratch.seq > newest) newest = scratch.seq;
+        if (scratch.boot > lastBoot) lastBoot = scratch.boot;
+        any = true;
+    }
+    nextSeq = any ? newest + 1 : 0;
+
+    // A reset while programming can leave a page that fails its check but is not blank;
+    // move past it rather than program over it (the sector start is erased before use)
+    const uint32_t perSector = TRACE_SECTOR_BYTES / TRACE_PAGE_BYTES;
+    while (nextSeq % perSector != 0) {
+        if (esp_partition_read(partition, (nextSeq % slots) * TRACE_PAGE_BYTES, &scratch, TRACE_PAGE_BYTES) != ESP_OK) break;
+        const uint8_t* bytes = (const uint8_t*)&scratch;
+        bool blank = true;
+        for (int i = 0; i < TRACE_PAGE_BYTES && blank; i++) blank = bytes[i] == 0xFF;
+        if (blank) break;
+        nextSeq++;
+    }
+}
+
+bool TraceLog::readSlot(uint32_t slot, TracePage& page) {
+    if (!partition || esp_partition_read(partition, slot * TRACE_PAGE_BYTES, &page, TRACE_PAGE_BYTES) != ESP_OK) {
+        return false;
+    }
+    return pageValid(page);
+}
+
+bool TraceLog::inFlash(const TracePage& page) {
+    if (page.magic != TRACE_MAGIC || !partition) return false;
+    return readSlot(page.seq % slots, scratch) && scratch.seq == page.seq && scratch.crc == page.crc;
+}
+
+// Sequences the page (in RTC memory too, so begin() can tell if it made it) and programs
+// it at its slot, erasing the sector first when the slot starts one
+bool TraceLog::writePage(TracePage& page) {
+    if (!partition) return false;
+    uint32_t seq = nextSeq++;  // Also on failure: never program the same bytes twice
+    sealPage(page, seq);
+    scratch = page;
+
+    size_t offset = (seq % slots) * TRACE_PAGE_BYTES;
+    if (offset % TRACE_SECTOR_BYTES == 0) {
+        if (esp_partition_erase_range(partition, offset, TRACE_SECTOR_BYTES) != ESP_OK) {
+            failures++;
+            return false;
+        }
+        erases++;
+    }
+    if (esp_partition_write(partition, offset, &scratch, TRACE_PAGE_BYTES) != ESP_OK) {
+        failures++;
+        return false;
+    }
+    pagesWritten++;
+    return true;
+}
+
+void TraceLog::pendingPages(std::vector<TracePage>& out) {
+    if (!started) return;
+    size_t first = out.size();
+    out.reserve(first + TRACE_RAM_PAGES);  // push_back below must not allocate: interrupts are off
+    portENTER_CRITICAL(&lock);
+    for (uint8_t i = rtc.tail;; i = (i + 1) % TRACE_RAM_PAGES) {
+        if (rtc.pages[i].count > 0) out.push_back(rtc.pages[i]);
+        if (i == rtc.head) break;
+    }
+    portEXIT_CRITICAL(&lock);
+    for (size_t i = first; i < out.size(); i++) sealPage(out[i], nextSeq + (i - first));
+}
+
+String TraceLog::json(int limit) {
+    // Newest pages first until `limit` events are covered: RAM, then flash backwards
+    std::vector<TracePage> pages;
+    pendingPages(pages);
+    std::reverse(pages.begin(), pages.end());
+    int events = 0;
+    for (const TracePage& page : pages) events += page.count;
+    TracePage page;
+    for (uint32_t back = 1; partition && events < limit && back <= slots && back <= nextSeq; back++) {
+        uint32_t seq = nextSeq - back;
+        if (!readSlot(seq % slots, page) || page.seq != seq) break;  // Overwritten or torn
+        pages.push_back(page);
+        events += page.count;
+    }
+
+    String out;
+    out.reserve(200 + min(events, limit) * 80);
+    out += "{\"boot\":" + String(boot) + ",\"partition\":" + String(partition ? "true" : "false") +
+           ",\"bytes\":" + String(partition ? partition->size : 0) + ",\"pagesWritten\":" + String(pagesWritten) +
+           ",\"erases\":" + String(erases) + ",\"failures\":" + String(failures) +
+           ",\"dropped\":" + String(getDropped()) + ",\"events\":[";
+    int skip = events > limit ? events - limit : 0;
+    bool first = true;
+    for (auto it = pages.rbegin(); it != pages.rend(); ++it) {
+        for (int r = 0; r < it->count; r++) {
+            if (skip > 0) {
+                skip--;
+                continue;
+            }
+            const TraceRecord& record = it->records[r];
+            if (!first) out += ",";
+            first = false;
+            out += "{\"boot\":" + String(it->boot) + ",\"ms\":" + String(record.timeMs) +
+                   ",\"core\":" + String(record.core) + ",\"event\":\"" + eventName(record.event) + "\"";
+            if (record.event < TRACE_EVENT_COUNT) {
+                const TraceEventInfo& info = EVENT_INFO[record.event];
+                if (*info.a) out += ",\"" + String(info.a) + "\":" + String(record.a);
+                if (*info.b) out += ",\"" + String(info.b) + "\":" + String(record.b);
+                if (record.event == TRACE_BOOT) out += ",\"reset\":\"" + String(resetReasonName(record.a)) + "\"";
+            } else {
+                out += ",\"id\":" + String(record.event) + ",\"a\":" + String(record.a) + ",\"b\":" + String(record.b);
+            }
+            out += "}";
+        }
+    }
+    out += "]}";
+    return out;
+}
+
+const char* TraceLog::eventName(uint16_t id) {
+    return id < TRACE_EVENT_COUNT ? EVENT_INFO[id].name : "unknown";
+}
+
+const char* TraceLog::resetReasonName(int reason) {
+    switch (reason) {
+        case ESP_RST_POWERON: return "power-on";
+        case ESP_RST_EXT: return "external";
+        case ESP_RST_SW: return "software";
+        case ESP_RST_PANIC: return "panic";
+        case ESP_RST_INT_WDT: return "interrupt watchdog";
+        case ESP_RST_TASK_WDT: return "task watchdog";
+        case ESP_RST_WDT: return "watchdog";
+        case ESP_RST_DEEPSLEEP: return "deep sleep";
+        case ESP_RST_BROWNOUT: return "brownout";
+        case ESP_RST_SDIO: return "SDIO";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,137 @@
+/* TraceLog.h
+   Crash-surviving binary event trace (flash ring + RTC memory)
+   VERSION: V16.7.3-2026-01-14T18:00:00Z - realtime event (E1.31/DDP input on or off)
+   V16.7.1-2026-01-14T12:00:00Z - Initial implementation
+
+   Logger lines live in RAM and are gone after a brownout or watchdog reset. The trace
+   keeps a much smaller record of what the show was doing that does survive: an event id
+   and two numbers, 16 bytes, no text. event() stores it in a page buffer in RTC memory
+   under a spinlock - no formatting and no flash access, a few microseconds from any task
+   (not from an ISR).
+   update() (loop) writes each filled page of TRACE_PAGE_RECORDS events to the "trace"
+   partition as one 256-byte program. Pages go round the partition in sequence order, so
+   each sector is erased once per lap (wear is spread evenly over all of them) and the
+   erase, the only slow step, happens in the loop between frames, once per 240 events.
+   RTC memory survives every reset but power loss: begin() first writes out the pages a
+   reset caught in RTC memory, including the partly filled one, then logs a boot event
+   with the reset reason.
+   Every page carries its sequence number, the boot it was filled in and a CRC, so a page
+   torn by a reset while being programmed is skipped and the order survives wrap-around.
+   Decoded on the device at /api/trace, or from a dump (/api/trace?raw=1 or esptool
+   read_flash of the partition) by tools/trace_decode.py, which reads the event table
+   below - keep it one X(...) per line.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include "Config.h"
+#include "esp_partition.h"
+
+//  X(id, name, first argument, second argument) - "" = unused; append only, the
+//  position is the id stored in flash
+#define TRACE_EVENTS(X) \
+    X(TRACE_BOOT,       "boot",       "reason",  "heap")    \
+    X(TRACE_RECOVERED,  "recovered",  "events",  "pages")   \
+    X(TRACE_DROPPED,    "dropped",    "events",  "")        \
+    X(TRACE_CLOCK,      "clock",      "unix",    "")        \
+    X(TRACE_WIFI,       "wifi",       "status",  "rssi")    \
+    X(TRACE_HEAP,       "heap",       "free",    "minFree") \
+    X(TRACE_STALL,      "stall",      "us",      "heap")    \
+    X(TRACE_PLAY,       "play",       "id",      "type")    \
+    X(TRACE_ZONE,       "zone",       "zone",    "id")      \
+    X(TRACE_THEME,      "theme",      "theme",   "blendMs") \
+    X(TRACE_BRIGHTNESS, "brightness", "value",   "")        \
+    X(TRACE_REALTIME,   "realtime",   "on",      "source")
+
+enum TraceEvent : uint16_t {
+#define TRACE_ENUM(id, name, a, b) id,
+    TRACE_EVENTS(TRACE_ENUM)
+#undef TRACE_ENUM
+    TRACE_EVENT_COUNT
+};
+
+#define TRACE_MAGIC 0x31435254  // "TRC1"
+#define TRACE_VERSION 1
+#define TRACE_PAGE_BYTES 256    // Flash program unit
+#define TRACE_PAGE_RECORDS 15
+#define TRACE_SECTOR_BYTES 4096 // Flash erase unit
+
+struct TraceRecord {
+    uint32_t timeMs;  // millis() in that boot
+    uint16_t event;   // TraceEvent
+    uint8_t core;
+    uint8_t reserved;
+    int32_t a;
+    int32_t b;
+};
+
+struct TracePage {
+    uint32_t magic;  // TRACE_MAGIC once sequenced for flash
+    uint32_t seq;    // Page number since the partition was first used
+    uint16_t boot;
+    uint8_t count;   // Records used
+    uint8_t version;
+    uint32_t crc;    // CRC-32 of the 12 bytes above and the used records
+    TraceRecord records[TRACE_PAGE_RECORDS];
+};
+
+static_assert(sizeof(TraceRecord) == 16, "trace record layout");
+static_assert(sizeof(TracePage) == TRACE_PAGE_BYTES, "trace page layout");
+
+class TraceLog {
+public:
+    TraceLog() {}
+
+    // Setup, before anything worth tracing: finds the partition and where the ring is up
+    // to, writes out what RTC memory kept, logs TRACE_BOOT
+    void begin();
+
+    // loop(): writes filled pages; samples WiFi, heap and the clock
+    void update();
+
+    // Any task
+    void event(TraceEvent id, int32_t a = 0, int32_t b = 0);
+
+    // Loop task. Newest `limit` events, oldest first, as JSON
+    String json(int limit);
+    // Pages not in flash yet (oldest first), sequenced as they will be written
+    void pendingPages(std::vector<TracePage>& out);
+
+    const esp_partition_t* getPartition() const { return partition; }
+    uint16_t getBoot() const { return boot; }
+    uint32_t getPagesWritten() const { return pagesWritten; }
+    uint32_t getErases() const { return erases; }
+    uint32_t getFailures() const { return failures; }
+    uint32_t getDropped() const;
+
+    static const char* eventName(uint16_t id);
+    static const char* resetReasonName(int reason);
+
+private:
+    const esp_partition_t* partition = nullptr;
+    uint32_t slots = 0;    // Pages in the partition
+    uint32_t nextSeq = 0;  // Sequence of the next page written
+    uint16_t boot = 0;
+    bool started = false;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    TracePage scratch;     // Flash writes go from internal RAM
+
+    uint32_t pagesWritten = 0;
+    uint32_t erases = 0;
+    uint32_t failures = 0;
+    uint32_t droppedReported = 0;
+    uint32_t lastCheckMs = 0;
+    uint32_t lastHeapMs = 0;
+    int lastWifi = -1;
+    bool clockTraced = false;
+
+    void findHead(uint16_t& lastBoot);
+    bool readSlot(uint32_t slot, TracePage& page);
+    bool inFlash(const TracePage& page);
+    bool writePage(TracePage& page);
+};
+
+extern TraceLog traceLog;
@@ -1,110 +1,207 @@
 /* WebActions.cpp
    API endpoints for web interface
-   VERSION: V16.1.3-2026-01-09T05:25:00Z - Added brightness control with NVS
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - /api/batch checks zone playability before applying
+   V16.7.3-2026-01-14T18:00:00Z - /api/realtime (E1.31/DDP input) and its /metrics
+   V16.7.2-2026-01-14T15:00:00Z - /api/profile: frame profiler capture and trace_event download
+   V16.7.1-2026-01-14T12:00:00Z - /api/trace (crash-surviving event trace)
+   V16.6.6-2026-01-14T06:00:00Z - /metrics (Prometheus text)
+   V16.6.5-2026-01-14T03:00:00Z - POST /api/batch: many commands, validated then applied together
+   V16.6.4-2026-01-14T00:00:00Z - /api/status body in statusJson(), with brightness
+   V16.6.3-2026-01-13T21:00:00Z - Live preview rate and stats (/api/preview)
+   V16.6.2-2026-01-13T18:00:00Z - Content/themes/settings JSON cached with ETags; /api/webcache
+   V16.6.1-2026-01-13T15:00:00Z - JSON API for the static UI (/api/content|themes|status|settings)
+   V16.6.0-2026-01-13T12:00:00Z - Handlers take the AsyncWebServerRequest and run from loop()
+   V16.5.8-2026-01-13T09:00:00Z - Frame cache stats (/api/framecache)
+   V16.5.7-2026-01-13T06:00:00Z - Per-zone playback (/api/zone)
+   V16.5.4-2026-01-12T21:00:00Z - Power estimate and budgets (/api/power)
+   V16.5.3-2026-01-12T18:00:00Z - Per-output gamma/white point (/api/color)
+   V16.4.4-2026-01-11T20:00:00Z - Theme selection by name with optional blend
+   V16.1.3-2026-01-09T05:25:00Z - Added brightness control with NVS
 */
 
 #include "WebActions.h"
+#include "WebController.h"
+#include "WebPages.h"
 #include "ContentManager.h"
 #include "ThemeManager.h"
 #include "MatrixDisplay.h"
+#include "ZoneManager.h"
+#include "FrameCache.h"
+#include "LivePreview.h"
+#include "EventStream.h"
+#include "Metrics.h"
+#include "TraceLog.h"
+#include "Profiler.h"
+#include "RealtimeReceiver.h"
 #include "Logger.h"
-#include <WebServer.h>
 #include <Preferences.h>
+#include <WiFi.h>
+#include <ArduinoJson.h>
+#include <vector>
 
 static Preferences prefs;
 
-WebActions::WebActions(ContentManager* cm, ThemeManager* tm, MatrixDisplay* disp, WebServer* srv)
-: contentMgr(cm), themeMgr(tm), display(disp), server(srv) {}
+// V16.6.1-2026-01-13T15:00:00Z - Quoted JSON string (names come from file paths)
+static String jsonString(const String& text) {
+    String out = "\"";
+    for (const char* p = text.c_str(); *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            out += '\\';
+            out += *p;
+        } else if ((uint8_t)*p < 0x20) {
+            out += ' ';
+        } else {
+            out += *p;
+        }
+    }
+    out += "\"";
+    return out;
+}
+
+static const char* contentTypeName(ContentType type) {
+    switch (type) {
+        case CONTENT_SCENE: return "scene";
+        case CONTENT_ANIMATION: return "animation";
+        case CONTENT_SCROLL: return "scroll";
+        case CONTENT_COUNTDOWN: return "countdown";
+        case CONTENT_PROCEDURAL: return "procedural";
+        case CONTENT_TEST: return "test";
+    }
+    return "unknown";
+}
+
+// V16.6.1-2026-01-13T15:00:00Z - Content list, one item per fragment (size grows with the library)
+class ContentListJson : public PageSource {
+public:
+    explicit ContentListJson(ContentManager* c) : content(c) {}
+
+    bool next(String& out) override {
+        const auto& items = content->getContent();
+        if (index > items.size()) return false;
+        if (index == items.size()) {
+            out += index ? "]}" : "{\"items\":[]}";
+            index++;
+            return true;
+        }
+        const ContentItem& item = items[index];
+        out += index ? "," : "{\"items\":[";
+        out += "{\"id\":" + String(item.id) + ",\"name\":" + jsonString(item.name) +
+               ",\"theme\":" + jsonString(item.theme) + ",\"type\":\"" + contentTypeName(item.type) + "\"}";
+        index++;
+        return true;
+    }
+
+private:
+    ContentManager* content;
+    size_t index = 0;
+};
+
+// V16.7.2-2026-01-14T15:00:00Z - Profiler capture as Chrome trace_event JSON; holds the
+// capture (start() is refused) until the download is finished or dropped
+class ProfileTraceJson : public PageSource {
+public:
+    ProfileTraceJson() { profiler.beginExport(); }
+    ~ProfileTraceJson() override { profiler.endExport(); }
+
+    bool next(String& out) override { return profiler.nextTraceFragment(cursor, out); }
+
+private:
+    uint32_t cursor = 0;
+};
+
+WebActions::WebActions(ContentManager* cm, ThemeManager* tm, MatrixDisplay* disp, WebController* ctl)
+: contentMgr(cm), themeMgr(tm), display(disp), web(ctl) {}
 
 void WebActions::attach() {
     
     // Content rendering
-    server->on("/api/render", HTTP_GET, [this]() {
-        if (!server->hasArg("id")) {
-            server->send(400, "text/plain", "Missing 'id' parameter");
+    web->on("/api/render", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!request->hasArg("id")) {
+            request->send(400, "text/plain", "Missing 'id' parameter");
             return;
         }
         
-        uint16_t id = server->arg("id").toInt();
+        uint16_t id = request->arg("id").toInt();
+        zones.stopAll();  // V16.5.7-2026-01-13T06:00:00Z - Full-display content takes over
         bool success = contentMgr->renderContent(id);
         
         const ContentItem* item = contentMgr->getContentById(id);
-        String response = success ? "âœ… Rendering: " + (item ? item->name : "Unknown") : "âŒ Content not found";
-        server->send(success ? 200 : 404, "text/plain", response);
+        String response = success ? "✅ Rendering: " + (item ? item->name : "Unknown") : "❌ Content not found";
+        request->send(success ? 200 : 404, "text/plain", response);
     });
     
     // Clear display
-    server->on("/api/clear", HTTP_GET, [this]() {
+    web->on("/api/clear", HTTP_GET, [this](AsyncWebServerRequest* request) {
         if (display) {
             display->clear();
             display->show();
         }
         Logger::instance().log("[WebActions] Display cleared");
-        server->send(200, "text/plain", "âœ… Display cleared");
+        request->send(200, "text/plain", "✅ Display cleared");
     });
     
     // Test pattern
-    server->on("/api/test", HTTP_GET, [this]() {
+    web->on("/api/test", HTTP_GET, [this](AsyncWebServerRequest* request) {
         Logger::instance().log("[WebActions] Test pattern activated");
-        server->send(200, "text/plain", "âœ… Test pattern activated");
+        request->send(200, "text/plain", "✅ Test pattern activated");
     });
     
     // Random mode control
-    server->on("/api/random/enable", HTTP_GET, [this]() {
+    web->on("/api/random/enable", HTTP_GET, [this](AsyncWebServerRequest* request) {
         contentMgr->enableRandomMode(true);
-        server->send(200, "text/plain", "âœ… Random mode ENABLED");
+        request->send(200, "text/plain", "✅ Random mode ENABLED");
     });
     
-    server->on("/api/random/disable", HTTP_GET, [this]() {
+    web->on("/api/random/disable", HTTP_GET, [this](AsyncWebServerRequest* request) {
         contentMgr->enableRandomMode(false);
-        server->send(200, "text/plain", "â›” Random mode DISABLED");
+        request->send(200, "text/plain", "⛔ Random mode DISABLED");
     });
     
-    server->on("/api/random/interval", HTTP_GET, [this]() {
-        if (!server->hasArg("ms")) {
-            server->send(400, "text/plain", "Missing 'ms' parameter");
+    web->on("/api/random/interval", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!request->hasArg("ms")) {
+            request->send(400, "text/plain", "Missing 'ms' parameter");
             return;
         }
         
-        unsigned long intervalMs = server->arg("ms").toInt();
+        unsigned long intervalMs = request->arg("ms").toInt();
         contentMgr->setRandomInterval(intervalMs);
-        server->send(200, "text/plain", "âœ… Interval set to " + String(intervalMs) + " ms");
+        request->send(200, "text/plain", "✅ Interval set to " + String(intervalMs) + " ms");
     });
     
-    server->on("/api/random/filter", HTTP_GET, [this]() {
-        if (!server->hasArg("theme")) {
-            server->send(400, "text/plain", "Missing 'theme' parameter");
+    web->on("/api/random/filter", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!request->hasArg("theme")) {
+            request->send(400, "text/plain", "Missing 'theme' parameter");
             return;
         }
         
-        String theme = server->arg("theme");
+        String theme = request->arg("theme");
         contentMgr->setRandomThemeFilter(theme);
         
         String response = theme.length() > 0 ? 
-                         "âœ… Filter set to: " + theme : 
-                         "âœ… Filter cleared (ALL THEMES)";
-        server->send(200, "text/plain", response);
+                         "✅ Filter set to: " + theme : 
+                         "✅ Filter cleared (ALL THEMES)";
+        request->send(200, "text/plain", response);
     });
     
     // Scheduler control
-    server->on("/api/scheduler/enable", HTTP_GET, [this]() {
+    web->on("/api/scheduler/enable", HTTP_GET, [this](AsyncWebServerRequest* request) {
         contentMgr->enableScheduler(true);
-        server->send(200, "text/plain", "âœ… Scheduler ENABLED");
+        request->send(200, "text/plain", "✅ Scheduler ENABLED");
     });
     
-    server->on("/api/scheduler/disable", HTTP_GET, [this]() {
+    web->on("/api/scheduler/disable", HTTP_GET, [this](AsyncWebServerRequest* request) {
         contentMgr->enableScheduler(false);
-        server->send(200, "text/plain", "â›” Scheduler DISABLED");
+        request->send(200, "text/plain", "⛔ Scheduler DISABLED");
     });
     
     // Brightness control
-    server->on("/api/brightness", HTTP_GET, [this]() {
-        if (!server->hasArg("value")) {
-            server->send(400, "text/plain", "Missing 'value' parameter");
+    web->on("/api/brightness", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!request->hasArg("value")) {
+            request->send(400, "text/plain", "Missing 'value' parameter");
             return;
         }
         
-        uint8_t brightness = server->arg("value").toInt();
+        uint8_t brightness = request->arg("value").toInt();
         if (brightness < 1) brightness = 1;
         if (brightness > 255) brightness = 255;
         
@@ -116,33 +213,691 @@ void WebActions::attach() {
         saveBrightness(brightness);
         
         Logger::instance().log("[WebActions] Brightness set to " + String(brightness));
-        server->send(200, "text/plain", String(brightness));
+        request->send(200, "text/plain", String(brightness));
     });
     
-    server->on("/api/brightness/get", HTTP_GET, [this]() {
+    web->on("/api/brightness/get", HTTP_GET, [this](AsyncWebServerRequest* request) {
         uint8_t brightness = loadBrightness();
-        server->send(200, "text/plain", String(brightness));
+        request->send(200, "text/plain", String(brightness));
+    });
+    
+    // V16.5.3-2026-01-12T18:00:00Z - Per-output color correction
+    //   /api/color                                  -> current settings (JSON)
+    //   /api/color?out=0&gamma=2.2&white=FFB0F0     -> set output 0 (either argument optional)
+    //   /api/color?dither=96                        -> dither below this brightness (0 = off)
+    web->on("/api/color", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        ColorPipeline& color = display->getColorPipeline();
+        bool changed = false;
+        
+        if (request->hasArg("out")) {
+            int out = request->arg("out").toInt();
+            if (out < 0 || out >= OUTPUT_COUNT) {
+                request->send(400, "text/plain", "Invalid 'out' parameter");
+                return;
+            }
+            OutputColor oc = color.getOutput(out);
+            if (request->hasArg("gamma")) oc.gamma = request->arg("gamma").toFloat();
+            if (request->hasArg("white")) oc.white = CRGB(strtoul(request->arg("white").c_str(), nullptr, 16));
+            color.setOutput(out, oc.gamma, oc.white);
+            changed = true;
+        }
+        if (request->hasArg("dither")) {
+            color.setDitherBelow(request->arg("dither").toInt());
+            changed = true;
+        }
+        if (changed) {
+            display->saveColorSettings();
+            display->show();  // Re-send the current frame with the new tables
+            Logger::instance().log("[WebActions] Color settings updated");
+        }
+        
+        String json = "{\"brightness\":" + String(color.getBrightness()) +
+                      ",\"ditherBelow\":" + String(color.getDitherBelow()) + ",\"outputs\":[";
+        for (int o = 0; o < OUTPUT_COUNT; o++) {
+            const OutputColor& oc = color.getOutput(o);
+            char white[8];
+            snprintf(white, sizeof(white), "%02X%02X%02X", oc.white.r, oc.white.g, oc.white.b);
+            if (o) json += ",";
+            json += "{\"gamma\":" + String(oc.gamma, 2) + ",\"white\":\"" + white + "\"}";
+        }
+        json += "]}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.5.4-2026-01-12T21:00:00Z - Estimated draw of the last frame
+    //   /api/power                        -> per-output mA/W, limiter scale, totals (JSON)
+    //   /api/power?budget=150             -> global budget in watts (0 = unlimited)
+    //   /api/power?out=0&budgetMa=8000    -> per-output budget (0 = unlimited)
+    web->on("/api/power", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        PowerLimiter& power = display->getPowerLimiter();
+        
+        if (request->hasArg("budget")) {
+            power.setBudgetWatts(request->arg("budget").toFloat());
+        }
+        if (request->hasArg("out") && request->hasArg("budgetMa")) {
+            int out = request->arg("out").toInt();
+            if (out < 0 || out >= OUTPUT_COUNT) {
+                request->send(400, "text/plain", "Invalid 'out' parameter");
+                return;
+            }
+            OutputPower p = power.getOutput(out);
+            p.budgetMa = request->arg("budgetMa").toInt();
+            power.setOutput(out, p);
+        }
+        
+        String json = "{\"watts\":" + String(power.getTotalWatts(), 1) +
+                      ",\"peakWatts\":" + String(power.getPeakWatts(), 1) +
+                      ",\"budgetWatts\":" + String(power.getBudgetWatts(), 1) +
+                      ",\"limitedFrames\":" + String(power.getLimitedFrames()) + ",\"outputs\":[";
+        for (int o = 0; o < OUTPUT_COUNT; o++) {
+            if (o) json += ",";
+            json += "{\"mA\":" + String(power.getMilliamps(o), 0) +
+                    ",\"watts\":" + String(power.getWatts(o), 1) +
+                    ",\"budgetMa\":" + String(power.getOutput(o).budgetMa) +
+                    ",\"scale\":" + String(power.getScale(o)) + "}";
+        }
+        json += "]}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.5.7-2026-01-13T06:00:00Z - Independent content per zone
+    //   /api/zone                      -> layout and what each zone plays (JSON)
+    //   /api/zone?layout=split|joined  -> one zone per matrix, or one over all (stops all zones)
+    //   /api/zone?zone=0&id=12         -> play content 12 in zone 0
+    //   /api/zone?zone=1&stop=1        -> stop zone 1
+    web->on("/api/zone", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (request->hasArg("layout")) {
+            zones.setSplit(request->arg("layout") != "joined");
+        }
+        if (request->hasArg("zone")) {
+            int zone = request->arg("zone").toInt();
+            if (zone < 0 || zone >= zones.getZoneCount()) {
+                request->send(400, "text/plain", "Invalid 'zone' parameter");
+                return;
+            }
+            if (request->hasArg("stop")) {
+                zones.stop(zone);
+            } else if (request->hasArg("id")) {
+                if (!zones.play(zone, request->arg("id").toInt())) {
+                    request->send(404, "text/plain", "Content not found or not playable in a zone");
+                    return;
+                }
+            }
+        }
+        
+        String json = "{\"layout\":\"" + String(zones.isSplit() ? "split" : "joined") + "\",\"zones\":[";
+        for (int z = 0; z < zones.getZoneCount(); z++) {
+            const ZonePlayer& player = zones.getPlayer(z);
+            if (z) json += ",";
+            json += "{\"firstMatrix\":" + String(player.getZone().firstMatrix) +
+                    ",\"matrices\":" + String(player.getZone().matrixCount) +
+                    ",\"active\":" + String(player.isActive() ? "true" : "false");
+            if (player.isActive()) {
+                json += ",\"id\":" + String(player.getItem().id) +
+                        ",\"name\":\"" + player.getItem().name + "\"" +
+                        ",\"frameMs\":" + String(player.getFrameMs()) +
+                        ",\"frames\":" + String(player.getFrames());
+            }
+            json += "}";
+        }
+        json += "]}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.5.8-2026-01-13T09:00:00Z - Render-ahead cache of periodic procedurals
+    //   /api/framecache          -> hit rate, frames rendered ahead, PSRAM in use (JSON)
+    //   /api/framecache?clear=1  -> drop every ring and reset the counters
+    web->on("/api/framecache", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (request->hasArg("clear")) {
+            frameCache.invalidateAll();
+            frameCache.resetStats();
+        }
+        String json = "{\"hits\":" + String(frameCache.getHits()) +
+                      ",\"misses\":" + String(frameCache.getMisses()) +
+                      ",\"hitRate\":" + String(frameCache.getHitRate(), 3) +
+                      ",\"aheadFrames\":" + String(frameCache.getAheadFrames()) +
+                      ",\"bytes\":" + String((uint32_t)frameCache.getBytes()) +
+                      ",\"rings\":" + String(frameCache.getRingCount()) + "}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.6.3-2026-01-13T21:00:00Z - Live preview stream (/ws/preview)
+    //   /api/preview         -> rate, connected clients, frames sent/dropped (JSON)
+    //   /api/preview?fps=N   -> set the rate (1..PREVIEW_FPS_MAX, saved)
+    web->on("/api/preview", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (request->hasArg("fps") && !livePreview.setFps(request->arg("fps").toInt())) {
+            request->send(400, "text/plain", "fps must be 1-" + String(PREVIEW_FPS_MAX));
+            return;
+        }
+        String json = "{\"fps\":" + String(livePreview.getFps()) +
+                      ",\"clients\":" + String(livePreview.getClientCount()) +
+                      ",\"width\":" + String(PREVIEW_WIDTH) +
+                      ",\"height\":" + String(PREVIEW_HEIGHT) +
+                      ",\"sent\":" + String(livePreview.getFramesSent()) +
+                      ",\"dropped\":" + String(livePreview.getFramesDropped()) +
+                      ",\"bytes\":" + String(livePreview.getBytesSent()) + "}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.6.1-2026-01-13T15:00:00Z - JSON for the static UI (web/ in the content image)
+    //   /api/content   -> every item: id, name, theme, type (streamed)
+    //   /api/themes    -> color themes (id, name, current) and content themes
+    //   /api/status    -> what is playing, modes, heap, uptime
+    //   /api/settings  -> brightness and random mode; any of ?brightness= &random=0|1
+    //                     &interval=<ms> &filter=<theme> &scheduler=0|1 &theme=<name> sets it first
+    // V16.6.2-2026-01-13T18:00:00Z - All but /api/status come from the response cache
+    web->on("/api/content", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        web->getCache().send(request, "/api/content", CACHE_DEP_CONTENT, "application/json",
+                             [this]() { return new ContentListJson(contentMgr); });
+    });
+    
+    web->on("/api/themes", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        web->getCache().send(request, "/api/themes", CACHE_DEP_CONTENT | CACHE_DEP_THEME, "application/json",
+                             [this]() { return new StringSource(themesJson()); });
+    });
+    
+    web->on("/api/status", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        request->send(200, "application/json", statusJson());
+    });
+    
+    web->on("/api/settings", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (request->hasArg("brightness")) {
+            uint8_t brightness = constrain(request->arg("brightness").toInt(), 1, 255);
+            display->setBrightness(brightness);
+            saveBrightness(brightness);
+        }
+        if (request->hasArg("random")) contentMgr->enableRandomMode(request->arg("random") == "1");
+        if (request->hasArg("interval")) contentMgr->setRandomInterval(request->arg("interval").toInt());
+        if (request->hasArg("filter")) contentMgr->setRandomThemeFilter(request->arg("filter"));
+        if (request->hasArg("scheduler")) contentMgr->enableScheduler(request->arg("scheduler") == "1");
+        if (request->hasArg("theme") && !themeMgr->setThemeByName(request->arg("theme"), 500)) {
+            request->send(404, "text/plain", "Unknown theme: " + request->arg("theme"));
+            return;
+        }
+        
+        web->getCache().send(request, "/api/settings", CACHE_DEP_SETTINGS, "application/json",
+                             [this]() { return new StringSource(settingsJson()); });
+    });
+    
+    // V16.6.2-2026-01-13T18:00:00Z - Response cache effectiveness
+    //   /api/webcache          -> hits, builds, 304s, stored bytes (JSON)
+    //   /api/webcache?clear=1  -> drop every entry and reset the counters
+    web->on("/api/webcache", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        ResponseCache& cache = web->getCache();
+        if (request->hasArg("clear")) {
+            cache.invalidateAll();
+            cache.resetStats();
+        }
+        String json = "{\"hits\":" + String(cache.getHits()) +
+                      ",\"misses\":" + String(cache.getMisses()) +
+                      ",\"notModified\":" + String(cache.getNotModified()) +
+                      ",\"oversize\":" + String(cache.getOversize()) +
+                      ",\"hitRate\":" + String(cache.getHitRate(), 3) +
+                      ",\"entries\":" + String((uint32_t)cache.getEntryCount()) +
+                      ",\"bytes\":" + String((uint32_t)cache.getBytes()) + "}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.6.5-2026-01-14T03:00:00Z - Several control actions in one request
+    //   POST /api/batch  [{"cmd":"theme","name":"Christmas","blend":500},
+    //                     {"cmd":"brightness","value":80}, {"cmd":"random","enable":true}, ...]
+    //   -> {"ok":true,"applied":3,"results":[{"cmd":"theme","status":"applied"}, ...]}
+    // See runBatch() for the commands. Nothing is applied unless every command is valid.
+    web->onPost("/api/batch", [this](AsyncWebServerRequest* request) {
+        int code = 200;
+        String json = runBatch((const char*)request->_tempObject, code);
+        request->send(code, "application/json", json);
+    });
+    
+    // V16.7.1-2026-01-14T12:00:00Z - Event trace kept over resets (TraceLog.h)
+    //   /api/trace            -> newest 100 events with boot number and reset reasons (JSON)
+    //   /api/trace?limit=N    -> newest N (at most TRACE_JSON_MAX)
+    //   /api/trace?raw=1      -> the partition and the pages not written yet, for
+    //                            tools/trace_decode.py (streamed from flash on the TCP task)
+    web->on("/api/trace", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!request->hasArg("raw")) {
+            int limit = request->hasArg("limit") ? constrain(request->arg("limit").toInt(), 1, TRACE_JSON_MAX) : 100;
+            request->send(200, "application/json", traceLog.json(limit));
+            return;
+        }
+        auto pages = std::make_shared<std::vector<TracePage>>();
+        traceLog.pendingPages(*pages);
+        const esp_partition_t* partition = traceLog.getPartition();
+        size_t flashBytes = partition ? partition->size : 0;
+        size_t total = flashBytes + pages->size() * TRACE_PAGE_BYTES;
+        AsyncWebServerResponse* response = request->beginResponse("application/octet-stream", total,
+            [pages, partition, flashBytes](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                if (index < flashBytes) {
+                    size_t n = min(maxLen, flashBytes - index);
+                    if (esp_partition_read(partition, index, buffer, n) != ESP_OK) memset(buffer, 0xFF, n);
+                    return n;
+                }
+                size_t at = index - flashBytes;
+                size_t n = min(maxLen, pages->size() * TRACE_PAGE_BYTES - at);
+                memcpy(buffer, (const uint8_t*)pages->data() + at, n);
+                return n;
+            });
+        response->addHeader("Content-Disposition", "attachment; filename=trace.bin");
+        request->send(response);
+    });
+    
+    // V16.7.2-2026-01-14T15:00:00Z - Frame profiler (Profiler.h)
+    //   /api/profile              -> capture state (JSON)
+    //   /api/profile?start=<ms>   -> capture for ms (default PROFILE_DEFAULT_MS, max PROFILE_MAX_MS)
+    //   /api/profile?stop=1       -> end the capture now
+    //   /api/profile?download=1   -> the capture as trace_event JSON (ui.perfetto.dev)
+    web->on("/api/profile", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (request->hasArg("download")) {
+            if (profiler.isCapturing()) {
+                request->send(409, "text/plain", "Capture still running");
+                return;
+            }
+            WebController::sendPage(request, new ProfileTraceJson(), "application/json");
+            return;
+        }
+        if (request->hasArg("start")) {
+            if (!PROFILER_ENABLED) {
+                request->send(400, "text/plain", "Built without PROFILER_ENABLED");
+                return;
+            }
+            long ms = request->arg("start").toInt();
+            if (!profiler.start(ms > 0 ? ms : PROFILE_DEFAULT_MS)) {
+                request->send(409, "text/plain", "Previous capture is being downloaded, or no memory");
+                return;
+            }
+        }
+        if (request->hasArg("stop")) profiler.stop();
+        String json = "{\"enabled\":" + String(PROFILER_ENABLED ? "true" : "false") +
+                      ",\"capturing\":" + String(profiler.isCapturing() ? "true" : "false") +
+                      ",\"durationMs\":" + String(profiler.getDurationMs()) +
+                      ",\"events\":" + String(profiler.getEventCount()) +
+                      ",\"overwritten\":" + String(profiler.getOverwritten()) +
+                      ",\"capacity\":" + String(profiler.getCapacity()) + "}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.7.3-2026-01-14T18:00:00Z - xLights realtime input (RealtimeReceiver.h)
+    //   /api/realtime               -> state, rates, drops and latency (JSON)
+    //   /api/realtime?enable=0|1    -> turn the listeners' input on or off (saved)
+    //   /api/realtime?reset=1       -> zero the counters
+    web->on("/api/realtime", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (request->hasArg("enable")) realtime.setEnabled(request->arg("enable") != "0");
+        if (request->hasArg("reset")) realtime.resetStats();
+        RealtimeStats stats = realtime.getStats();
+        String json = "{\"enabled\":" + String(realtime.isEnabled() ? "true" : "false") +
+                      ",\"active\":" + String(realtime.isActive() ? "true" : "false") +
+                      ",\"source\":\"" + String(realtime.getSource() == RT_DDP ? "ddp" : "e131") + "\"" +
+                      ",\"firstUniverse\":" + String(REALTIME_UNIVERSE) +
+                      ",\"universes\":" + String(realtime.getUniverseCount()) +
+                      ",\"channelsPerUniverse\":" + String(REALTIME_UNIVERSE_CHANNELS) +
+                      ",\"order\":\"" + String(REALTIME_ROW_ORDER ? "rows" : "wiring") + "\"" +
+                      ",\"syncAddress\":" + String(realtime.getSyncAddress()) +
+                      ",\"pps\":" + String(realtime.getPacketsPerSecond()) +
+                      ",\"fps\":" + String(realtime.getFramesPerSecond()) +
+                      ",\"packets\":" + String(stats.packets) +
+                      ",\"e131\":" + String(stats.e131Packets) +
+                      ",\"ddp\":" + String(stats.ddpPackets) +
+                      ",\"sync\":" + String(stats.syncPackets) +
+                      ",\"frames\":" + String(stats.frames) +
+                      ",\"partialFrames\":" + String(stats.partialFrames) +
+                      ",\"lost\":" + String(stats.lost) +
+                      ",\"outOfOrder\":" + String(stats.outOfOrder) +
+                      ",\"malformed\":" + String(stats.malformed) +
+                      ",\"ignored\":" + String(stats.ignored) +
+                      ",\"latencyAvgUs\":" + String(stats.latencyCount ? (uint32_t)(stats.latencySumUs / stats.latencyCount) : 0) +
+                      ",\"latencyMaxUs\":" + String(stats.latencyMaxUs) + "}";
+        request->send(200, "application/json", json);
+    });
+    
+    // V16.6.6-2026-01-14T06:00:00Z - Prometheus scrape target; text is built only here
+    web->on("/metrics", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        String out;
+        out.reserve(8192);
+        metrics.format(out);
+        
+        const ContentItem* item = contentMgr->getContentById(contentMgr->getLastRenderedId());
+        Metrics::header(out, "matrixshow_playing", "gauge", "Content last started (1 while known)");
+        if (item) {
+            Metrics::sample(out, "matrixshow_playing", "1",
+                            Metrics::label("id", String(item->id)) + "," + Metrics::label("name", item->name) + "," +
+                            Metrics::label("type", contentTypeName(item->type)));
+        }
+        Metrics::header(out, "matrixshow_zones_active", "gauge", "1 while zone playback owns the display");
+        Metrics::sample(out, "matrixshow_zones_active", zones.isActive() ? "1" : "0");
+        Metrics::header(out, "matrixshow_brightness", "gauge", "Brightness setting (1-255)");
+        Metrics::sample(out, "matrixshow_brightness", String(display->getBrightness()));
+        
+        const PowerLimiter& power = display->getPowerLimiter();
+        Metrics::header(out, "matrixshow_power_watts", "gauge", "Estimated power per output, last frame");
+        for (int o = 0; o < OUTPUT_COUNT; o++) {
+            Metrics::sample(out, "matrixshow_power_watts", String(power.getWatts(o), 2), Metrics::label("output", String(o)));
+        }
+        Metrics::header(out, "matrixshow_power_limited_frames_total", "counter", "Frames scaled down by the power limiter");
+        Metrics::sample(out, "matrixshow_power_limited_frames_total", String(power.getLimitedFrames()));
+        
+        Metrics::header(out, "matrixshow_frame_cache_hits_total", "counter", "Procedural frames served from the frame cache");
+        Metrics::sample(out, "matrixshow_frame_cache_hits_total", String(frameCache.getHits()));
+        Metrics::header(out, "matrixshow_frame_cache_misses_total", "counter", "Procedural frames rendered on a cache miss");
+        Metrics::sample(out, "matrixshow_frame_cache_misses_total", String(frameCache.getMisses()));
+        Metrics::header(out, "matrixshow_frame_cache_bytes", "gauge", "PSRAM held by frame cache rings");
+        Metrics::sample(out, "matrixshow_frame_cache_bytes", String((uint32_t)frameCache.getBytes()));
+        
+        ResponseCache& cache = web->getCache();
+        Metrics::header(out, "matrixshow_web_cache_hits_total", "counter", "Generated responses served from the cache");
+        Metrics::sample(out, "matrixshow_web_cache_hits_total", String(cache.getHits()));
+        Metrics::header(out, "matrixshow_web_cache_misses_total", "counter", "Generated responses built");
+        Metrics::sample(out, "matrixshow_web_cache_misses_total", String(cache.getMisses()));
+        Metrics::header(out, "matrixshow_web_cache_not_modified_total", "counter", "304 answers");
+        Metrics::sample(out, "matrixshow_web_cache_not_modified_total", String(cache.getNotModified()));
+        
+        Metrics::header(out, "matrixshow_preview_clients", "gauge", "Live preview sockets");
+        Metrics::sample(out, "matrixshow_preview_clients", String(livePreview.getClientCount()));
+        Metrics::header(out, "matrixshow_event_clients", "gauge", "Server-sent event streams");
+        Metrics::sample(out, "matrixshow_event_clients", String(eventStream.getClientCount()));
+        Metrics::header(out, "matrixshow_boot", "gauge", "Boot number (event trace)");
+        Metrics::sample(out, "matrixshow_boot", String(traceLog.getBoot()));
+        Metrics::header(out, "matrixshow_trace_pages_written_total", "counter", "Event trace pages written to flash");
+        Metrics::sample(out, "matrixshow_trace_pages_written_total", String(traceLog.getPagesWritten()));
+        Metrics::header(out, "matrixshow_trace_dropped_total", "counter", "Trace events lost while flash writes were behind");
+        Metrics::sample(out, "matrixshow_trace_dropped_total", String(traceLog.getDropped()));
+        Metrics::header(out, "matrixshow_log_lines_total", "counter", "Log lines written");
+        Metrics::sample(out, "matrixshow_log_lines_total", String(Logger::instance().getLastSequence()));
+        // V16.7.3-2026-01-14T18:00:00Z - Realtime input
+        RealtimeStats rt = realtime.getStats();
+        Metrics::header(out, "matrixshow_realtime_active", "gauge", "1 while E1.31/DDP input owns the display");
+        Metrics::sample(out, "matrixshow_realtime_active", realtime.isActive() ? "1" : "0");
+        Metrics::header(out, "matrixshow_realtime_packets_total", "counter", "Realtime packets written, by protocol");
+        Metrics::sample(out, "matrixshow_realtime_packets_total", String(rt.e131Packets), Metrics::label("protocol", "e131"));
+        Metrics::sample(out, "matrixshow_realtime_packets_total", String(rt.ddpPackets), Metrics::label("protocol", "ddp"));
+        Metrics::header(out, "matrixshow_realtime_packets_per_second", "gauge", "Realtime packets received, last second");
+        Metrics::sample(out, "matrixshow_realtime_packets_per_second", String(realtime.getPacketsPerSecond()));
+        Metrics::header(out, "matrixshow_realtime_frames_total", "counter", "Realtime frames shown");
+        Metrics::sample(out, "matrixshow_realtime_frames_total", String(rt.frames), Metrics::label("end", "complete"));
+        Metrics::sample(out, "matrixshow_realtime_frames_total", String(rt.partialFrames), Metrics::label("end", "partial"));
+        Metrics::header(out, "matrixshow_realtime_dropped_total", "counter", "Realtime packets lost or discarded");
+        Metrics::sample(out, "matrixshow_realtime_dropped_total", String(rt.lost), Metrics::label("reason", "lost"));
+        Metrics::sample(out, "matrixshow_realtime_dropped_total", String(rt.outOfOrder), Metrics::label("reason", "late"));
+        Metrics::sample(out, "matrixshow_realtime_dropped_total", String(rt.malformed), Metrics::label("reason", "malformed"));
+        realtime.getLatency().format(out, "matrixshow_realtime_latency_seconds", "First packet of a frame to show() done");
+        Metrics::header(out, "matrixshow_wifi_rssi_dbm", "gauge", "WiFi signal");
+        Metrics::sample(out, "matrixshow_wifi_rssi_dbm", String(WiFi.RSSI()));
+        Metrics::header(out, "matrixshow_uptime_seconds", "counter", "Seconds since boot");
+        Metrics::sample(out, "matrixshow_uptime_seconds", String(millis() / 1000));
+        
+        request->send(200, "text/plain; version=0.0.4", out);
     });
     
     // Logs
-    server->on("/api/logs/clear", HTTP_GET, [this]() {
+    web->on("/api/logs/clear", HTTP_GET, [this](AsyncWebServerRequest* request) {
         Logger::instance().clear();
-        server->send(200, "text/plain", "âœ… Logs cleared");
+        request->send(200, "text/plain", "✅ Logs cleared");
     });
     
     // Theme control (legacy)
-    server->on("/api/theme/set", HTTP_GET, [this]() {
-        if (!server->hasArg("id")) {
-            server->send(400, "text/plain", "Missing 'id' parameter");
+    web->on("/api/theme/set", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        // V16.4.4-2026-01-11T20:00:00Z - Select by id or name, optional ?blend=<ms> cross-fade
+        uint16_t blendMs = request->hasArg("blend") ? request->arg("blend").toInt() : 0;
+        
+        if (request->hasArg("name")) {
+            String name = request->arg("name");
+            if (!themeMgr->setThemeByName(name, blendMs)) {
+                request->send(404, "text/plain", "Unknown theme: " + name);
+                return;
+            }
+            request->send(200, "text/plain", "✅ Theme set to " + name);
             return;
         }
         
-        uint8_t themeId = server->arg("id").toInt();
-        themeMgr->setTheme(themeId);
-        server->send(200, "text/plain", "âœ… Theme set to " + String(themeId));
+        if (!request->hasArg("id")) {
+            request->send(400, "text/plain", "Missing 'id' parameter");
+            return;
+        }
+        
+        uint8_t themeId = request->arg("id").toInt();
+        themeMgr->setTheme(themeId, blendMs);
+        request->send(200, "text/plain", "✅ Theme set to " + String(themeId));
     });
 }
 
+// V16.6.1-2026-01-13T15:00:00Z - Color themes and the themes found in the content image
+String WebActions::themesJson() {
+    String json = "{\"current\":" + String(themeMgr->getCurrentTheme()) + ",\"themes\":[";
+    bool first = true;
+    for (const auto& theme : themeMgr->getThemes()) {
+        if (!first) json += ",";
+        first = false;
+        json += "{\"id\":" + String(theme.id) + ",\"name\":" + jsonString(theme.name) + "}";
+    }
+    json += "],\"contentThemes\":[";
+    first = true;
+    for (const auto& theme : contentMgr->getDiscoveredThemes()) {
+        if (!first) json += ",";
+        first = false;
+        json += jsonString(theme);
+    }
+    json += "]}";
+    return json;
+}
+
+// V16.6.1-2026-01-13T15:00:00Z - What is playing, modes, heap, uptime
+String WebActions::statusJson() {
+    const ContentItem* item = contentMgr->getContentById(contentMgr->getLastRenderedId());
+    return "{\"uptime\":" + String(millis() / 1000) +
+           ",\"heap\":" + String(ESP.getFreeHeap()) +
+           ",\"rssi\":" + String(WiFi.RSSI()) +
+           ",\"playing\":" + (item ? jsonString(item->name) : String("null")) +
+           ",\"playingId\":" + String(item ? item->id : 0) +
+           ",\"random\":" + String(contentMgr->isRandomModeEnabled() ? "true" : "false") +
+           ",\"scheduler\":" + String(contentMgr->isSchedulerEnabled() ? "true" : "false") +
+           ",\"zones\":" + String(zones.isActive() ? "true" : "false") +
+           ",\"realtime\":" + String(realtime.isActive() ? "true" : "false") +
+           ",\"theme\":" + String(themeMgr->getCurrentTheme()) +
+           ",\"brightness\":" + String(display->getBrightness()) +
+           ",\"watts\":" + String(display->getPowerLimiter().getTotalWatts(), 1) + "}";
+}
+
+// V16.6.5-2026-01-14T03:00:00Z - POST /api/batch. Commands (JSON objects, "cmd" plus):
+//   theme       "name" or "id", optional "blend" (ms)
+//   brightness  "value" 1-255
+//   random      "enable" true|false        scheduler  "enable" true|false
+//   interval    "ms" >= 1000               filter     "theme" (discovered theme, "" = all)
+//   render      "id"                       clear
+//   layout      "split" true|false         zone       "zone" and "id", or "stop": true
+// Every command is checked first; if any is invalid nothing is applied (400, each result
+// "error" or "skipped"). Otherwise all are applied in order within one loop() pass - the
+// handler runs between frames, so no frame shows half of a batch. A command that fails
+// while applying (content that cannot be loaded) is reported; earlier ones stay applied.
+namespace {
+enum BatchOp { BATCH_THEME, BATCH_BRIGHTNESS, BATCH_RANDOM, BATCH_SCHEDULER, BATCH_INTERVAL,
+               BATCH_FILTER, BATCH_RENDER, BATCH_CLEAR, BATCH_LAYOUT, BATCH_ZONE };
+
+const struct { const char* name; BatchOp op; } BATCH_OPS[] = {
+    {"theme", BATCH_THEME}, {"brightness", BATCH_BRIGHTNESS}, {"random", BATCH_RANDOM},
+    {"scheduler", BATCH_SCHEDULER}, {"interval", BATCH_INTERVAL}, {"filter", BATCH_FILTER},
+    {"render", BATCH_RENDER}, {"clear", BATCH_CLEAR}, {"layout", BATCH_LAYOUT}, {"zone", BATCH_ZONE},
+};
+
+struct BatchCommand {
+    String cmd;
+    BatchOp op = BATCH_CLEAR;
+    long value = 0;     // Theme/content id, brightness, interval, enable/split/stop flag
+    long arg = 0;       // Blend ms, zone
+    long id = 0;        // Zone content id
+    String text;        // Filter theme
+    String error;
+};
+}
+
+String WebActions::runBatch(const char* body, int& code) {
+    DynamicJsonDocument doc(strlen(body) * 2 + 512);
+    DeserializationError err = deserializeJson(doc, body);
+    if (err || !doc.is<JsonArray>()) {
+        code = 400;
+        return "{\"ok\":false,\"error\":" + jsonString(err ? err.c_str() : "Expected a JSON array of commands") + "}";
+    }
+    JsonArray list = doc.as<JsonArray>();
+    if (list.size() == 0 || list.size() > BATCH_MAX_COMMANDS) {
+        code = 400;
+        return "{\"ok\":false,\"error\":\"Between 1 and " + String(BATCH_MAX_COMMANDS) + " commands\"}";
+    }
+
+    // Check everything first
+    std::vector<BatchCommand> commands(list.size());
+    int zoneCount = zones.getZoneCount();  // As a layout command earlier in the batch leaves it
+    bool valid = true;
+    for (size_t i = 0; i < list.size(); i++) {
+        JsonVariant in = list[i];
+        BatchCommand& c = commands[i];
+        c.cmd = in["cmd"] | "";
+        bool known = false;
+        for (const auto& op : BATCH_OPS) {
+            if (c.cmd == op.name) {
+                c.op = op.op;
+                known = true;
+            }
+        }
+        if (!known) {
+            c.error = "Unknown command";
+        } else switch (c.op) {
+            case BATCH_THEME: {
+                String name = in["name"] | "";
+                long id = in["id"] | -1L;
+                c.value = -1;
+                for (const auto& theme : themeMgr->getThemes()) {
+                    if (name.length() ? theme.name.equalsIgnoreCase(name) : theme.id == id) c.value = theme.id;
+                }
+                c.arg = constrain(in["blend"] | 0L, 0L, 60000L);
+                if (c.value < 0) c.error = "Unknown theme";
+                break;
+            }
+            case BATCH_BRIGHTNESS:
+                c.value = in["value"] | 0L;
+                if (c.value < 1 || c.value > 255) c.error = "'value' must be 1-255";
+                break;
+            case BATCH_RANDOM:
+            case BATCH_SCHEDULER:
+                if (!in["enable"].is<bool>()) c.error = "'enable' must be true or false";
+                c.value = in["enable"] | false;
+                break;
+            case BATCH_INTERVAL:
+                c.value = in["ms"] | 0L;
+                if (c.value < 1000) c.error = "'ms' must be at least 1000";
+                break;
+            case BATCH_FILTER: {
+                c.text = in["theme"] | "";
+                bool found = c.text.length() == 0;
+                for (const auto& theme : contentMgr->getDiscoveredThemes()) {
+                    if (theme == c.text) found = true;
+                }
+                if (!found) c.error = "Unknown content theme";
+                break;
+            }
+            case BATCH_RENDER:
+                c.value = in["id"] | 0L;
+                if (!contentMgr->getContentById(c.value)) c.error = "Content not found";
+                break;
+            case BATCH_CLEAR:
+                break;
+            case BATCH_LAYOUT:
+                if (!in["split"].is<bool>()) c.error = "'split' must be true or false";
+                c.value = in["split"] | true;
+                if (c.error.length() == 0) zoneCount = c.value ? MATRIX_COUNT : 1;
+                break;
+            case BATCH_ZONE:
+                c.arg = in["zone"] | -1L;
+                c.value = in["stop"] | false;
+                if (c.arg < 0 || c.arg >= zoneCount) {
+                    c.error = "Invalid 'zone'";
+                } else if (!c.value) {
+                    c.id = in["id"] | 0L;
+                    const ContentItem* item = contentMgr->getContentById(c.id);
+                    if (!item) {
+                        c.error = "Content not found";
+                    } else if (!ZonePlayer::canPlay(*item)) {
+                        c.error = "Not playable in a zone";
+                    }
+                }
+                break;
+        }
+        if (c.error.length()) valid = false;
+    }
+
+    // Then apply all, in order
+    int applied = 0;
+    if (valid) {
+        for (auto& c : commands) {
+            switch (c.op) {
+                case BATCH_THEME:
+                    themeMgr->setTheme(c.value, c.arg);
+                    break;
+                case BATCH_BRIGHTNESS:
+                    display->setBrightness(c.value);
+                    saveBrightness(c.value);
+                    break;
+                case BATCH_RANDOM:
+                    contentMgr->enableRandomMode(c.value);
+                    break;
+                case BATCH_SCHEDULER:
+                    contentMgr->enableScheduler(c.value);
+                    break;
+                case BATCH_INTERVAL:
+                    contentMgr->setRandomInterval(c.value);
+                    break;
+                case BATCH_FILTER:
+                    contentMgr->setRandomThemeFilter(c.text);
+                    break;
+                case BATCH_RENDER:
+                    zones.stopAll();
+                    if (!contentMgr->renderContent(c.value)) c.error = "Could not render";
+                    break;
+                case BATCH_CLEAR:
+                    display->clear();
+                    display->show();
+                    break;
+                case BATCH_LAYOUT:
+                    zones.setSplit(c.value);
+                    break;
+                case BATCH_ZONE:
+                    if (c.value) {
+                        zones.stop(c.arg);
+                    } else if (!zones.play(c.arg, c.id)) {
+                        c.error = "Not playable in a zone";
+                    }
+                    break;
+            }
+            if (c.error.length() == 0) applied++;
+        }
+        Logger::instance().log("[WebActions] Batch: " + String(applied) + "/" + String(commands.size()) +
+                               " commands applied");
+    }
+
+    bool ok = valid && applied == (int)commands.size();
+    code = valid ? 200 : 400;
+    String json = "{\"ok\":" + String(ok ? "true" : "false") + ",\"applied\":" + String(applied) + ",\"results\":[";
+    for (size_t i = 0; i < commands.size(); i++) {
+        const BatchCommand& c = commands[i];
+        if (i) json += ",";
+        json += "{\"cmd\":" + jsonString(c.cmd) + ",\"status\":";
+        if (c.error.length()) {
+            json += "\"error\",\"error\":" + jsonString(c.error);
+        } else {
+            json += valid ? "\"applied\"" : "\"skipped\"";
+        }
+        json += "}";
+    }
+    json += "]}";
+    return json;
+}
+
+// V16.6.1-2026-01-13T15:00:00Z - What /api/settings can change
+String WebActions::settingsJson() {
+    return "{\"brightness\":" + String(loadBrightness()) +
+           ",\"random\":" + String(contentMgr->isRandomModeEnabled() ? "true" : "false") +
+           ",\"interval\":" + String(contentMgr->getRandomInterval()) +
+           ",\"filter\":" + jsonString(contentMgr->getRandomThemeFilter()) +
+           ",\"scheduler\":" + String(contentMgr->isSchedulerEnabled() ? "true" : "false") + "}";
+}
+
 void WebActions::saveBrightness(uint8_t brightness) {
     prefs.begin("matrixshow", false);
     prefs.putUChar("brightness", brightness);
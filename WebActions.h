@@ -1,27 +1,38 @@
 /* WebActions.h
    API endpoints for web interface
-   VERSION: V16.1.3-2026-01-09T05:25:00Z - Added brightness control
+   VERSION: V16.6.5-2026-01-14T03:00:00Z - runBatch() for POST /api/batch
+   V16.6.4-2026-01-14T00:00:00Z - statusJson() shared with the event stream
+   V16.6.2-2026-01-13T18:00:00Z - themesJson()/settingsJson() bodies for the response cache
+   V16.6.0-2026-01-13T12:00:00Z - Routes registered through WebController (async, loop-side)
+   V16.1.3-2026-01-09T05:25:00Z - Added brightness control
 */
 
 #pragma once
 
-#include <WebServer.h>
+#include <Arduino.h>
 
 class ContentManager;
 class ThemeManager;
 class MatrixDisplay;
+class WebController;
 
 class WebActions {
 public:
-    WebActions(ContentManager* cm, ThemeManager* tm, MatrixDisplay* disp, WebServer* srv);
+    WebActions(ContentManager* cm, ThemeManager* tm, MatrixDisplay* disp, WebController* ctl);
     void attach();
 
+    // V16.6.4-2026-01-14T00:00:00Z - /api/status body; also the "state" event (EventStream)
+    String statusJson();
+
 private:
     ContentManager* contentMgr;
     ThemeManager* themeMgr;
     MatrixDisplay* display;
-    WebServer* server;
+    WebController* web;
     
+    String themesJson();
+    String settingsJson();
+    String runBatch(const char* body, int& code);  // V16.6.5 - JSON result; code = HTTP status
     void saveBrightness(uint8_t brightness);
     uint8_t loadBrightness();
 };
@@ -1,59 +1,253 @@
-/* WebController.cpp
-   Web server implementation
-   VERSION: V16.2.5-2026-01-10T22:18:00Z - Created missing implementation
-*/
-
-#include "WebController.h"
-#include "WebPages.h"
-#include "WebActions.h"
-#include "ContentManager.h"
-#include "ThemeManager.h"
-#include "MatrixDisplay.h"
-
-WebController::WebController() : server(80) {}
-
-void WebController::begin(ContentManager* contentMgr, ThemeManager* themeMgr, MatrixDisplay* disp) {
-    content = contentMgr;
-    themes = themeMgr;
-    display = disp;
-    
-    setupRoutes();
-    
-    // V16.2.5-2026-01-10T22:18:00Z - Create WebActions
-    actions = new WebActions(content, themes, display, &server);
-    actions->attach();
-    
-    server.begin();
-    Serial.println("[WebController] Server started on port 80");
-}
-
-void WebController::handle() {
-    server.handleClient();
-}
-
-void WebController::setupRoutes() {
-    // V16.2.5-2026-01-10T22:18:00Z - Setup page routes
-    server.on("/", HTTP_GET, [this]() {
-        server.send(200, "text/html", WebPages::buildRootPage());
-    });
-    
-    server.on("/control", HTTP_GET, [this]() {
-        server.send(200, "text/html", WebPages::buildControlPage(content));
-    });
-    
-    server.on("/schedule", HTTP_GET, [this]() {
-        server.send(200, "text/html", WebPages::buildSchedulePage(content));
-    });
-    
-    server.on("/times", HTTP_GET, [this]() {
-        server.send(200, "text/html", WebPages::buildTimesPage());
-    });
-    
-    server.on("/logs", HTTP_GET, [this]() {
-        server.send(200, "text/html", WebPages::buildLogsPage());
-    });
-    
-    server.on("/discovery", HTTP_GET, [this]() {
-        server.send(200, "text/html", WebPages::buildDiscoveryPage(content));
-    });
-}
\ No newline at end of file
+/* WebController.cpp
+   Web server implementation
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - If-None-Match kept on on() routes (cache revalidation);
+   handlers run with the queue lock released, so the TCP task never waits behind them
+   V16.7.2-2026-01-14T15:00:00Z - Queued handlers profiled
+   V16.6.6-2026-01-14T06:00:00Z - Request latency and asset reads recorded for /metrics
+   V16.6.5-2026-01-14T03:00:00Z - POST bodies collected before queueing (onPost)
+   V16.6.4-2026-01-14T00:00:00Z - Server-sent events (/api/events)
+   V16.6.3-2026-01-13T21:00:00Z - Live preview socket on the same server
+   V16.6.2-2026-01-13T18:00:00Z - Pages served through the response cache
+   V16.6.1-2026-01-13T15:00:00Z - Gzipped static assets with cache headers
+   V16.6.0-2026-01-13T12:00:00Z - AsyncWebServer, loop-side request queue, chunked pages
+   V16.2.5-2026-01-10T22:18:00Z - Created missing implementation
+*/
+
+#include "WebController.h"
+#include "WebPages.h"
+#include "WebActions.h"
+#include "LivePreview.h"
+#include "EventStream.h"
+#include "ContentManager.h"
+#include "ThemeManager.h"
+#include "MatrixDisplay.h"
+#include "Config.h"
+#include "esp_spi_flash.h"
+#include "Metrics.h"
+#include "Profiler.h"
+#include <memory>
+
+WebController::WebController() : server(80) {}
+
+void WebController::begin(ContentManager* contentMgr, ThemeManager* themeMgr, MatrixDisplay* disp) {
+    content = contentMgr;
+    themes = themeMgr;
+    display = disp;
+    lock = xSemaphoreCreateRecursiveMutex();
+    busy = xSemaphoreCreateMutex();
+    pending.reserve(WEB_QUEUE_MAX);
+    cache.begin(content, themes, display);
+    
+    setupRoutes();
+    
+    // V16.2.5-2026-01-10T22:18:00Z - Create WebActions
+    actions = new WebActions(content, themes, display, this);
+    actions->attach();
+    
+    livePreview.begin(server, display);  // V16.6.3-2026-01-13T21:00:00Z - /ws/preview
+    // V16.6.4-2026-01-14T00:00:00Z - /api/events
+    eventStream.begin(server, content, themes, display, [this]() { return actions->statusJson(); });
+    
+    server.begin();
+    Serial.println("[WebController] Server started on port 80");
+}
+
+void WebController::on(const char* path, WebRequestMethodComposite method, WebHandler handler) {
+    server.on(path, method, [this, handler](AsyncWebServerRequest* request) {
+        enqueue(request, handler);
+    }).setFilter([](AsyncWebServerRequest* request) {
+        // V16.7.4-2026-01-15T09:00:00Z - The server drops headers nobody registered once
+        // the request head is parsed; ResponseCache needs this one for its 304s
+        request->addInterestingHeader("If-None-Match");
+        return true;
+    });
+}
+
+void WebController::onPost(const char* path, WebHandler handler) {
+    server.on(path, HTTP_POST,
+        [this, handler](AsyncWebServerRequest* request) {
+            // Called once the whole body is in; the server frees _tempObject with the request
+            if (!request->_tempObject) {
+                bool large = request->contentLength() > WEB_BODY_MAX;
+                request->send(large ? 413 : 400, "text/plain",
+                              large ? "Body larger than " + String(WEB_BODY_MAX) + " bytes" : String("Missing body"));
+                return;
+            }
+            enqueue(request, handler);
+        },
+        nullptr,
+        [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+            if (total > WEB_BODY_MAX) return;
+            if (index == 0) request->_tempObject = malloc(total + 1);
+            char* body = (char*)request->_tempObject;
+            if (!body) return;
+            memcpy(body + index, data, len);
+            if (index + len == total) body[total] = '\0';
+        });
+}
+
+void WebController::enqueue(AsyncWebServerRequest* request, const WebHandler& handler) {
+    // TCP task: queue only, nothing here may touch display or content state
+    auto entry = std::make_shared<Pending>(Pending{request, handler, (uint32_t)micros(), false});
+    request->onDisconnect([this, entry]() {
+        xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+        entry->gone = true;
+        bool inHandler = running == entry.get();
+        xSemaphoreGiveRecursive(lock);
+        // The server frees the request when this returns: not while its handler still uses it
+        if (inHandler) {
+            xSemaphoreTake(busy, portMAX_DELAY);
+            xSemaphoreGive(busy);
+        }
+    });
+    
+    xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+    bool full = pending.size() >= WEB_QUEUE_MAX;
+    if (!full) pending.push_back(entry);
+    xSemaphoreGiveRecursive(lock);
+    
+    if (full) request->send(503, "text/plain", "Busy");
+}
+
+void WebController::handle() {
+    // V16.6.0-2026-01-13T12:00:00Z - Requests were parsed by the TCP task; answer them here.
+    // V16.7.4-2026-01-15T09:00:00Z - Take the queue, then run it unlocked (see Pending)
+    std::vector<std::shared_ptr<Pending>> batch;
+    xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+    if (!pending.empty()) {
+        batch.swap(pending);
+        pending.reserve(WEB_QUEUE_MAX);
+    }
+    xSemaphoreGiveRecursive(lock);
+    
+    for (auto& p : batch) {
+        xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+        bool gone = p->gone;
+        if (!gone) {
+            running = p.get();
+            xSemaphoreTake(busy, portMAX_DELAY);  // Free: only taken by a disconnect of running
+        }
+        xSemaphoreGiveRecursive(lock);
+        if (gone) continue;
+        
+        {
+            PROFILE_SCOPE("web handler");  // V16.7.2-2026-01-14T15:00:00Z
+            p->handler(p->request);
+        }
+        metrics.webRequest(micros() - p->queuedUs);  // V16.6.6-2026-01-14T06:00:00Z
+        
+        xSemaphoreTakeRecursive(lock, portMAX_DELAY);
+        running = nullptr;
+        xSemaphoreGive(busy);
+        xSemaphoreGiveRecursive(lock);
+    }
+}
+
+void WebController::sendPage(AsyncWebServerRequest* request, PageSource* page, const char* contentType) {
+    // Fragment being copied out, carried over between chunk callbacks
+    struct Stream {
+        std::unique_ptr<PageSource> page;
+        String fragment;
+        size_t sent = 0;
+    };
+    auto stream = std::make_shared<Stream>();
+    stream->page.reset(page);
+    
+    AsyncWebServerResponse* response = request->beginChunkedResponse(contentType,
+        [stream](uint8_t* buffer, size_t maxLen, size_t) -> size_t {
+            size_t len = 0;
+            while (len < maxLen) {
+                if (stream->sent >= stream->fragment.length()) {
+                    stream->fragment = "";
+                    stream->sent = 0;
+                    if (!stream->page || !stream->page->next(stream->fragment)) {
+                        stream->page.reset();  // Complete: returning 0 ends the response
+                        break;
+                    }
+                    continue;
+                }
+                size_t n = min(maxLen - len, stream->fragment.length() - stream->sent);
+                memcpy(buffer + len, stream->fragment.c_str() + stream->sent, n);
+                len += n;
+                stream->sent += n;
+            }
+            return len;
+        });
+    request->send(response);
+}
+
+static const char* assetType(const String& file) {
+    if (file.endsWith(".html")) return "text/html";
+    if (file.endsWith(".js")) return "application/javascript";
+    if (file.endsWith(".css")) return "text/css";
+    if (file.endsWith(".svg")) return "image/svg+xml";
+    if (file.endsWith(".png")) return "image/png";
+    if (file.endsWith(".ico")) return "image/x-icon";
+    if (file.endsWith(".json")) return "application/json";
+    return "application/octet-stream";
+}
+
+bool WebController::sendAsset(AsyncWebServerRequest* request, const String& file) {
+    const FileEntry* entry = content->findFile(WEB_ASSET_PREFIX + file + ".gz");
+    if (!entry) return false;
+    
+    // Read from flash straight into the TCP buffer
+    uint32_t offset = entry->offset;
+    size_t size = entry->size;
+    AsyncWebServerResponse* response = request->beginResponse(assetType(file), size,
+        [offset, size](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            size_t n = min(maxLen, size - index);
+            if (contentFlashRead(buffer, offset + index, n) != ESP_OK) return 0;
+            return n;
+        });
+    response->addHeader("Content-Encoding", "gzip");
+    // index.html names the current asset versions, so it is revalidated every time;
+    // assets under a ?v= URL never change
+    if (file == "index.html") {
+        response->addHeader("Cache-Control", "no-cache");
+    } else {
+        response->addHeader("Cache-Control", "public, max-age=" + String(WEB_ASSET_MAX_AGE) + ", immutable");
+    }
+    request->send(response);
+    return true;
+}
+
+void WebController::setupRoutes() {
+    // V16.2.5-2026-01-10T22:18:00Z - Setup page routes
+    // V16.6.0-2026-01-13T12:00:00Z - Pages read content state, so they are built from loop() too
+    // V16.6.1-2026-01-13T15:00:00Z - Static UI when the image has one, else the built pages
+    server.on("/", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        if (!sendAsset(request, "index.html")) request->redirect("/control");
+    });
+    
+    // Any other path: a static asset, if there is one
+    server.onNotFound([this](AsyncWebServerRequest* request) {
+        String file = request->url().substring(1);
+        if (request->method() == HTTP_GET && file.indexOf("..") < 0 && sendAsset(request, file)) return;
+        request->send(404, "text/plain", "Not found");
+    });
+    
+    // V16.6.2-2026-01-13T18:00:00Z - Built once per content/settings generation; logs stay live
+    on("/control", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        cache.send(request, "/control", CACHE_DEP_CONTENT, "text/html",
+                   [this]() { return WebPages::controlPage(content); });
+    });
+    
+    on("/schedule", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        cache.send(request, "/schedule", CACHE_DEP_CONTENT | CACHE_DEP_SETTINGS, "text/html",
+                   [this]() { return WebPages::schedulePage(content); });
+    });
+    
+    on("/times", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        cache.send(request, "/times", 0, "text/html", []() { return WebPages::timesPage(); });
+    });
+    
+    on("/logs", HTTP_GET, [](AsyncWebServerRequest* request) {
+        sendPage(request, WebPages::logsPage());
+    });
+    
+    on("/discovery", HTTP_GET, [this](AsyncWebServerRequest* request) {
+        cache.send(request, "/discovery", CACHE_DEP_CONTENT, "text/html",
+                   [this]() { return WebPages::discoveryPage(content); });
+    });
+}
@@ -1,31 +1,91 @@
 /* WebController.h
    Web server and HTTP interface
-   VERSION: V16.1.3-2026-01-09T05:35:00Z - Fixed WebActions lifecycle
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - Queued handlers run without the queue lock
+   V16.6.5-2026-01-14T03:00:00Z - onPost(): handlers that take a request body
+   V16.6.2-2026-01-13T18:00:00Z - Generated pages/JSON through ResponseCache (ETag/304)
+   V16.6.1-2026-01-13T15:00:00Z - Static gzipped UI from the content image
+   V16.6.0-2026-01-13T12:00:00Z - Async server; handlers run from loop(), pages stream in chunks
+   V16.1.3-2026-01-09T05:35:00Z - Fixed WebActions lifecycle
+
+   AsyncWebServer accepts and parses requests on the TCP task, several at a time, without
+   waiting for loop(). Display, content and theme state belong to loop(), so handlers
+   registered with on() are queued and run from handle(); the request is answered there.
+   Pages are PageSource objects (WebPages.h): built on the loop task, then pulled a
+   fragment at a time into the TCP buffer by a chunked response, so a page never exists
+   as one String - memory per request is one fragment, however big the library is.
+   V16.6.1-2026-01-13T15:00:00Z - The UI itself is static: web/<file>.gz in the content image
+   (tools/gzip_web.py), sent as stored with Content-Encoding: gzip straight from flash on the
+   TCP task (the file index never changes after discovery). It renders from the JSON API in
+   WebActions. Without web/index.html.gz, "/" falls back to the server-built pages.
 */
 
 #pragma once
 
 #include <Arduino.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <memory>
+#include <vector>
+#include "ResponseCache.h"
 
 class ContentManager;
 class ThemeManager;
 class MatrixDisplay;
 class WebActions;
+class PageSource;
+
+typedef std::function<void(AsyncWebServerRequest*)> WebHandler;
 
 class WebController {
 public:
     WebController();
 
     void begin(ContentManager* contentMgr, ThemeManager* themeMgr, MatrixDisplay* disp);
-    void handle();
+    void handle();  // Runs queued handlers; call from loop()
+
+    // V16.6.0-2026-01-13T12:00:00Z - Register a handler that runs on the loop task
+    void on(const char* path, WebRequestMethodComposite method, WebHandler handler);
+
+    // V16.6.5-2026-01-14T03:00:00Z - POST whose body (at most WEB_BODY_MAX bytes) is collected
+    // on the TCP task; the handler gets it NUL-terminated in request->_tempObject
+    void onPost(const char* path, WebHandler handler);
+
+    // Stream a page as a chunked response; takes ownership of page
+    static void sendPage(AsyncWebServerRequest* request, PageSource* page,
+                         const char* contentType = "text/html");
+
+    // V16.6.2-2026-01-13T18:00:00Z - Cached generated responses (loop task only)
+    ResponseCache& getCache() { return cache; }
 
 private:
-    WebServer server{80};
+    AsyncWebServer server{80};
     ContentManager* content = nullptr;
     ThemeManager* themes = nullptr;
     MatrixDisplay* display = nullptr;
     WebActions* actions = nullptr;  // V16.1.3-2026-01-09T05:35:00Z
+    ResponseCache cache;            // V16.6.2-2026-01-13T18:00:00Z
 
+    // V16.6.0-2026-01-13T12:00:00Z - Requests waiting for loop(). A request whose client
+    // disconnects is freed by the server once its onDisconnect callback returns.
+    // V16.7.4-2026-01-15T09:00:00Z - lock only guards the queue and the flags below, never a
+    // handler: the TCP task takes it for a few instructions. A disconnect marks its entry
+    // gone (skipped by handle()); only a disconnect of the request whose handler is running
+    // waits, on busy, for that one handler to finish with it.
+    struct Pending {
+        AsyncWebServerRequest* request;
+        WebHandler handler;
+        uint32_t queuedUs;  // V16.6.6-2026-01-14T06:00:00Z - For the web latency metric
+        bool gone;          // Client disconnected: the request is freed
+    };
+    std::vector<std::shared_ptr<Pending>> pending;
+    const Pending* running = nullptr;   // Entry whose handler holds busy
+    SemaphoreHandle_t lock = nullptr;
+    SemaphoreHandle_t busy = nullptr;
+
+    void enqueue(AsyncWebServerRequest* request, const WebHandler& handler);
     void setupRoutes();
-};
\ No newline at end of file
+
+    // V16.6.1-2026-01-13T15:00:00Z - Send web/<file>.gz; false if the image has no such asset
+    bool sendAsset(AsyncWebServerRequest* request, const String& file);
+};
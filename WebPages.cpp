@@ -1,360 +1,514 @@
 /* WebPages.cpp
    HTML page generation for web interface
-   VERSION: V16.1.3-2026-01-09T05:20:00Z - Complete UI rebuild
+   VERSION: V16.6.4-2026-01-14T00:00:00Z - Logs page reads by sequence and follows /api/events
+   V16.6.1-2026-01-13T15:00:00Z - Root redirect moved to WebController (static UI first)
+   V16.6.0-2026-01-13T12:00:00Z - Fragment-at-a-time pages; icons restored as UTF-8
+   V16.1.3-2026-01-09T05:20:00Z - Complete UI rebuild
 */
 
 #include "WebPages.h"
 #include "ContentManager.h"
 #include "Logger.h"
+#include <vector>
+
+// Common page style
+static const char PAGE_STYLE[] PROGMEM =
+    "body{font-family:Arial,sans-serif;background:#1a1a1a;color:#eee;margin:0;padding:20px;}"
+    ".container{max-width:1200px;margin:0 auto;}"
+    "h1{color:#4CAF50;margin-top:0;}"
+    "h2{color:#81C784;border-bottom:2px solid #4CAF50;padding-bottom:10px;}"
+    ".nav{background:#2d2d2d;padding:15px;margin-bottom:20px;border-radius:5px;}"
+    ".nav a{color:#4CAF50;text-decoration:none;margin:0 15px;font-weight:bold;}"
+    ".nav a:hover{color:#81C784;}"
+    ".section{background:#2d2d2d;padding:20px;margin-bottom:20px;border-radius:5px;}"
+    ".content-grid{display:grid;grid-template-columns:repeat(auto-fill,minmax(250px,1fr));gap:15px;}"
+    ".content-item{background:#3d3d3d;padding:15px;border-radius:5px;border-left:4px solid #4CAF50;}"
+    ".content-item h3{margin:0 0 10px 0;color:#81C784;}"
+    ".content-item button{width:100%;padding:10px;margin-top:10px;background:#4CAF50;color:#fff;border:none;border-radius:3px;cursor:pointer;font-size:14px;}"
+    ".content-item button:hover{background:#66BB6A;}"
+    ".checkbox-item{background:#3d3d3d;padding:12px;margin:8px 0;border-radius:5px;display:flex;align-items:center;}"
+    ".checkbox-item input{margin-right:12px;width:20px;height:20px;}"
+    ".checkbox-item label{cursor:pointer;flex-grow:1;}"
+    ".control-btn{padding:12px 24px;margin:8px;background:#4CAF50;color:#fff;border:none;border-radius:5px;cursor:pointer;font-size:16px;}"
+    ".control-btn:hover{background:#66BB6A;}"
+    ".danger-btn{background:#f44336;}"
+    ".danger-btn:hover{background:#e53935;}"
+    ".status{padding:15px;background:#3d3d3d;border-radius:5px;margin:15px 0;}"
+    ".log-entry{font-family:monospace;background:#3d3d3d;padding:8px;margin:5px 0;border-radius:3px;font-size:13px;}"
+    "input[type=time],input[type=number]{padding:10px;background:#3d3d3d;color:#eee;border:1px solid #4CAF50;border-radius:3px;font-size:14px;}"
+    "select{padding:10px;background:#3d3d3d;color:#eee;border:1px solid #4CAF50;border-radius:3px;font-size:14px;}"
+    ".form-group{margin:15px 0;}"
+    ".form-group label{display:block;margin-bottom:8px;color:#81C784;font-weight:bold;}";
 
 // Common HTML header with styling
-String WebPages::htmlHeader(const String& title) {
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='utf-8'>";
-    html += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
-    html += "<title>" + title + "</title>";
-    html += "<style>";
-    html += "body{font-family:Arial,sans-serif;background:#1a1a1a;color:#eee;margin:0;padding:20px;}";
-    html += ".container{max-width:1200px;margin:0 auto;}";
-    html += "h1{color:#4CAF50;margin-top:0;}";
-    html += "h2{color:#81C784;border-bottom:2px solid #4CAF50;padding-bottom:10px;}";
-    html += ".nav{background:#2d2d2d;padding:15px;margin-bottom:20px;border-radius:5px;}";
-    html += ".nav a{color:#4CAF50;text-decoration:none;margin:0 15px;font-weight:bold;}";
-    html += ".nav a:hover{color:#81C784;}";
-    html += ".section{background:#2d2d2d;padding:20px;margin-bottom:20px;border-radius:5px;}";
-    html += ".content-grid{display:grid;grid-template-columns:repeat(auto-fill,minmax(250px,1fr));gap:15px;}";
-    html += ".content-item{background:#3d3d3d;padding:15px;border-radius:5px;border-left:4px solid #4CAF50;}";
-    html += ".content-item h3{margin:0 0 10px 0;color:#81C784;}";
-    html += ".content-item button{width:100%;padding:10px;margin-top:10px;background:#4CAF50;color:#fff;border:none;border-radius:3px;cursor:pointer;font-size:14px;}";
-    html += ".content-item button:hover{background:#66BB6A;}";
-    html += ".checkbox-item{background:#3d3d3d;padding:12px;margin:8px 0;border-radius:5px;display:flex;align-items:center;}";
-    html += ".checkbox-item input{margin-right:12px;width:20px;height:20px;}";
-    html += ".checkbox-item label{cursor:pointer;flex-grow:1;}";
-    html += ".control-btn{padding:12px 24px;margin:8px;background:#4CAF50;color:#fff;border:none;border-radius:5px;cursor:pointer;font-size:16px;}";
-    html += ".control-btn:hover{background:#66BB6A;}";
-    html += ".danger-btn{background:#f44336;}";
-    html += ".danger-btn:hover{background:#e53935;}";
-    html += ".status{padding:15px;background:#3d3d3d;border-radius:5px;margin:15px 0;}";
-    html += ".log-entry{font-family:monospace;background:#3d3d3d;padding:8px;margin:5px 0;border-radius:3px;font-size:13px;}";
-    html += "input[type=time],input[type=number]{padding:10px;background:#3d3d3d;color:#eee;border:1px solid #4CAF50;border-radius:3px;font-size:14px;}";
-    html += "select{padding:10px;background:#3d3d3d;color:#eee;border:1px solid #4CAF50;border-radius:3px;font-size:14px;}";
-    html += ".form-group{margin:15px 0;}";
-    html += ".form-group label{display:block;margin-bottom:8px;color:#81C784;font-weight:bold;}";
-    html += "</style>";
-    html += "</head><body><div class='container'>";
-    return html;
+void WebPages::htmlHeader(String& out, const char* title) {
+    out += "<!DOCTYPE html><html><head>";
+    out += "<meta charset='utf-8'>";
+    out += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
+    out += "<title>";
+    out += title;
+    out += "</title>";
+    out += "<style>";
+    out += PAGE_STYLE;
+    out += "</style>";
+    out += "</head><body><div class='container'>";
+}
+
+void WebPages::htmlFooter(String& out) {
+    out += "</div></body></html>";
 }
 
-String WebPages::htmlFooter() {
-    return "</div></body></html>";
+void WebPages::navigation(String& out) {
+    out += "<div class='nav'>";
+    out += "<a href='/control'>Control</a>";
+    out += "<a href='/schedule'>Schedule</a>";
+    out += "<a href='/times'>Schedule Times</a>";
+    out += "<a href='/logs'>Logs</a>";
+    out += "<a href='/discovery'>Discovery</a>";
+    out += "</div>";
 }
 
-String WebPages::buildNavigation() {
-    String nav = "<div class='nav'>";
-    nav += "<a href='/'>Control</a>";
-    nav += "<a href='/schedule'>Schedule</a>";
-    nav += "<a href='/times'>Schedule Times</a>";
-    nav += "<a href='/logs'>Logs</a>";
-    nav += "<a href='/discovery'>Discovery</a>";
-    nav += "</div>";
-    return nav;
+namespace {
+
+// Next registry index at or after `from` with this theme (test patterns skipped); size() if none
+size_t nextInTheme(const std::vector<ContentItem>& items, size_t from, const String& theme) {
+    while (from < items.size() && (items[from].type == CONTENT_TEST || items[from].theme != theme)) {
+        from++;
+    }
+    return from;
 }
 
 // Page 1: Control/Preview Page
-String WebPages::buildControlPage(ContentManager* content) {
-    String html = htmlHeader("Matrix Control");
-    html += buildNavigation();
-    
-    html += "<h1>Matrix Control</h1>";
-    
-    // Display controls
-    html += "<div class='section'>";
-    html += "<h2>Display Controls</h2>";
-    html += "<div style='display:inline-block;margin:10px;'>";
-    html += "<label style='display:block;color:#81C784;margin-bottom:8px;'>Brightness: <span id='brightnessValue'>--</span></label>";
-    html += "<input type='range' id='brightness' min='1' max='255' value='20' style='width:200px;' oninput='updateBrightness(this.value)'>";
-    html += "</div>";
-    html += "<br>";
-    html += "<button class='control-btn danger-btn' onclick='clearDisplay()'>?????EUR? Clear Display</button>";
-    html += "<button class='control-btn' onclick='testPattern()'>???,?'?+ Test Pattern</button>";
-    html += "</div>";
-    
-    // Get all content grouped by theme
-    auto themes = content->getDiscoveredThemes();
-    
-    for (const auto& theme : themes) {
-        auto items = content->getContentByTheme(theme);
-        if (items.size() == 0) continue;
-        
-        html += "<div class='section'>";
-        html += "<h2>Theme: " + theme + "</h2>";
-        html += "<div class='content-grid'>";
-        
-        for (const auto& item : items) {
-            // Skip test patterns on main page
-            if (item.type == CONTENT_TEST) continue;
-            
-            html += "<div class='content-item'>";
-            html += "<h3>" + item.name + "</h3>";
-            html += "<p style='margin:5px 0;color:#aaa;font-size:13px;'>";
-            
-            switch(item.type) {
-                case CONTENT_SCENE: html += "???,?EURoe?? Scene"; break;
-                case CONTENT_ANIMATION: html += "???,? 1/2 ?? Animation"; break;
-                case CONTENT_SCROLL: html += "???,?EURoe?" Scroll"; break;
-                case CONTENT_PROCEDURAL: html += "?????,,????,?? Procedural"; break;
+class ControlPage : public PageSource {
+public:
+    explicit ControlPage(ContentManager* c) : content(c) {}
+
+    bool next(String& out) override {
+        const auto& themes = content->getDiscoveredThemes();
+        const auto& items = content->getContent();
+
+        if (stage == 0) {
+            WebPages::htmlHeader(out, "Matrix Control");
+            WebPages::navigation(out);
+            out += "<h1>Matrix Control</h1>";
+
+            // Display controls
+            out += "<div class='section'>";
+            out += "<h2>Display Controls</h2>";
+            out += "<div style='display:inline-block;margin:10px;'>";
+            out += "<label style='display:block;color:#81C784;margin-bottom:8px;'>Brightness: <span id='brightnessValue'>--</span></label>";
+            out += "<input type='range' id='brightness' min='1' max='255' value='20' style='width:200px;' oninput='updateBrightness(this.value)'>";
+            out += "</div>";
+            out += "<br>";
+            out += "<button class='control-btn danger-btn' onclick='clearDisplay()'>🧹 Clear Display</button>";
+            out += "<button class='control-btn' onclick='testPattern()'>🧪 Test Pattern</button>";
+            out += "</div>";
+            stage = 1;
+            return true;
+        }
+
+        if (stage == 1) {
+            // One content card per call, grouped by theme
+            while (theme < themes.size()) {
+                item = nextInTheme(items, item, themes[theme]);
+                if (item < items.size()) {
+                    if (!open) {
+                        out += "<div class='section'>";
+                        out += "<h2>Theme: " + themes[theme] + "</h2>";
+                        out += "<div class='content-grid'>";
+                        open = true;
+                    }
+                    card(out, items[item++]);
+                    return true;
+                }
+                theme++;
+                item = 0;
+                if (open) {
+                    open = false;
+                    out += "</div></div>";
+                    return true;
+                }
             }
-            
-            html += "</p>";
-            html += "<button onclick='preview(" + String(item.id) + ")'>???EUR"?????,?? Preview</button>";
-            html += "</div>";
+
+            // JavaScript - V16.2.1-2026-01-10T18:52:00Z - Removed annoying alert() popups
+            out += "<script>";
+            out += "function preview(id){fetch('/api/render?id='+id);}";
+            out += "function clearDisplay(){fetch('/api/clear');}";
+            out += "function testPattern(){fetch('/api/test');}";
+            out += "function updateBrightness(val){";
+            out += "  document.getElementById('brightnessValue').innerText=val;";
+            out += "  fetch('/api/brightness?value='+val);";
+            out += "}";
+            out += "window.onload=function(){";
+            out += "  fetch('/api/brightness/get').then(r=>r.text()).then(val=>{";
+            out += "    document.getElementById('brightness').value=val;";
+            out += "    document.getElementById('brightnessValue').innerText=val;";
+            out += "  });";
+            out += "}";
+            out += "</script>";
+            WebPages::htmlFooter(out);
+            stage = 2;
+            return true;
         }
-        
-        html += "</div></div>";
+        return false;
     }
-    
-    // JavaScript - V16.2.1-2026-01-10T18:52:00Z - Removed annoying alert() popups
-    html += "<script>";
-    html += "function preview(id){fetch('/api/render?id='+id);}";
-    html += "function clearDisplay(){fetch('/api/clear');}";
-    html += "function testPattern(){fetch('/api/test');}";
-    html += "function updateBrightness(val){";
-    html += "  document.getElementById('brightnessValue').innerText=val;";
-    html += "  fetch('/api/brightness?value='+val);";
-    html += "}";
-    html += "window.onload=function(){";
-    html += "  fetch('/api/brightness/get').then(r=>r.text()).then(val=>{";
-    html += "    document.getElementById('brightness').value=val;";
-    html += "    document.getElementById('brightnessValue').innerText=val;";
-    html += "  });";
-    html += "}";
-    html += "</script>";
-    
-    html += htmlFooter();
-    return html;
-}
 
-// Page 2: Schedule Configuration
-String WebPages::buildSchedulePage(ContentManager* content) {
-    String html = htmlHeader("Schedule Config");
-    html += buildNavigation();
-    
-    html += "<h1>???,?EURoe?EUR? Random Schedule Configuration</h1>";
-    
-    // Random mode status
-    html += "<div class='section'>";
-    html += "<h2>Random Mode Status</h2>";
-    html += "<div class='status'>";
-    html += "<p><strong>Status:</strong> " + String(content->isRandomModeEnabled() ? "???"?EUR? ENABLED" : "???EUR??EUR? DISABLED") + "</p>";
-    html += "<p><strong>Interval:</strong> " + String(content->getRandomInterval()) + " ms</p>";
-    html += "<p><strong>Theme Filter:</strong> " + (content->getRandomThemeFilter().length() > 0 ? content->getRandomThemeFilter() : "ALL THEMES") + "</p>";
-    html += "</div>";
-    
-    if (content->isRandomModeEnabled()) {
-        html += "<button class='control-btn danger-btn' onclick='toggleRandom(false)'>???EUR??EUR? Disable Random Mode</button>";
-    } else {
-        html += "<button class='control-btn' onclick='toggleRandom(true)'>???"?EUR? Enable Random Mode</button>";
+private:
+    ContentManager* content;
+    int stage = 0;
+    size_t theme = 0;
+    size_t item = 0;
+    bool open = false;  // Theme section started
+
+    static void card(String& out, const ContentItem& item) {
+        out += "<div class='content-item'>";
+        out += "<h3>" + item.name + "</h3>";
+        out += "<p style='margin:5px 0;color:#aaa;font-size:13px;'>";
+
+        switch (item.type) {
+            case CONTENT_SCENE: out += "🖼️ Scene"; break;
+            case CONTENT_ANIMATION: out += "🎞️ Animation"; break;
+            case CONTENT_SCROLL: out += "📜 Scroll"; break;
+            case CONTENT_PROCEDURAL: out += "✨ Procedural"; break;
+            default: break;
+        }
+
+        out += "</p>";
+        out += "<button onclick='preview(" + String(item.id) + ")'>▶️ Preview</button>";
+        out += "</div>";
     }
-    html += "</div>";
-    
-    // Random settings
-    html += "<div class='section'>";
-    html += "<h2>Random Settings</h2>";
-    html += "<div class='form-group'>";
-    html += "<label>Change Interval (milliseconds):</label>";
-    html += "<input type='number' id='interval' value='" + String(content->getRandomInterval()) + "' min='1000' step='1000'>";
-    html += "<button class='control-btn' onclick='setInterval()' style='margin-left:10px;'>Update</button>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Theme Filter:</label>";
-    html += "<select id='themeFilter' onchange='setFilter()'>";
-    html += "<option value=''>ALL THEMES</option>";
-    
-    auto themes = content->getDiscoveredThemes();
-    String currentFilter = content->getRandomThemeFilter();
-    for (const auto& theme : themes) {
-        html += "<option value='" + theme + "'";
-        if (theme == currentFilter) html += " selected";
-        html += ">" + theme + "</option>";
+};
+
+// Page 2: Schedule Configuration
+class SchedulePage : public PageSource {
+public:
+    explicit SchedulePage(ContentManager* c)
+        : content(c),
+          randomEnabled(c->isRandomModeEnabled()),
+          interval(c->getRandomInterval()),
+          filter(c->getRandomThemeFilter()) {}
+
+    bool next(String& out) override {
+        const auto& themes = content->getDiscoveredThemes();
+        const auto& items = content->getContent();
+
+        switch (stage) {
+            case 0:
+                WebPages::htmlHeader(out, "Schedule Config");
+                WebPages::navigation(out);
+                out += "<h1>🎲 Random Schedule Configuration</h1>";
+
+                // Random mode status
+                out += "<div class='section'>";
+                out += "<h2>Random Mode Status</h2>";
+                out += "<div class='status'>";
+                out += "<p><strong>Status:</strong> <span id='randomStatus'>" + String(randomEnabled ? "✅ ENABLED" : "⛔ DISABLED") + "</span></p>";
+                out += "<p><strong>Interval:</strong> " + String(interval) + " ms</p>";
+                out += "<p><strong>Theme Filter:</strong> " + (filter.length() > 0 ? filter : "ALL THEMES") + "</p>";
+                out += "</div>";
+
+                // V16.6.4-2026-01-14T00:00:00Z - Kept current by the "state" event (no reload)
+                out += "<button id='randomToggle' class='control-btn'>--</button>";
+                out += "</div>";
+
+                // Random settings
+                out += "<div class='section'>";
+                out += "<h2>Random Settings</h2>";
+                out += "<div class='form-group'>";
+                out += "<label>Change Interval (milliseconds):</label>";
+                out += "<input type='number' id='interval' value='" + String(interval) + "' min='1000' step='1000'>";
+                out += "<button class='control-btn' onclick='setInterval()' style='margin-left:10px;'>Update</button>";
+                out += "</div>";
+
+                out += "<div class='form-group'>";
+                out += "<label>Theme Filter:</label>";
+                out += "<select id='themeFilter' onchange='setFilter()'>";
+                out += "<option value=''>ALL THEMES</option>";
+                stage = 1;
+                return true;
+
+            case 1:
+                // One theme option per call
+                if (index < themes.size()) {
+                    const String& theme = themes[index++];
+                    out += "<option value='" + theme + "'";
+                    if (theme == filter) out += " selected";
+                    out += ">" + theme + "</option>";
+                    return true;
+                }
+                out += "</select>";
+                out += "</div>";
+                out += "</div>";
+
+                // Eligible content selection
+                out += "<div class='section'>";
+                out += "<h2>Eligible Content</h2>";
+                out += "<p style='color:#aaa;'>Select which content can be included in random schedule:</p>";
+                index = 0;
+                stage = 2;
+                return true;
+
+            case 2:
+                // One checkbox per call; test patterns skipped
+                while (index < items.size() && items[index].type == CONTENT_TEST) index++;
+                if (index < items.size()) {
+                    checkbox(out, items[index++]);
+                    return true;
+                }
+                out += "<button class='control-btn' onclick='saveEligible()' style='margin-top:20px;'>💾 Save Eligible Content</button>";
+                out += "</div>";
+
+                // JavaScript
+                out += "<script>";
+                out += "var random=" + String(randomEnabled ? "true" : "false") + ";";
+                out += "function showRandom(){";
+                out += "  var b=document.getElementById('randomToggle');";
+                out += "  document.getElementById('randomStatus').textContent=random?'✅ ENABLED':'⛔ DISABLED';";
+                out += "  b.textContent=random?'⛔ Disable Random Mode':'✅ Enable Random Mode';";
+                out += "  b.className='control-btn'+(random?' danger-btn':'');";
+                out += "}";
+                out += "document.getElementById('randomToggle').onclick=function(){";
+                out += "  fetch('/api/random/'+(random?'disable':'enable'));";
+                out += "};";
+                out += "new EventSource('/api/events').addEventListener('state',function(e){";
+                out += "  random=JSON.parse(e.data).random;showRandom();";
+                out += "});";
+                out += "showRandom();";
+                out += "function setInterval(){";
+                out += "  let ms=document.getElementById('interval').value;";
+                out += "  fetch('/api/random/interval?ms='+ms);";
+                out += "}";
+                out += "function setFilter(){";
+                out += "  let theme=document.getElementById('themeFilter').value;";
+                out += "  fetch('/api/random/filter?theme='+theme);";
+                out += "}";
+                out += "function saveEligible(){";
+                out += "  console.log('Eligible content saved (TODO: implement persistence)');";
+                out += "}";
+                out += "</script>";
+                WebPages::htmlFooter(out);
+                stage = 3;
+                return true;
+
+            default:
+                return false;
+        }
     }
-    html += "</select>";
-    html += "</div>";
-    html += "</div>";
-    
-    // Eligible content selection
-    html += "<div class='section'>";
-    html += "<h2>Eligible Content</h2>";
-    html += "<p style='color:#aaa;'>Select which content can be included in random schedule:</p>";
-    
-    auto allContent = content->getContent();
-    for (const auto& item : allContent) {
-        // Skip test patterns
-        if (item.type == CONTENT_TEST) continue;
-        
-        html += "<div class='checkbox-item'>";
-        html += "<input type='checkbox' id='content_" + String(item.id) + "' checked>";
-        html += "<label for='content_" + String(item.id) + "'>";
-        html += "<strong>" + item.name + "</strong> [" + item.theme + "] ";
-        
-        switch(item.type) {
-            case CONTENT_SCENE: html += "(scene)"; break;
-            case CONTENT_ANIMATION: html += "(animation)"; break;
-            case CONTENT_SCROLL: html += "(scroll)"; break;
-            case CONTENT_PROCEDURAL: html += "(procedural)"; break;
+
+private:
+    ContentManager* content;
+    bool randomEnabled;
+    unsigned long interval;
+    String filter;
+    int stage = 0;
+    size_t index = 0;
+
+    static void checkbox(String& out, const ContentItem& item) {
+        out += "<div class='checkbox-item'>";
+        out += "<input type='checkbox' id='content_" + String(item.id) + "' checked>";
+        out += "<label for='content_" + String(item.id) + "'>";
+        out += "<strong>" + item.name + "</strong> [" + item.theme + "] ";
+
+        switch (item.type) {
+            case CONTENT_SCENE: out += "(scene)"; break;
+            case CONTENT_ANIMATION: out += "(animation)"; break;
+            case CONTENT_SCROLL: out += "(scroll)"; break;
+            case CONTENT_PROCEDURAL: out += "(procedural)"; break;
+            default: break;
         }
-        
-        html += "</label>";
-        html += "</div>";
+
+        out += "</label>";
+        out += "</div>";
     }
-    
-    html += "<button class='control-btn' onclick='saveEligible()' style='margin-top:20px;'>???,?EUR(TM)? 3/4  Save Eligible Content</button>";
-    html += "</div>";
-    
-    // JavaScript
-    html += "<script>";
-    html += "function toggleRandom(enable){";
-    html += "  fetch('/api/random/'+(enable?'enable':'disable')).then(()=>location.reload());";
-    html += "}";
-    html += "function setInterval(){";
-    html += "  let ms=document.getElementById('interval').value;";
-    html += "  fetch('/api/random/interval?ms='+ms);";
-    html += "}";
-    html += "function setFilter(){";
-    html += "  let theme=document.getElementById('themeFilter').value;";
-    html += "  fetch('/api/random/filter?theme='+theme);";
-    html += "}";
-    html += "function saveEligible(){";
-    html += "  console.log('Eligible content saved (TODO: implement persistence)');";
-    html += "}";
-    html += "</script>";
-    
-    html += htmlFooter();
-    return html;
-}
+};
 
 // Page 3: Schedule Times
-String WebPages::buildTimesPage() {
-    String html = htmlHeader("Schedule Times");
-    html += buildNavigation();
-    
-    html += "<h1>?????? Schedule Times</h1>";
-    
-    html += "<div class='section'>";
-    html += "<h2>Daily Schedule</h2>";
-    html += "<p style='color:#aaa;'>Configure when the random schedule should run each day:</p>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>Start Time:</label>";
-    html += "<input type='time' id='startTime' value='17:00'>";
-    html += "</div>";
-    
-    html += "<div class='form-group'>";
-    html += "<label>End Time:</label>";
-    html += "<input type='time' id='endTime' value='22:00'>";
-    html += "</div>";
-    
-    html += "<button class='control-btn' onclick='saveTimes()'>???,?EUR(TM)? 3/4  Save Schedule Times</button>";
-    html += "</div>";
-    
-    html += "<div class='section'>";
-    html += "<h2>Current Schedule</h2>";
-    html += "<div class='status'>";
-    html += "<p><strong>Active Hours:</strong> 17:00 - 22:00</p>";
-    html += "<p><strong>Status:</strong> Schedule times not yet implemented</p>";
-    html += "</div>";
-    html += "</div>";
-    
-    // JavaScript
-    html += "<script>";
-    html += "function saveTimes(){";
-    html += "  let start=document.getElementById('startTime').value;";
-    html += "  let end=document.getElementById('endTime').value;";
-    html += "  console.log('Schedule times: '+start+' to '+end+' (TODO: implement persistence)');";
-    html += "}";
-    html += "</script>";
-    
-    html += htmlFooter();
-    return html;
-}
+class TimesPage : public PageSource {
+public:
+    bool next(String& out) override {
+        if (done) return false;
+        done = true;
+
+        WebPages::htmlHeader(out, "Schedule Times");
+        WebPages::navigation(out);
+
+        out += "<h1>⏰ Schedule Times</h1>";
+
+        out += "<div class='section'>";
+        out += "<h2>Daily Schedule</h2>";
+        out += "<p style='color:#aaa;'>Configure when the random schedule should run each day:</p>";
+
+        out += "<div class='form-group'>";
+        out += "<label>Start Time:</label>";
+        out += "<input type='time' id='startTime' value='17:00'>";
+        out += "</div>";
+
+        out += "<div class='form-group'>";
+        out += "<label>End Time:</label>";
+        out += "<input type='time' id='endTime' value='22:00'>";
+        out += "</div>";
+
+        out += "<button class='control-btn' onclick='saveTimes()'>💾 Save Schedule Times</button>";
+        out += "</div>";
+
+        out += "<div class='section'>";
+        out += "<h2>Current Schedule</h2>";
+        out += "<div class='status'>";
+        out += "<p><strong>Active Hours:</strong> 17:00 - 22:00</p>";
+        out += "<p><strong>Status:</strong> Schedule times not yet implemented</p>";
+        out += "</div>";
+        out += "</div>";
+
+        // JavaScript
+        out += "<script>";
+        out += "function saveTimes(){";
+        out += "  let start=document.getElementById('startTime').value;";
+        out += "  let end=document.getElementById('endTime').value;";
+        out += "  console.log('Schedule times: '+start+' to '+end+' (TODO: implement persistence)');";
+        out += "}";
+        out += "</script>";
+
+        WebPages::htmlFooter(out);
+        return true;
+    }
+
+private:
+    bool done = false;
+};
 
 // Page 4: Logs
-String WebPages::buildLogsPage() {
-    String html = htmlHeader("System Logs");
-    html += buildNavigation();
-    
-    html += "<h1>???,?EURoe?EUR? System Logs</h1>";
-    
-    html += "<div class='section'>";
-    html += "<h2>Recent Log Entries</h2>";
-    html += "<button class='control-btn' onclick='location.reload()'>???,?EUR??EUR? Refresh</button>";
-    html += "<button class='control-btn danger-btn' onclick='clearLogs()'>???,?EUR"?EUR~???,?? Clear Logs</button>";
-    
-    html += "<div style='margin-top:20px;'>";
-    
-    auto logs = Logger::instance().getRecentLogs();
-    if (logs.size() == 0) {
-        html += "<p style='color:#aaa;'>No log entries</p>";
-    } else {
-        for (const auto& log : logs) {
-            html += "<div class='log-entry'>" + log + "</div>";
+class LogsPage : public PageSource {
+public:
+    // V16.6.4-2026-01-14T00:00:00Z - Lines up to the newest one now, read one at a time by
+    // sequence (no copy of the buffer); later lines arrive live through /api/events
+    LogsPage() : upTo(Logger::instance().getLastSequence()) {}
+
+    bool next(String& out) override {
+        switch (stage) {
+            case 0:
+                WebPages::htmlHeader(out, "System Logs");
+                WebPages::navigation(out);
+
+                out += "<h1>📋 System Logs</h1>";
+
+                out += "<div class='section'>";
+                out += "<h2>Recent Log Entries</h2>";
+                out += "<button class='control-btn danger-btn' onclick='clearLogs()'>🗑️ Clear Logs</button>";
+
+                out += "<div id='logs' style='margin-top:20px;'>";
+                stage = 1;
+                return true;
+
+            case 1: {
+                String line;
+                uint32_t seq = Logger::instance().readAfter(cursor, line);
+                if (seq != 0 && seq <= upTo) {
+                    out += "<div class='log-entry'>" + line + "</div>";
+                    cursor = seq;
+                    return true;
+                }
+                out += "</div></div>";
+
+                // JavaScript
+                out += "<script>";
+                out += "var last=" + String(upTo) + ";";
+                out += "var logs=document.getElementById('logs');";
+                out += "new EventSource('/api/events').addEventListener('log',function(e){";
+                out += "  if(+e.lastEventId<=last)return;";
+                out += "  last=+e.lastEventId;";
+                out += "  var d=document.createElement('div');";
+                out += "  d.className='log-entry';d.textContent=e.data;logs.appendChild(d);";
+                out += "});";
+                out += "function clearLogs(){";
+                out += "  if(confirm('Clear all logs?')){";
+                out += "    fetch('/api/logs/clear').then(function(){logs.innerHTML='';});";
+                out += "  }";
+                out += "}";
+                out += "</script>";
+
+                WebPages::htmlFooter(out);
+                stage = 2;
+                return true;
+            }
+
+            default:
+                return false;
         }
     }
-    
-    html += "</div></div>";
-    
-    // JavaScript
-    html += "<script>";
-    html += "function clearLogs(){";
-    html += "  if(confirm('Clear all logs?')){";
-    html += "    fetch('/api/logs/clear').then(()=>location.reload());";
-    html += "  }";
-    html += "}";
-    html += "</script>";
-    
-    html += htmlFooter();
-    return html;
-}
+
+private:
+    uint32_t upTo;
+    uint32_t cursor = 0;
+    int stage = 0;
+};
 
 // Discovery page (existing)
-String WebPages::buildDiscoveryPage(ContentManager* content) {
-    String html = htmlHeader("Content Discovery");
-    html += buildNavigation();
-    
-    html += "<h1>???,?EUR??? Content Discovery</h1>";
-    
-    html += "<div class='section'>";
-    html += "<h2>Discovered Themes</h2>";
-    auto themes = content->getDiscoveredThemes();
-    html += "<p><strong>Total:</strong> " + String(themes.size()) + "</p>";
-    for (const auto& theme : themes) {
-        html += "<div class='status'>" + theme + "</div>";
-    }
-    html += "</div>";
-    
-    html += "<div class='section'>";
-    html += "<h2>All Content</h2>";
-    auto allContent = content->getContent();
-    html += "<p><strong>Total Items:</strong> " + String(allContent.size()) + "</p>";
-    
-    html += "<div class='content-grid'>";
-    for (const auto& item : allContent) {
-        html += "<div class='content-item'>";
-        html += "<h3>" + item.name + "</h3>";
-        html += "<p style='margin:5px 0;color:#aaa;'>Theme: " + item.theme + "</p>";
-        html += "<p style='margin:5px 0;color:#aaa;'>ID: " + String(item.id) + "</p>";
-        html += "</div>";
+class DiscoveryPage : public PageSource {
+public:
+    explicit DiscoveryPage(ContentManager* c) : content(c) {}
+
+    bool next(String& out) override {
+        const auto& themes = content->getDiscoveredThemes();
+        const auto& items = content->getContent();
+
+        switch (stage) {
+            case 0:
+                WebPages::htmlHeader(out, "Content Discovery");
+                WebPages::navigation(out);
+
+                out += "<h1>🔍 Content Discovery</h1>";
+
+                out += "<div class='section'>";
+                out += "<h2>Discovered Themes</h2>";
+                out += "<p><strong>Total:</strong> " + String(themes.size()) + "</p>";
+                stage = 1;
+                return true;
+
+            case 1:
+                if (index < themes.size()) {
+                    out += "<div class='status'>" + themes[index++] + "</div>";
+                    return true;
+                }
+                out += "</div>";
+
+                out += "<div class='section'>";
+                out += "<h2>All Content</h2>";
+                out += "<p><strong>Total Items:</strong> " + String(items.size()) + "</p>";
+                out += "<div class='content-grid'>";
+                index = 0;
+                stage = 2;
+                return true;
+
+            case 2:
+                if (index < items.size()) {
+                    const ContentItem& item = items[index++];
+                    out += "<div class='content-item'>";
+                    out += "<h3>" + item.name + "</h3>";
+                    out += "<p style='margin:5px 0;color:#aaa;'>Theme: " + item.theme + "</p>";
+                    out += "<p style='margin:5px 0;color:#aaa;'>ID: " + String(item.id) + "</p>";
+                    out += "</div>";
+                    return true;
+                }
+                out += "</div></div>";
+                WebPages::htmlFooter(out);
+                stage = 3;
+                return true;
+
+            default:
+                return false;
+        }
     }
-    html += "</div></div>";
-    
-    html += htmlFooter();
-    return html;
-}
 
-String WebPages::buildRootPage() {
-    // Redirect to control page
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta http-equiv='refresh' content='0;url=/control'>";
-    html += "</head><body>Redirecting...</body></html>";
-    return html;
-}
\ No newline at end of file
+private:
+    ContentManager* content;
+    int stage = 0;
+    size_t index = 0;
+};
+
+} // namespace
+
+PageSource* WebPages::controlPage(ContentManager* content) { return new ControlPage(content); }
+PageSource* WebPages::schedulePage(ContentManager* content) { return new SchedulePage(content); }
+PageSource* WebPages::timesPage() { return new TimesPage(); }
+PageSource* WebPages::logsPage() { return new LogsPage(); }
+PageSource* WebPages::discoveryPage(ContentManager* content) { return new DiscoveryPage(content); }
@@ -1,6 +1,14 @@
 /* WebPages.h
    HTML page generation for web interface
-   VERSION: V16.1.3-2026-01-09T05:20:00Z - Complete UI rebuild
+   VERSION: V16.6.2-2026-01-13T18:00:00Z - StringSource for bodies built in one piece
+   V16.6.1-2026-01-13T15:00:00Z - Fallback UI when the content image has no web/ assets
+   V16.6.0-2026-01-13T12:00:00Z - Pages are PageSources streamed a fragment at a time
+   V16.1.3-2026-01-09T05:20:00Z - Complete UI rebuild
+
+   A page factory runs on the loop task and copies whatever mutable state the page shows
+   (flags, the log buffer); next() then runs on the server's TCP task as the client reads,
+   and touches only that copy and the content registry, which is fixed after discovery.
+   Each fragment is one item, one section head or one static block.
 */
 
 #pragma once
@@ -9,17 +17,41 @@
 
 class ContentManager;
 
-class WebPages {
+class PageSource {
+public:
+    virtual ~PageSource() {}
+
+    // Append the next fragment to out; false when the page is complete
+    virtual bool next(String& out) = 0;
+};
+
+// V16.6.2-2026-01-13T18:00:00Z - A body that is already one String (small JSON)
+class StringSource : public PageSource {
 public:
-    static String buildRootPage();
-    static String buildControlPage(ContentManager* content);
-    static String buildSchedulePage(ContentManager* content);
-    static String buildTimesPage();
-    static String buildLogsPage();
-    static String buildDiscoveryPage(ContentManager* content);
+    explicit StringSource(const String& s) : body(s) {}
+
+    bool next(String& out) override {
+        if (done) return false;
+        out += body;
+        done = true;
+        return true;
+    }
 
 private:
-    static String htmlHeader(const String& title);
-    static String htmlFooter();
-    static String buildNavigation();
+    String body;
+    bool done = false;
+};
+
+class WebPages {
+public:
+    // Caller (WebController::sendPage) owns the returned source
+    static PageSource* controlPage(ContentManager* content);
+    static PageSource* schedulePage(ContentManager* content);
+    static PageSource* timesPage();
+    static PageSource* logsPage();
+    static PageSource* discoveryPage(ContentManager* content);
+
+    static void htmlHeader(String& out, const char* title);
+    static void htmlFooter(String& out);
+    static void navigation(String& out);
 };
@@ -0,0 +1,306 @@
+/* ZoneManager.cpp
+   Zone players and the per-frame compositor
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - ZonePlayer::canPlay(); heat effects restart per zone item
+   V16.7.2-2026-01-14T15:00:00Z - Profiler scopes: zone step and composite
+   V16.7.1-2026-01-14T12:00:00Z - Zone starts traced (TraceLog)
+   V16.7.0-2026-01-14T09:00:00Z - Level macros
+   V16.5.8-2026-01-13T09:00:00Z - Idle passes render periodic procedurals ahead
+   V16.5.7-2026-01-13T06:00:00Z - Initial implementation
+*/
+
+#include "ZoneManager.h"
+#include "MatrixDisplay.h"
+#include "ThemeManager.h"
+#include "TimeService.h"
+#include "Animations.h"
+#include "Effects.h"
+#include "Scroll.h"
+#include "Countdown.h"
+#include "Logger.h"
+#include "TraceLog.h"
+#include "Profiler.h"
+
+extern ThemeManager themeManager;
+
+ZoneManager zones;
+
+// ========== ZonePlayer ==========
+
+ZonePlayer::~ZonePlayer() {
+    releaseRenderer();
+    releaseFade();
+}
+
+void ZonePlayer::attach(MatrixDisplay* display, ContentManager* content, const Zone& z) {
+    disp = display;
+    contentMgr = content;
+    zone = z;
+}
+
+void ZonePlayer::clearZone() {
+    for (int m = zone.firstMatrix; m < zone.firstMatrix + zone.matrixCount; m++) {
+        disp->clearMatrix(m);
+    }
+}
+
+void ZonePlayer::releaseRenderer() {
+    delete scroll;
+    delete countdown;
+    scroll = nullptr;
+    countdown = nullptr;
+}
+
+void ZonePlayer::releaseFade() {
+    free(from);
+    free(hold);
+    from = nullptr;
+    hold = nullptr;
+    blended = false;
+}
+
+bool ZonePlayer::play(const ContentItem& next, bool fade) {
+    releaseRenderer();
+    releaseFade();
+
+    // Keep the outgoing frame; it is mixed over the new content until ZONE_TRANSITION_MS
+    if (fade && active && ZONE_TRANSITION_MS > 0) {
+        from = (CRGB*)malloc(ledCount() * sizeof(CRGB));
+        hold = (CRGB*)malloc(ledCount() * sizeof(CRGB));
+        if (from && hold) {
+            memcpy(from, disp->getLeds() + firstLed(), ledCount() * sizeof(CRGB));
+            fadeStart = millis();
+        } else {
+            releaseFade();  // No memory: hard cut
+        }
+    }
+
+    item = next;
+    frames = 0;
+    for (int m = zone.firstMatrix; m < zone.firstMatrix + zone.matrixCount; m++) {
+        Effects::restartHeat(m);  // V16.7.4-2026-01-15T09:00:00Z - Start from the seed, not a stale field
+    }
+    pending = true;
+    active = false;
+
+    bool ok = false;
+    frameMs = 0;
+    switch (item.type) {
+        case CONTENT_SCENE:
+        case CONTENT_ANIMATION:
+            ok = true;  // Static: drawn once
+            break;
+
+        case CONTENT_SCROLL:
+            scroll = new Scroll(disp, &themeManager);
+            scroll->setZone(zone.firstMatrix, zone.matrixCount);
+            ok = scroll->loadFromJSON(item.path);
+            if (ok) {
+                scroll->begin();
+                frameMs = max(1, scroll->getSpeed());
+            }
+            break;
+
+        case CONTENT_COUNTDOWN:
+            countdown = new Countdown(disp, &themeManager, &timeService);
+            countdown->setZone(zone.firstMatrix, zone.matrixCount);
+            ok = countdown->loadFromJSON(item.path);
+            if (ok) {
+                countdown->begin();
+                frameMs = 100;  // Same poll rate as Countdown::update()
+            }
+            break;
+
+        case CONTENT_PROCEDURAL:
+            frameMs = Animations::frameInterval(item.name);
+            ok = frameMs > 0;
+            break;
+
+        default:
+            break;
+    }
+
+    if (!ok) {
+        Logger::instance().log("[Zone] Cannot play '" + item.name + "' in zone at matrix " +
+                               String(zone.firstMatrix));
+        stop();
+        return false;
+    }
+
+    active = true;
+    clearZone();
+    return true;
+}
+
+bool ZonePlayer::canPlay(const ContentItem& item) {
+    switch (item.type) {
+        case CONTENT_SCENE:
+        case CONTENT_ANIMATION:
+        case CONTENT_SCROLL:
+        case CONTENT_COUNTDOWN:
+            return true;
+        case CONTENT_PROCEDURAL:
+            return Animations::frameInterval(item.name) > 0;
+        default:
+            return false;
+    }
+}
+
+void ZonePlayer::stop() {
+    releaseRenderer();
+    releaseFade();
+    if (disp) clearZone();
+    active = false;
+    frameMs = 0;
+}
+
+bool ZonePlayer::step(unsigned long now) {
+    if (!active) return false;
+
+    bool changed = false;
+    if (from && now - fadeStart >= ZONE_TRANSITION_MS) {
+        releaseFade();
+        changed = true;  // One more show() without the outgoing frame
+    }
+
+    if (!pending && (frameMs == 0 || now - lastFrame < frameMs)) return changed;
+    pending = false;
+    lastFrame = now;
+    frames++;
+
+    switch (item.type) {
+        case CONTENT_SCENE:
+        case CONTENT_ANIMATION:
+            clearZone();
+            for (int k = 0; k < zone.matrixCount; k++) {
+                contentMgr->drawScene(item, k, zone.firstMatrix + k);
+            }
+            return true;
+
+        case CONTENT_SCROLL:
+            scroll->drawFrame();
+            return true;
+
+        case CONTENT_COUNTDOWN:
+            return countdown->drawFrame() || changed;
+
+        case CONTENT_PROCEDURAL:
+            for (int m = zone.firstMatrix; m < zone.firstMatrix + zone.matrixCount; m++) {
+                Animations::drawProcedural(item.name, disp, m, now);
+            }
+            return true;
+
+        default:
+            return changed;
+    }
+}
+
+void ZonePlayer::blendIn(CRGB* leds, unsigned long now) {
+    if (!from) return;
+    uint8_t level = (uint8_t)min<unsigned long>(255, (now - fadeStart) * 255 / ZONE_TRANSITION_MS);
+    CRGB* zoneLeds = leds + firstLed();
+    memcpy(hold, zoneLeds, ledCount() * sizeof(CRGB));
+    for (int i = 0; i < ledCount(); i++) {
+        zoneLeds[i] = blend(from[i], zoneLeds[i], level);
+    }
+    blended = true;
+}
+
+void ZonePlayer::restore(CRGB* leds) {
+    if (!blended) return;
+    memcpy(leds + firstLed(), hold, ledCount() * sizeof(CRGB));
+    blended = false;
+}
+
+// ========== ZoneManager ==========
+
+void ZoneManager::begin(MatrixDisplay* display, ContentManager* content) {
+    disp = display;
+    contentMgr = content;
+    setSplit(true);
+}
+
+void ZoneManager::setSplit(bool on) {
+    stopAll();
+    split = on;
+    if (split) {
+        zoneCount = MATRIX_COUNT;
+        for (int z = 0; z < zoneCount; z++) {
+            players[z].attach(disp, contentMgr, Zone{(uint8_t)z, 1});
+        }
+    } else {
+        zoneCount = 1;
+        players[0].attach(disp, contentMgr, Zone{0, MATRIX_COUNT});
+    }
+    Logger::instance().log(String("[Zone] Layout: ") + (split ? "split" : "joined") +
+                           ", " + String(zoneCount) + " zone(s)");
+}
+
+bool ZoneManager::play(int zone, uint16_t contentId) {
+    if (!disp || zone < 0 || zone >= zoneCount) return false;
+    const ContentItem* item = contentMgr->getContentById(contentId);
+    if (!item) return false;
+
+    if (!players[zone].play(*item, true)) {
+        disp->show();  // Zone was cleared
+        return false;
+    }
+    // PostFx is display-wide: only a zone that is the whole display gets the item's settings
+    disp->setPostFx(split ? PostFxSettings() : item->postfx);
+    LOG_I("[Zone] %d playing: %s", zone, item->name.c_str());
+    traceLog.event(TRACE_ZONE, zone, item->id);  // V16.7.1-2026-01-14T12:00:00Z
+    return true;
+}
+
+void ZoneManager::stop(int zone) {
+    if (!disp || zone < 0 || zone >= zoneCount) return;
+    players[zone].stop();
+    if (!split) disp->setPostFx(PostFxSettings());
+    disp->show();
+}
+
+void ZoneManager::stopAll() {
+    bool any = isActive();
+    for (auto& player : players) {
+        if (player.isActive()) player.stop();
+    }
+    if (any && disp) {
+        disp->setPostFx(PostFxSettings());
+        disp->show();
+    }
+}
+
+bool ZoneManager::isActive() const {
+    for (int z = 0; z < zoneCount; z++) {
+        if (players[z].isActive()) return true;
+    }
+    return false;
+}
+
+void ZoneManager::update() {
+    if (!disp || !isActive()) return;
+    PROFILE_SCOPE("ZoneManager::update");  // V16.7.2-2026-01-14T15:00:00Z
+
+    unsigned long now = millis();
+    bool dirty = false;
+    bool fading = false;
+    for (int z = 0; z < zoneCount; z++) {
+        dirty |= players[z].step(now);
+        fading |= players[z].isFading();
+    }
+    if (!dirty && !fading) {
+        Animations::renderAhead(disp, FRAME_CACHE_AHEAD_US);  // V16.5.8-2026-01-13T09:00:00Z
+        return;
+    }
+
+    CRGB* leds = disp->getLeds();
+    {
+        PROFILE_SCOPE("zone composite");
+        for (int z = 0; z < zoneCount; z++) {
+            players[z].blendIn(leds, now);
+        }
+    }
+    disp->show();
+    for (int z = 0; z < zoneCount; z++) {
+        players[z].restore(leds);
+    }
+}
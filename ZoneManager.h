@@ -0,0 +1,117 @@
+/* ZoneManager.h
+   Independent content per output region, composited into one frame
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - canPlay(): zone content check without starting it
+   V16.5.7-2026-01-13T06:00:00Z - Initial implementation
+
+   A zone is a run of adjacent matrices. Split layout (default): one zone per matrix, so
+   the left window can show a countdown while the right plays snowfall. Joined layout:
+   one zone over all matrices (scroll text runs across both windows).
+   Each zone has its own ZonePlayer: content item, frame interval, renderer state and
+   cross-fade. update() draws every zone whose frame is due into the shared leds[],
+   then calls show() once - one color/power pass and one FastLED.show() per frame,
+   however many zones drew.
+   Zones draw RGB (the palette-indexed mode is display-wide). Item postfx is applied
+   on the joined layout only, since PostFx acts on the whole frame.
+   "Tree ..." procedurals and test patterns are not zone content; renderContent() plays them.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Config.h"
+#include "ContentManager.h"
+
+class MatrixDisplay;
+class Scroll;
+class Countdown;
+
+struct Zone {
+    uint8_t firstMatrix;
+    uint8_t matrixCount;
+};
+
+class ZonePlayer {
+public:
+    ZonePlayer() {}
+    ~ZonePlayer();
+    ZonePlayer(const ZonePlayer&) = delete;
+    ZonePlayer& operator=(const ZonePlayer&) = delete;
+
+    void attach(MatrixDisplay* display, ContentManager* content, const Zone& z);
+    const Zone& getZone() const { return zone; }
+
+    // Start an item; with fade, the zone's current frame cross-fades into it
+    bool play(const ContentItem& item, bool fade);
+    // Type a zone can play (scroll/countdown files are only checked by play())
+    static bool canPlay(const ContentItem& item);
+    void stop();
+    bool isActive() const { return active; }
+    const ContentItem& getItem() const { return item; }
+    uint16_t getFrameMs() const { return frameMs; }     // 0 = static, drawn once
+    uint32_t getFrames() const { return frames; }
+
+    // Draw the next frame if it is due; true if the zone's pixels changed
+    bool step(unsigned long now);
+
+    // Around show(): mix the outgoing frame over the zone, then put the real frame back
+    bool isFading() const { return from != nullptr; }
+    void blendIn(CRGB* leds, unsigned long now);
+    void restore(CRGB* leds);
+
+private:
+    MatrixDisplay* disp = nullptr;
+    ContentManager* contentMgr = nullptr;
+    Zone zone = {0, 1};
+
+    ContentItem item;
+    bool active = false;
+    uint16_t frameMs = 0;
+    unsigned long lastFrame = 0;
+    bool pending = false;           // First frame not drawn yet
+    uint32_t frames = 0;
+
+    Scroll* scroll = nullptr;       // Only for CONTENT_SCROLL items
+    Countdown* countdown = nullptr; // Only for CONTENT_COUNTDOWN items
+
+    CRGB* from = nullptr;           // Outgoing frame, while fading
+    CRGB* hold = nullptr;           // Real frame while the blended one is shown
+    unsigned long fadeStart = 0;
+    bool blended = false;
+
+    int firstLed() const { return zone.firstMatrix * MATRIX_LEDS; }
+    int ledCount() const { return zone.matrixCount * MATRIX_LEDS; }
+    void clearZone();
+    void releaseRenderer();
+    void releaseFade();
+};
+
+class ZoneManager {
+public:
+    ZoneManager() {}
+
+    void begin(MatrixDisplay* display, ContentManager* content);
+
+    // Split = one zone per matrix, joined = one zone over all. Stops every zone.
+    void setSplit(bool split);
+    bool isSplit() const { return split; }
+    int getZoneCount() const { return zoneCount; }
+    const ZonePlayer& getPlayer(int zone) const { return players[zone]; }
+
+    bool play(int zone, uint16_t contentId);
+    void stop(int zone);
+    void stopAll();
+    bool isActive() const;
+
+    // Called from loop(): step due zones, composite, one show()
+    void update();
+
+private:
+    MatrixDisplay* disp = nullptr;
+    ContentManager* contentMgr = nullptr;
+    ZonePlayer players[MATRIX_COUNT];
+    int zoneCount = 0;
+    bool split = true;
+};
+
+extern ZoneManager zones;
@@ -50,6 +50,21 @@ if errorlevel 1 (
     goto :EOF
 )
 echo Minification complete!
+
+REM ============================
+REM COMPRESS WEB UI
+REM V16.7.4-2026-01-15T09:00:00Z - web\*.gz built into the staging folder, after minify
+REM (minify_json.py only copies .json files)
+REM ============================
+echo.
+echo Step 1b: Compressing web UI...
+%PYTHON% "%PROJECT_DIR%\tools\gzip_web.py" "%PROJECT_DIR%" "%DATA_OUT%\web"
+if errorlevel 1 (
+    echo ERROR: Web UI compression failed
+    pause
+    goto :EOF
+)
+echo Web UI complete!
 pause
 
 REM ============================
@@ -0,0 +1,184 @@
+"""
+build_fonts.py
+V16.4.0-2026-01-11T09:00:00Z
+Font compiler - turns the ASCII-art *.font sources in this folder into
+bit-packed, variable-width glyph tables (FontData.cpp) for Font.h
+
+Source format:
+    height <rows>            all glyphs share one height
+    spacing <cols>           blank columns added after each glyph
+    fallback <char>          glyph drawn for unknown code points
+    glyph U+XXXX [comment]   starts a glyph; next <height> lines are rows
+    #...#                    '#' = lit pixel, '.' = off; row length = width
+Lines starting with '#' followed by a space are comments.
+
+Packing:
+    Each glyph is width*height bits, row-major, MSB first, stored back to
+    back in one bitstream (no per-glyph byte padding). Glyph descriptors are
+    sorted by code point for binary search. Two zero bytes are appended so
+    the runtime can always read a 3-byte window.
+"""
+import os
+import sys
+import glob
+import argparse
+
+MAX_GLYPH_WIDTH = 16
+MAX_BIT_OFFSET = 0xFFFF
+
+def parse_font(path):
+    """Parse one .font source into (height, spacing, fallback, glyphs)"""
+    height = None
+    spacing = 1
+    fallback = ord('?')
+    glyphs = {}
+    current = None
+    rows = []
+
+    def finish(line_no):
+        if current is None:
+            return
+        if len(rows) != height:
+            raise ValueError(f"{path}:{line_no}: U+{current:04X} has {len(rows)} rows, expected {height}")
+        widths = set(len(r) for r in rows)
+        if len(widths) != 1:
+            raise ValueError(f"{path}:{line_no}: U+{current:04X} has ragged rows")
+        width = widths.pop()
+        if width < 1 or width > MAX_GLYPH_WIDTH:
+            raise ValueError(f"{path}:{line_no}: U+{current:04X} width {width} out of range")
+        if current in glyphs:
+            raise ValueError(f"{path}:{line_no}: duplicate glyph U+{current:04X}")
+        glyphs[current] = list(rows)
+
+    with open(path, "r", encoding="utf-8") as fh:
+        lines = fh.read().splitlines()
+
+    for line_no, raw in enumerate(lines, 1):
+        line = raw.rstrip()
+        if current is not None and len(rows) < height:
+            if not line or any(c not in "#." for c in line):
+                raise ValueError(f"{path}:{line_no}: bad glyph row '{line}'")
+            rows.append(line)
+            continue
+        if not line or line.startswith("# "):
+            continue
+        parts = line.split()
+        key = parts[0]
+        if key == "height":
+            height = int(parts[1])
+        elif key == "spacing":
+            spacing = int(parts[1])
+        elif key == "fallback":
+            fallback = ord(parts[1])
+        elif key == "glyph":
+            if height is None:
+                raise ValueError(f"{path}:{line_no}: 'height' must come before glyphs")
+            finish(line_no)
+            if not parts[1].startswith("U+"):
+                raise ValueError(f"{path}:{line_no}: expected U+XXXX code point")
+            current = int(parts[1][2:], 16)
+            if current > 0xFFFF:
+                raise ValueError(f"{path}:{line_no}: only BMP code points are supported")
+            rows = []
+        else:
+            raise ValueError(f"{path}:{line_no}: unknown directive '{key}'")
+
+    finish(len(lines))
+
+    if fallback not in glyphs:
+        raise ValueError(f"{path}: fallback glyph U+{fallback:04X} not defined")
+    return height, spacing, fallback, glyphs
+
+def pack_font(height, glyphs):
+    """Pack glyphs into one MSB-first bitstream; returns (bytes, descriptors)"""
+    bits = []
+    descriptors = []
+    for cp in sorted(glyphs):
+        rows = glyphs[cp]
+        width = len(rows[0])
+        offset = len(bits)
+        if offset > MAX_BIT_OFFSET:
+            raise ValueError(f"bitmap too large at U+{cp:04X}")
+        for row in rows:
+            bits.extend(1 if c == "#" else 0 for c in row)
+        descriptors.append((cp, offset, width))
+
+    data = bytearray((len(bits) + 7) // 8 + 2)
+    for i, bit in enumerate(bits):
+        if bit:
+            data[i >> 3] |= 0x80 >> (i & 7)
+    return bytes(data), descriptors
+
+def symbol_for(path):
+    """font_5x7.font -> FONT_5X7"""
+    base = os.path.splitext(os.path.basename(path))[0]
+    return base.upper()
+
+def describe(cp):
+    if 32 < cp < 127 and chr(cp) not in "\\'":
+        return f"'{chr(cp)}'"
+    return f"U+{cp:04X}"
+
+def emit(fonts, output_file):
+    """Write FontData.cpp"""
+    out = []
+    out.append("/* FontData.cpp")
+    out.append("   Bit-packed glyph tables generated by tools/fonts/build_fonts.py")
+    out.append("   DO NOT EDIT - change the .font sources and re-run the compiler")
+    out.append("*/")
+    out.append("")
+    out.append('#include "Font.h"')
+
+    for symbol, name, height, spacing, fallback, data, descriptors in fonts:
+        out.append("")
+        out.append(f"// ---- {symbol}: {len(descriptors)} glyphs, {len(data)} bitmap bytes ----")
+        out.append(f"static const uint8_t {symbol}_BITMAP[] = {{")
+        for i in range(0, len(data), 16):
+            chunk = ", ".join(f"0x{b:02X}" for b in data[i:i + 16])
+            out.append(f"  {chunk},")
+        out.append("};")
+        out.append("")
+        out.append(f"static const Glyph {symbol}_GLYPHS[] = {{")
+        for cp, offset, width in descriptors:
+            out.append(f"  {{0x{cp:04X}, {offset:5d}, {width:2d}}},  // {describe(cp)}")
+        out.append("};")
+        out.append("")
+        out.append(f"const Font {symbol} = {{")
+        out.append(f'  "{name}", {height}, {spacing}, 0x{fallback:04X}, {len(descriptors)},')
+        out.append(f"  {symbol}_GLYPHS, {symbol}_BITMAP")
+        out.append("};")
+
+    with open(output_file, "w", encoding="utf-8", newline="\n") as fh:
+        fh.write("\n".join(out) + "\n")
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser()
+    parser.add_argument("sources", nargs="*", help="Font sources (default: tools/fonts/*.font)")
+    parser.add_argument("-o", "--output", default=os.path.join(here, "..", "..", "FontData.cpp"),
+                        help="Output C++ file (default: sketch folder FontData.cpp)")
+    args = parser.parse_args()
+
+    sources = args.sources or sorted(glob.glob(os.path.join(here, "*.font")))
+    if not sources:
+        print("ERROR: No font sources found!")
+        sys.exit(1)
+
+    fonts = []
+    for path in sources:
+        try:
+            height, spacing, fallback, glyphs = parse_font(path)
+            data, descriptors = pack_font(height, glyphs)
+        except ValueError as e:
+            print(f"ERROR: {e}")
+            sys.exit(1)
+        symbol = symbol_for(path)
+        name = symbol.split("_", 1)[-1].lower()
+        fonts.append((symbol, name, height, spacing, fallback, data, descriptors))
+        print(f"  {symbol}: {len(descriptors)} glyphs, height {height}, {len(data)} bytes")
+
+    emit(fonts, args.output)
+    print(f"Font data written: {os.path.normpath(args.output)}")
+
+if __name__ == "__main__":
+    main()
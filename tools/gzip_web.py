@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""gzip_web.py - compress the web UI into the content image staging folder.
+
+V16.7.4-2026-01-15T09:00:00Z - Output folder argument; run by json_datain_2_FFAT.bat after minify
+V16.6.1-2026-01-13T15:00:00Z - Initial implementation
+
+Reads web/* and writes <output>/<file>.gz, which the content image packs like any other
+file; the firmware sends them as stored with Content-Encoding: gzip (WebController).
+"{{name}}" in index.html becomes a short hash of that asset, so /app.js?v=<hash> changes
+whenever app.js does and assets can be cached for a year.
+The .gz files are build output, generated fresh for every image: not committed.
+
+Usage: python3 tools/gzip_web.py [repo root [output folder]]   (default <root>/data/web)
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), "..")
+src_dir = os.path.join(root, "web")
+out_dir = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "data", "web")
+
+
+def compress(data):
+    # mtime=0: identical input gives an identical image
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def main():
+    files = sorted(f for f in os.listdir(src_dir) if os.path.isfile(os.path.join(src_dir, f)))
+    sources = {}
+    for name in files:
+        with open(os.path.join(src_dir, name), "rb") as f:
+            sources[name] = f.read()
+
+    hashes = {name: hashlib.sha1(data).hexdigest()[:8] for name, data in sources.items()}
+
+    def version(match):
+        name = match.group(1).decode()
+        if name not in hashes:
+            sys.exit("index.html references unknown asset: " + name)
+        return hashes[name].encode()
+
+    if "index.html" in sources:
+        sources["index.html"] = re.sub(rb"\{\{([\w.\-]+)\}\}", version, sources["index.html"])
+
+    os.makedirs(out_dir, exist_ok=True)
+    for stale in os.listdir(out_dir):
+        if stale.endswith(".gz") and stale[:-3] not in sources:
+            os.remove(os.path.join(out_dir, stale))
+
+    total_in = total_out = 0
+    for name, data in sources.items():
+        packed = compress(data)
+        with open(os.path.join(out_dir, name + ".gz"), "wb") as f:
+            f.write(packed)
+        total_in += len(data)
+        total_out += len(packed)
+        print("  web/%s.gz  %6d -> %5d bytes" % (name, len(data), len(packed)))
+    print("%d files, %d -> %d bytes" % (len(sources), total_in, total_out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,152 @@
+/* heat_golden.cpp
+   Linux host runner for HeatField - steps each preset from a fixed seed and
+   prints per-frame checksums, so simulation changes can be compared against the
+   committed golden output (and against the ESP32, which runs the same code).
+   VERSION: V16.7.4-2026-01-15T09:00:00Z - --check: compare against tools/heat/golden.txt, exit 1 on a mismatch
+   V16.5.1-2026-01-12T12:00:00Z - Initial implementation
+
+   Build (from the repo root):
+       g++ -std=c++17 -O2 -I. tools/heat/heat_golden.cpp HeatField.cpp -o heat_golden
+   Run:
+       ./heat_golden --check tools/heat/golden.txt             (after any HeatField change)
+       ./heat_golden [cols rows frames seed] > out.txt         (default 50 40 200 24301)
+       ./heat_golden 20 25 60 24301 --ascii                    (also dump the last frame)
+   golden.txt is the output of the default run plus "25 20 100" (one matrix). Regenerate it
+   only for an intended change to the simulation, and say so in the commit.
+*/
+
+#include "HeatField.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct Preset {
+    const char* name;
+    const HeatParams* params;
+};
+
+static const Preset* findPreset(const Preset* presets, int count, const char* name) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(presets[i].name, name) == 0) return &presets[i];
+    }
+    return nullptr;
+}
+
+// Every "<preset> <cols>x<rows> seed=<n> frame=<n> checksum=<hex>" line is re-simulated
+// and compared; lines starting with '#' are comments. 0 = all match.
+static int check(const char* path, const Preset* presets, int count) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 2;
+    }
+
+    HeatField field;
+    const Preset* current = nullptr;
+    int curCols = 0, curRows = 0, curFrame = 0;
+    uint32_t curSeed = 0;
+    int lines = 0, failures = 0;
+    char line[160];
+    while (fgets(line, sizeof(line), in)) {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+        char name[16];
+        int cols, rows, frame;
+        unsigned seed, expected;
+        if (sscanf(line, "%15s %dx%d seed=%u frame=%d checksum=%x", name, &cols, &rows, &seed, &frame,
+                   &expected) != 6) {
+            fprintf(stderr, "%s: cannot parse: %s", path, line);
+            failures++;
+            continue;
+        }
+        const Preset* preset = findPreset(presets, count, name);
+        if (!preset) {
+            fprintf(stderr, "%s: unknown preset: %s", path, line);
+            failures++;
+            continue;
+        }
+
+        // Lines of one run follow each other; anything else starts the field again
+        if (preset != current || cols != curCols || rows != curRows || seed != curSeed || frame < curFrame) {
+            if (!field.begin(cols, rows, seed)) {
+                fprintf(stderr, "out of memory\n");
+                fclose(in);
+                return 2;
+            }
+            current = preset;
+            curCols = cols;
+            curRows = rows;
+            curSeed = seed;
+            curFrame = 0;
+        }
+        while (curFrame < frame) {
+            field.step(*preset->params);
+            curFrame++;
+        }
+
+        lines++;
+        uint32_t actual = field.checksum();
+        if (actual != expected) {
+            printf("MISMATCH %s %dx%d seed=%u frame=%d checksum=%08x expected=%08x\n",
+                   name, cols, rows, seed, frame, actual, expected);
+            failures++;
+        }
+    }
+    fclose(in);
+
+    printf("%d checksums, %d failures\n", lines, failures);
+    return failures || lines == 0 ? 1 : 0;
+}
+
+static void dump(const HeatField& field) {
+    static const char shades[] = " .:-=+*#%@";
+    const uint8_t* heat = field.data();
+    for (int y = 0; y < field.getRows(); y++) {
+        for (int x = 0; x < field.getCols(); x++) {
+            putchar(shades[heat[y * field.getCols() + x] * 10 / 256]);
+        }
+        putchar('\n');
+    }
+}
+
+int main(int argc, char** argv) {
+    const Preset presets[] = {
+        {"fire", &HeatPresets::FIRE},
+        {"embers", &HeatPresets::EMBERS},
+        {"smoke", &HeatPresets::SMOKE},
+    };
+    const int presetCount = sizeof(presets) / sizeof(presets[0]);
+
+    if (argc > 1 && strcmp(argv[1], "--check") == 0) {
+        return check(argc > 2 ? argv[2] : "tools/heat/golden.txt", presets, presetCount);
+    }
+
+    int cols = argc > 1 ? atoi(argv[1]) : 50;
+    int rows = argc > 2 ? atoi(argv[2]) : 40;
+    int frames = argc > 3 ? atoi(argv[3]) : 200;
+    uint32_t seed = argc > 4 ? (uint32_t)strtoul(argv[4], nullptr, 0) : 0x5EED;
+    bool ascii = argc > 5 && strcmp(argv[5], "--ascii") == 0;
+
+    for (const Preset& preset : presets) {
+        HeatField field;
+        if (!field.begin(cols, rows, seed)) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 1; f <= frames; f++) {
+            field.step(*preset.params);
+            if (f % 20 == 0 || f == frames) {
+                printf("%s %dx%d seed=%u frame=%d checksum=%08x\n",
+                       preset.name, cols, rows, seed, f, field.checksum());
+            }
+        }
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        fprintf(stderr, "%s: %.1f us/frame (host)\n", preset.name, (double)us / frames);
+
+        if (ascii) dump(field);
+    }
+    return 0;
+}
@@ -0,0 +1,143 @@
+/* log_bench.cpp
+   Host benchmark for the log ring (LogRing.h) against the old vector<String> buffer
+   VERSION: V16.7.0-2026-01-14T09:00:00Z - Initial implementation
+
+   Runs the same formatted log line from N writer threads into
+   - the ring, exactly as Logger uses it (LOG_SLOTS x LOG_SLOT_TEXT), while a reader
+     thread follows it the way the serial drain and the event stream do, and
+   - the previous design: a mutex, a heap-built std::string and erase(begin()) once
+     the buffer holds LOG_SLOTS lines,
+   and prints calls per second for each. The reader checks every entry it gets: sequence
+   numbers strictly increase and the text matches the writer and counter it names, so a
+   torn or misattributed read fails the run.
+
+       g++ -O2 -std=c++17 -pthread -o /tmp/log_bench tools/log_bench.cpp
+       /tmp/log_bench [threads] [calls per thread]
+*/
+
+#include "../LogRing.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const size_t SLOTS = 128;  // LOG_SLOTS
+static const size_t TEXT = 100;   // LOG_SLOT_TEXT
+
+typedef LogRing<SLOTS, TEXT> Ring;
+
+static Ring ring;
+
+static void ringLog(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    ring.write(LOG_LEVEL_INFO, 0, fmt, args);
+    va_end(args);
+}
+
+struct VectorLog {
+    std::mutex lock;
+    std::vector<std::string> lines;
+
+    void log(const std::string& line) {
+        std::lock_guard<std::mutex> guard(lock);
+        lines.push_back(line);
+        if (lines.size() > SLOTS) lines.erase(lines.begin());
+    }
+};
+
+static VectorLog vectorLog;
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    int calls = argc > 2 ? atoi(argv[2]) : 200000;
+    if (threads < 1 || calls < 1) {
+        fprintf(stderr, "usage: %s [threads] [calls per thread]\n", argv[0]);
+        return 2;
+    }
+    double total = (double)threads * calls;
+
+    // Ring, with a concurrent reader checking what it sees
+    std::atomic<bool> writing{true};
+    unsigned long readCount = 0, lost = 0, bad = 0;
+    std::thread reader([&] {
+        Ring::Entry entry;
+        uint32_t cursor = 0;
+        while (true) {
+            bool more = writing.load();
+            if (!ring.read(cursor, entry)) {
+                if (!more) break;
+                std::this_thread::yield();
+                continue;
+            }
+            if (entry.seq <= cursor) bad++;
+            lost += entry.seq - cursor - 1;
+            cursor = entry.seq;
+            readCount++;
+
+            int thread = -1, counter = -1;
+            char check[TEXT];
+            if (sscanf(entry.text, "[Bench] thread %d call %d", &thread, &counter) != 2) {
+                bad++;
+                continue;
+            }
+            snprintf(check, sizeof(check), "[Bench] thread %d call %d: brightness %d, zone %s", thread,
+                     counter, counter % 256, thread % 2 ? "left" : "right");
+            if (strcmp(check, entry.text) != 0) bad++;
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; t++) {
+        writers.emplace_back([t, calls] {
+            for (int i = 0; i < calls; i++) {
+                ringLog("[Bench] thread %d call %d: brightness %d, zone %s", t, i, i % 256,
+                        t % 2 ? "left" : "right");
+            }
+        });
+    }
+    for (auto& w : writers) w.join();
+    double ringTime = seconds(start);
+    writing = false;
+    reader.join();
+
+    // Old buffer
+    writers.clear();
+    start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        writers.emplace_back([t, calls] {
+            for (int i = 0; i < calls; i++) {
+                vectorLog.log("[Bench] thread " + std::to_string(t) + " call " + std::to_string(i) +
+                              ": brightness " + std::to_string(i % 256) + ", zone " +
+                              (t % 2 ? "left" : "right"));
+            }
+        });
+    }
+    for (auto& w : writers) w.join();
+    double vectorTime = seconds(start);
+
+    // A quiet ring must hand back exactly its last SLOTS entries, in order
+    Ring::Entry entry;
+    uint32_t cursor = 0, tail = 0;
+    while (ring.read(cursor, entry)) {
+        cursor = entry.seq;
+        tail++;
+    }
+    if (cursor != ring.last() || tail != (total < SLOTS ? (uint32_t)total : SLOTS)) bad++;
+
+    printf("%d threads x %d calls, %zu slots of %zu bytes\n", threads, calls, SLOTS, TEXT);
+    printf("  ring:          %12.0f calls/s\n", total / ringTime);
+    printf("  vector+mutex:  %12.0f calls/s  (ring is %.1fx)\n", total / vectorTime,
+           vectorTime / ringTime);
+    printf("  reader: %lu entries checked, %lu overwritten before being read, %lu bad\n", readCount,
+           lost, bad);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+/* ntp_host_client.cpp
+   Linux host client for TimeMath - queries an NTP server (normally
+   ntp_standin.py) and prints the measured offset, the disciplined clock
+   and local time for a POSIX TZ string.
+   VERSION: V16.4.2-2026-01-11T14:00:00Z - Initial implementation
+
+   Build (from the repo root):
+       g++ -std=c++17 -I. tools/ntp/ntp_host_client.cpp TimeMath.cpp -o ntp_host_client
+   Run:
+       python tools/ntp/ntp_standin.py --offset 2.5 &
+       ./ntp_host_client 127.0.0.1 12300 "EST5EDT,M3.2.0,M11.1.0" [samples]
+*/
+
+#include "TimeMath.h"
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+static int64_t monoUs() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv) {
+    const char* host = argc > 1 ? argv[1] : "127.0.0.1";
+    int port = argc > 2 ? atoi(argv[2]) : 12300;
+    const char* tz = argc > 3 ? argv[3] : "EST5EDT,M3.2.0,M11.1.0";
+    int samples = argc > 4 ? atoi(argv[4]) : 5;
+
+    PosixTimeZone zone;
+    if (!zone.parse(tz)) {
+        fprintf(stderr, "Invalid TZ: %s\n", tz);
+        return 1;
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    timeval timeout = {1, 500000};
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, host, &addr.sin_addr);
+
+    // Start from the host clock like the device starts from boot time
+    ClockModel clock;
+    timeval tv;
+    gettimeofday(&tv, nullptr);
+    int64_t start = monoUs();
+    clock.apply(start, (int64_t)tv.tv_sec * 1000000 + tv.tv_usec - clock.epochUs(start));
+
+    for (int i = 0; i < samples; i++) {
+        uint8_t packet[Ntp::PACKET_SIZE];
+        int64_t t1 = clock.epochUs(monoUs());
+        Ntp::buildRequest(packet, t1);
+        sendto(sock, packet, sizeof(packet), 0, (sockaddr*)&addr, sizeof(addr));
+
+        ssize_t n = recv(sock, packet, sizeof(packet), 0);
+        int64_t t4 = clock.epochUs(monoUs());
+        Ntp::Sample sample;
+        if (n <= 0 || !Ntp::parseResponse(packet, (size_t)n, t1, t4, sample)) {
+            printf("sample %d: no valid reply\n", i);
+        } else {
+            clock.apply(monoUs(), sample.offsetUs);
+            printf("sample %d: offset %+.3f ms  delay %.3f ms  stratum %u  drift %d ppb\n",
+                   i, sample.offsetUs / 1000.0, sample.delayUs / 1000.0,
+                   sample.stratum, clock.getDriftPpb());
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+
+    int64_t utc = clock.epochUs(monoUs()) / 1000000;
+    TimeMath::DateTime local;
+    TimeMath::breakDown(zone.toLocal(utc), local);
+    printf("UTC %lld -> %04d-%02d-%02d %02d:%02d:%02d %s (UTC%+d s)\n",
+           (long long)utc, local.year, local.month, local.day,
+           local.hour, local.minute, local.second,
+           zone.abbreviation(utc), zone.offsetAt(utc));
+
+    close(sock);
+    return 0;
+}
@@ -0,0 +1,95 @@
+"""
+ntp_standin.py
+V16.4.2-2026-01-11T14:00:00Z
+Local stand-in NTP server for exercising TimeService / TimeMath without
+internet access. Serves SNTP replies from this machine's clock with an
+optional fixed offset, frequency drift, extra delay and packet loss.
+
+Usage:
+    python ntp_standin.py [--port 12300] [--offset 2.5] [--drift-ppm 40]
+                          [--delay-ms 30] [--loss 0.2] [--kod]
+
+Point the ESP32 at it by setting NTP_SERVER in Config.h to this machine's
+address (port 123 needs root/admin), or run tools/ntp/ntp_host_client.cpp
+on the same machine.
+"""
+import argparse
+import random
+import socket
+import struct
+import time
+
+NTP_UNIX_DELTA = 2208988800
+
+
+def to_ntp(unix_seconds):
+    secs = int(unix_seconds)
+    frac = int((unix_seconds - secs) * (1 << 32)) & 0xFFFFFFFF
+    return ((secs + NTP_UNIX_DELTA) & 0xFFFFFFFF) << 32 | frac
+
+
+class StandInClock:
+    """Host clock plus a fixed offset and a linear drift since start"""
+
+    def __init__(self, offset, drift_ppm):
+        self.offset = offset
+        self.drift = drift_ppm / 1e6
+        self.start = time.time()
+
+    def now(self):
+        t = time.time()
+        return t + self.offset + (t - self.start) * self.drift
+
+
+def build_reply(request, clock, receive_time, kod):
+    if len(request) < 48:
+        return None
+    version = (request[0] >> 3) & 0x07
+    mode = request[0] & 0x07
+    if mode != 3:
+        return None
+
+    stratum = 0 if kod else 2
+    header = struct.pack("!BBbb", (0 << 6) | (version << 3) | 4, stratum, 6, -20)
+    root = struct.pack("!II", 0, 0)
+    ref_id = b"RATE" if kod else b"LOCL"
+    originate = request[40:48]                     # Client transmit -> originate
+    ref = struct.pack("!Q", to_ntp(receive_time - 16))
+    rx = struct.pack("!Q", to_ntp(receive_time))
+    tx = struct.pack("!Q", to_ntp(clock.now()))
+    return header + root + ref_id + ref + originate + rx + tx
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Stand-in SNTP server")
+    parser.add_argument("--bind", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=12300)
+    parser.add_argument("--offset", type=float, default=0.0, help="Seconds added to host time")
+    parser.add_argument("--drift-ppm", type=float, default=0.0, help="Server clock frequency error")
+    parser.add_argument("--delay-ms", type=float, default=0.0, help="Extra delay before replying")
+    parser.add_argument("--loss", type=float, default=0.0, help="Fraction of requests dropped")
+    parser.add_argument("--kod", action="store_true", help="Reply with kiss-o'-death (stratum 0)")
+    args = parser.parse_args()
+
+    clock = StandInClock(args.offset, args.drift_ppm)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind((args.bind, args.port))
+    print(f"NTP stand-in on {args.bind}:{args.port} offset={args.offset}s "
+          f"drift={args.drift_ppm}ppm delay={args.delay_ms}ms loss={args.loss}")
+
+    while True:
+        request, addr = sock.recvfrom(512)
+        receive_time = clock.now()
+        if random.random() < args.loss:
+            print(f"{addr[0]}:{addr[1]} dropped")
+            continue
+        if args.delay_ms > 0:
+            time.sleep(args.delay_ms / 1000.0)
+        reply = build_reply(request, clock, receive_time, args.kod)
+        if reply:
+            sock.sendto(reply, addr)
+            print(f"{addr[0]}:{addr[1]} served")
+
+
+if __name__ == "__main__":
+    main()
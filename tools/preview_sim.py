@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""preview_sim.py - serve the live preview stream and the web UI from the host.
+
+V16.6.3-2026-01-13T21:00:00Z - Initial implementation
+
+Compiles PreviewEncoder.cpp into a shared library and encodes with it, so the stream is
+byte-for-byte what the firmware sends on /ws/preview: a key frame per client, then
+delta/RLE messages, and a frame is dropped for a client whose socket is still writing.
+Frames come from a built-in test pattern at the same canvas size as the two windows.
+web/ is served as-is, so UI changes can be tried without flashing:
+
+    python3 tools/preview_sim.py [port]
+    open http://localhost:8765/#preview
+
+Needs a C++ compiler (c++ or $CXX); standard library only otherwise.
+"""
+
+import asyncio
+import base64
+import colorsys
+import ctypes
+import hashlib
+import math
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+port = int(sys.argv[1]) if len(sys.argv) > 1 else 8765
+
+WIDTH, HEIGHT = 40, 25      # MATRIX_COUNT * COLS, ROWS
+FPS = 10                    # PREVIEW_FPS
+FPS_MAX = 30                # PREVIEW_FPS_MAX
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+CONTENT_TYPES = {".html": "text/html", ".js": "application/javascript", ".css": "text/css"}
+
+
+def load_encoder():
+    lib_path = os.path.join(tempfile.gettempdir(), "preview_encoder.so")
+    subprocess.check_call([os.environ.get("CXX", "c++"), "-O2", "-shared", "-fPIC",
+                           "-DPREVIEW_HOST_EXPORT", "-o", lib_path,
+                           os.path.join(root, "PreviewEncoder.cpp")])
+    lib = ctypes.CDLL(lib_path)
+    lib.preview_encode.restype = ctypes.c_size_t
+    lib.preview_encode.argtypes = [ctypes.c_char_p, ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint16,
+                                   ctypes.c_int, ctypes.c_uint16, ctypes.c_void_p]
+    return lib
+
+
+encoder = load_encoder()
+packet = ctypes.create_string_buffer(8 + (WIDTH * HEIGHT + 1) // 2 * 7 + 4)  # PREVIEW_MAX_MESSAGE
+fps = FPS
+
+
+def render(frame_no):
+    # Left window: rainbow sweep. Right window: a dot chasing round a black field, so
+    # most of it is unchanged from frame to frame, like most real content.
+    out = bytearray(WIDTH * HEIGHT * 3)
+    half = WIDTH // 2
+    for y in range(HEIGHT):
+        for x in range(half):
+            r, g, b = colorsys.hsv_to_rgb(((x + y + frame_no) % 40) / 40.0, 1.0, 0.6)
+            i = (y * WIDTH + x) * 3
+            out[i:i + 3] = bytes((int(r * 255), int(g * 255), int(b * 255)))
+    angle = frame_no * 0.2
+    cx = half + half // 2 + int(round(math.cos(angle) * (half // 2 - 2)))
+    cy = HEIGHT // 2 + int(round(math.sin(angle) * (HEIGHT // 2 - 2)))
+    for dy in (-1, 0, 1):
+        for dx in (-1, 0, 1):
+            i = ((cy + dy) * WIDTH + cx + dx) * 3
+            out[i:i + 3] = b"\xff\xc0\x20"
+    return bytes(out)
+
+
+class Client:
+    def __init__(self, writer):
+        self.writer = writer
+        self.base = ctypes.create_string_buffer(WIDTH * HEIGHT * 3)
+        self.key = True
+
+
+clients = set()
+
+
+def ws_frame(opcode, payload):
+    head = bytes((0x80 | opcode,))
+    n = len(payload)
+    if n < 126:
+        head += bytes((n,))
+    elif n < 65536:
+        head += bytes((126,)) + struct.pack(">H", n)
+    else:
+        head += bytes((127,)) + struct.pack(">Q", n)
+    return head + payload
+
+
+async def read_messages(reader):
+    # Client frames are always masked; only short text ("fps=N") and close matter here
+    global fps
+    while True:
+        b0, b1 = await reader.readexactly(2)
+        n = b1 & 0x7F
+        if n == 126:
+            n = struct.unpack(">H", await reader.readexactly(2))[0]
+        elif n == 127:
+            n = struct.unpack(">Q", await reader.readexactly(8))[0]
+        mask = await reader.readexactly(4) if b1 & 0x80 else b"\0\0\0\0"
+        data = bytes(c ^ mask[i % 4] for i, c in enumerate(await reader.readexactly(n)))
+        opcode = b0 & 0x0F
+        if opcode == 0x8:
+            return
+        if opcode == 0x1 and data.startswith(b"fps="):
+            value = int(data[4:] or 0)
+            if 1 <= value <= FPS_MAX:
+                fps = value
+                print("rate:", fps, "fps")
+
+
+async def serve_file(writer, path):
+    name = "index.html" if path in ("", "/") else path.lstrip("/").split("?")[0]
+    file = os.path.normpath(os.path.join(root, "web", name))
+    if not file.startswith(os.path.normpath(os.path.join(root, "web"))) or not os.path.isfile(file):
+        writer.write(b"HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n")
+        return
+    with open(file, "rb") as f:
+        body = f.read()
+    if name == "index.html":
+        body = body.replace(b"{{app.js}}", b"sim").replace(b"{{app.css}}", b"sim")
+    content_type = CONTENT_TYPES.get(os.path.splitext(name)[1], "application/octet-stream")
+    writer.write(("HTTP/1.1 200 OK\r\nContent-Type: %s\r\nContent-Length: %d\r\n"
+                  "Cache-Control: no-cache\r\n\r\n" % (content_type, len(body))).encode() + body)
+
+
+async def handle(reader, writer):
+    try:
+        request = (await reader.readuntil(b"\r\n\r\n")).decode("latin-1").split("\r\n")
+        method, path = request[0].split(" ")[:2]
+        headers = {k.strip().lower(): v.strip() for k, v in
+                   (line.split(":", 1) for line in request[1:] if ":" in line)}
+        if path != "/ws/preview" or "sec-websocket-key" not in headers:
+            await serve_file(writer, path)
+            await writer.drain()
+            return
+        accept = base64.b64encode(hashlib.sha1((headers["sec-websocket-key"] + WS_GUID).encode()).digest())
+        writer.write(b"HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                     b"Connection: Upgrade\r\nSec-WebSocket-Accept: " + accept + b"\r\n\r\n")
+        client = Client(writer)
+        clients.add(client)
+        print("client connected (%d)" % len(clients))
+        try:
+            await read_messages(reader)
+        finally:
+            clients.discard(client)
+            print("client left (%d)" % len(clients))
+    except (asyncio.IncompleteReadError, ConnectionError, ValueError):
+        pass
+    finally:
+        writer.close()
+
+
+async def stream():
+    frame_no = 0
+    sequence = 0
+    sent = dropped = 0
+    while True:
+        await asyncio.sleep(1.0 / fps)
+        if not clients:
+            continue
+        frame = render(frame_no)
+        frame_no += 1
+        sequence = (sequence + 1) & 0xFFFF
+        for client in list(clients):
+            # Same back-pressure as the firmware: still writing = drop this frame for it
+            if client.writer.transport.get_write_buffer_size() > 0:
+                dropped += 1
+                continue
+            n = encoder.preview_encode(frame, client.base, WIDTH, HEIGHT, int(client.key), sequence, packet)
+            client.key = False
+            if n:
+                client.writer.write(ws_frame(0x2, packet.raw[:n]))
+                sent += 1
+        if frame_no % (fps * 10) == 0:
+            print("sent %d, dropped %d" % (sent, dropped))
+
+
+async def main():
+    server = await asyncio.start_server(handle, "0.0.0.0", port)
+    print("preview: http://localhost:%d/#preview (stream on /ws/preview)" % port)
+    async with server:
+        await asyncio.gather(server.serve_forever(), stream())
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+"""realtime_sim.py - send E1.31 / DDP test streams, or receive them with the firmware decoder.
+
+V16.7.3-2026-01-14T18:00:00Z - Initial implementation
+
+send: a moving rainbow over the 40 x 25 stream (both windows, row-major) at a given
+rate, as xLights would send it - to the board, or to a local listener:
+
+    python3 tools/realtime_sim.py send matrixshow.local --protocol e131 --fps 40
+    python3 tools/realtime_sim.py send 127.0.0.1 --protocol ddp --drop 0.02 --reorder 0.01
+
+--sync N adds E1.31 sync packets (and the sync address in the data); --drop and
+--reorder lose or swap packets to exercise the sequence checks.
+
+listen: compiles RealtimeProtocol.cpp into a shared library and feeds it every packet on
+UDP 5568 and 4048, so Linux sees the same frames, drops and timeouts the board does.
+Once a second it prints packets/s, frames/s, lost, late and first-packet -> frame latency:
+
+    python3 tools/realtime_sim.py listen [--seconds 30]
+
+Needs a C++ compiler (c++ or $CXX); standard library only otherwise. On the board the
+same counters are on /api/realtime and /metrics.
+"""
+
+import argparse
+import colorsys
+import ctypes
+import os
+import random
+import select
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+WIDTH, HEIGHT = 40, 25      # MATRIX_COUNT * COLS, ROWS
+PIXELS = WIDTH * HEIGHT     # REALTIME_PIXELS
+E131_PORT = 5568
+DDP_PORT = 4048
+UNIVERSE = 1                # REALTIME_UNIVERSE
+CHANNELS = 510              # REALTIME_UNIVERSE_CHANNELS
+FRAME_HOLD_MS = 40          # REALTIME_FRAME_HOLD_MS
+TIMEOUT_MS = 2500           # REALTIME_TIMEOUT_MS
+DDP_CHUNK = 1440            # Bytes per DDP packet (480 pixels)
+CID = bytes.fromhex("6d6174726978736877000000e131dd50")
+
+RESULTS = ["ignored", "dropped", "data", "frame", "terminated"]
+RT_FRAME, RT_TERMINATED = 3, 4
+
+
+class Stats(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_uint32) for name in
+                ("packets", "e131Packets", "ddpPackets", "syncPackets", "frames", "partialFrames",
+                 "lost", "outOfOrder", "malformed", "ignored", "latencyCount", "latencyMaxUs")] + \
+               [("latencySumUs", ctypes.c_uint64)]
+
+
+def e131_data(universe, sequence, channels, sync=0, terminated=False):
+    count = len(channels)
+    options = 0x40 if terminated else 0
+    return b"".join([
+        b"\x00\x10\x00\x00", b"ASC-E1.17\x00\x00\x00",
+        (0x7000 | (110 + count)).to_bytes(2, "big"), (4).to_bytes(4, "big"), CID,
+        (0x7000 | (88 + count)).to_bytes(2, "big"), (2).to_bytes(4, "big"),
+        b"MatrixShow realtime_sim".ljust(64, b"\x00"), bytes([100]), sync.to_bytes(2, "big"),
+        bytes([sequence & 0xFF, options]), universe.to_bytes(2, "big"),
+        (0x7000 | (11 + count)).to_bytes(2, "big"), b"\x02\xa1\x00\x00\x00\x01",
+        (count + 1).to_bytes(2, "big"), b"\x00", bytes(channels),
+    ])
+
+
+def e131_sync(sequence, address):
+    return b"".join([
+        b"\x00\x10\x00\x00", b"ASC-E1.17\x00\x00\x00",
+        (0x7000 | 33).to_bytes(2, "big"), (8).to_bytes(4, "big"), CID,
+        (0x7000 | 11).to_bytes(2, "big"), (1).to_bytes(4, "big"),
+        bytes([sequence & 0xFF]), address.to_bytes(2, "big"), b"\x00\x00",
+    ])
+
+
+def ddp_data(sequence, offset, data, push):
+    return bytes([0x41 if push else 0x40, sequence, 0x0B, 1]) + offset.to_bytes(4, "big") + \
+        len(data).to_bytes(2, "big") + data
+
+
+def rainbow(t):
+    frame = bytearray(PIXELS * 3)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            r, g, b = colorsys.hsv_to_rgb(((x + y) / 60.0 + t / 4.0) % 1.0, 1.0, 1.0)
+            i = (y * WIDTH + x) * 3
+            frame[i:i + 3] = bytes((int(r * 255), int(g * 255), int(b * 255)))
+    return frame
+
+
+def frame_packets(options, frame, state):
+    packets = []
+    if options.protocol == "e131":
+        per = CHANNELS // 3 * 3
+        for n, start in enumerate(range(0, len(frame), per)):
+            universe = UNIVERSE + n
+            seq = state.setdefault(universe, 0)
+            packets.append(e131_data(universe, seq, frame[start:start + per], options.sync))
+            state[universe] = (seq + 1) & 0xFF
+        if options.sync:
+            packets.append(e131_sync(state.get("sync", 0), options.sync))
+            state["sync"] = (state.get("sync", 0) + 1) & 0xFF
+    else:
+        starts = list(range(0, len(frame), DDP_CHUNK))
+        for start in starts:
+            seq = state.get("ddp", 0) % 15 + 1
+            state["ddp"] = seq
+            packets.append(ddp_data(seq, start, frame[start:start + DDP_CHUNK], start == starts[-1]))
+    return packets
+
+
+def send(options):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    port = options.port or (E131_PORT if options.protocol == "e131" else DDP_PORT)
+    address = (options.host, port)
+    state = {}
+    sent = dropped = swapped = 0
+    start = time.monotonic()
+    frames = int(options.seconds * options.fps)
+    for n in range(frames):
+        packets = frame_packets(options, rainbow(n / options.fps), state)
+        for i in range(len(packets) - 1):
+            if random.random() < options.reorder:
+                packets[i], packets[i + 1] = packets[i + 1], packets[i]
+                swapped += 1
+        for packet in packets:
+            if random.random() < options.drop:
+                dropped += 1
+                continue
+            sock.sendto(packet, address)
+            sent += 1
+        delay = start + (n + 1) / options.fps - time.monotonic()
+        if delay > 0:
+            time.sleep(delay)
+    if options.protocol == "e131" and not options.keep:
+        sock.sendto(e131_data(UNIVERSE, state.get(UNIVERSE, 0), b"", terminated=True), address)
+    print("%d frames, %d packets sent to %s:%d, %d dropped, %d swapped" %
+          (frames, sent, options.host, port, dropped, swapped))
+
+
+def load_decoder():
+    lib_path = os.path.join(tempfile.gettempdir(), "realtime_protocol.so")
+    subprocess.check_call([os.environ.get("CXX", "c++"), "-O2", "-shared", "-fPIC",
+                           "-DREALTIME_HOST_EXPORT", "-o", lib_path,
+                           os.path.join(root, "RealtimeProtocol.cpp")])
+    lib = ctypes.CDLL(lib_path)
+    lib.realtime_begin.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint16,
+                                   ctypes.c_uint16]
+    lib.realtime_handle.argtypes = [ctypes.c_int, ctypes.c_char_p, ctypes.c_size_t, ctypes.c_uint32]
+    lib.realtime_frame_stale.argtypes = [ctypes.c_uint32, ctypes.c_uint32]
+    lib.realtime_frame_shown.argtypes = [ctypes.c_uint32, ctypes.c_int]
+    lib.realtime_frame_shown.restype = ctypes.c_uint32
+    lib.realtime_stats.argtypes = [ctypes.POINTER(Stats)]
+    return lib
+
+
+def now_us():
+    return (time.monotonic_ns() // 1000) & 0xFFFFFFFF
+
+
+def listen(options):
+    lib = load_decoder()
+    leds = (ctypes.c_uint8 * (PIXELS * 3))()  # Stream order; the board maps through its wiring
+    if not lib.realtime_begin(leds, None, PIXELS, UNIVERSE, CHANNELS):
+        sys.exit("decoder rejected the layout")
+    sockets = {}
+    for source, port in ((0, options.e131_port), (1, options.ddp_port)):
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        sock.bind(("", port))
+        sockets[sock] = source
+    print("listening: E1.31 on %d (universes %d-%d), DDP on %d" %
+          (options.e131_port, UNIVERSE, UNIVERSE + (PIXELS * 3 + CHANNELS - 1) // CHANNELS - 1, options.ddp_port))
+
+    stats = Stats()
+    active = False
+    last_packet = mark = time.monotonic()
+    mark_packets = mark_frames = 0
+    end = time.monotonic() + options.seconds if options.seconds else None
+    while end is None or time.monotonic() < end:
+        ready, _, _ = select.select(list(sockets), [], [], 0.005)
+        for sock in ready:
+            packet = sock.recv(2048)
+            result = lib.realtime_handle(sockets[sock], packet, len(packet), now_us())
+            if RESULTS[result] in ("data", "frame"):
+                last_packet = time.monotonic()
+                if not active:
+                    active = True
+                    print("%s stream: display taken over" % ("DDP" if sockets[sock] else "E1.31"))
+            if result == RT_FRAME:
+                lib.realtime_frame_shown(now_us(), 0)
+            elif result == RT_TERMINATED and active:
+                active = False
+                print("Stream terminated: back to scheduled content")
+        if lib.realtime_frame_stale(now_us(), FRAME_HOLD_MS * 1000):
+            lib.realtime_frame_shown(now_us(), 1)
+        if active and time.monotonic() - last_packet > TIMEOUT_MS / 1000.0:
+            active = False
+            print("No packets: back to scheduled content")
+
+        if time.monotonic() - mark >= 1.0:
+            lib.realtime_stats(ctypes.byref(stats))
+            elapsed = time.monotonic() - mark
+            frames = stats.frames + stats.partialFrames
+            if stats.packets != mark_packets:
+                print("%5.0f pkt/s %5.1f fps  frames %d (+%d partial)  lost %d  late %d  malformed %d  "
+                      "latency avg %.2f ms max %.2f ms" %
+                      ((stats.packets - mark_packets) / elapsed, (frames - mark_frames) / elapsed,
+                       stats.frames, stats.partialFrames, stats.lost, stats.outOfOrder, stats.malformed,
+                       stats.latencySumUs / max(stats.latencyCount, 1) / 1000.0, stats.latencyMaxUs / 1000.0))
+            mark, mark_packets, mark_frames = time.monotonic(), stats.packets, frames
+
+    lib.realtime_stats(ctypes.byref(stats))
+    print("total: %d packets (%d E1.31, %d DDP, %d sync), %d frames + %d partial, %d lost, %d late, "
+          "%d malformed, %d ignored" %
+          (stats.packets, stats.e131Packets, stats.ddpPackets, stats.syncPackets, stats.frames,
+           stats.partialFrames, stats.lost, stats.outOfOrder, stats.malformed, stats.ignored))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+    sender = commands.add_parser("send", help="send a test stream")
+    sender.add_argument("host")
+    sender.add_argument("--protocol", choices=("e131", "ddp"), default="e131")
+    sender.add_argument("--port", type=int, default=0, help="default 5568 (E1.31) or 4048 (DDP)")
+    sender.add_argument("--fps", type=float, default=40)
+    sender.add_argument("--seconds", type=float, default=10)
+    sender.add_argument("--sync", type=int, default=0, help="E1.31 sync address (0 = unsynchronized)")
+    sender.add_argument("--drop", type=float, default=0, help="fraction of packets not sent")
+    sender.add_argument("--reorder", type=float, default=0, help="fraction of packets swapped with the next")
+    sender.add_argument("--keep", action="store_true", help="no stream-terminated packet at the end")
+    receiver = commands.add_parser("listen", help="decode with RealtimeProtocol.cpp and print stats")
+    receiver.add_argument("--e131-port", type=int, default=E131_PORT)
+    receiver.add_argument("--ddp-port", type=int, default=DDP_PORT)
+    receiver.add_argument("--seconds", type=float, default=0, help="stop after this long (0 = never)")
+    options = parser.parse_args()
+    send(options) if options.command == "send" else listen(options)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""trace_decode.py - print the crash-surviving event trace (TraceLog) from a dump.
+
+V16.7.1-2026-01-14T12:00:00Z - Initial implementation
+
+The dump is the "trace" partition, optionally followed by the pages still in RTC memory:
+
+    python3 tools/trace_decode.py http://matrixshow.local     # fetches /api/trace?raw=1
+    python3 tools/trace_decode.py trace.bin                    # any saved dump, or
+    esptool.py read_flash 0x370000 0x10000 trace.bin           # straight off a dead board
+
+Pages are ordered by sequence number; torn pages (CRC mismatch) are counted and skipped.
+Event names and argument names come from the TRACE_EVENTS table in TraceLog.h, so the
+tool follows the firmware it sits next to. Once a boot has a "clock" event, its lines also
+get wall time. Options: --boots N (last N boots only), --tail N (last N events).
+"""
+
+import argparse
+import datetime
+import os
+import re
+import struct
+import sys
+import urllib.request
+import zlib
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+MAGIC = 0x31435254
+VERSION = 1
+PAGE_BYTES = 256
+PAGE_RECORDS = 15
+HEADER = struct.Struct("<IIHBBI")  # magic, seq, boot, count, version, crc
+RECORD = struct.Struct("<IHBBii")  # timeMs, event, core, reserved, a, b
+
+RESET_REASONS = ["unknown", "power-on", "external", "software", "panic", "interrupt watchdog",
+                 "task watchdog", "watchdog", "deep sleep", "brownout", "SDIO"]
+
+
+def load_events():
+    with open(os.path.join(root, "TraceLog.h")) as f:
+        source = f.read()
+    table = re.findall(r'X\((TRACE_\w+),\s*"([^"]*)",\s*"([^"]*)",\s*"([^"]*)"\)', source)
+    return [(name, a, b) for _, name, a, b in table]
+
+
+def read_dump(source):
+    if re.match(r"https?://", source):
+        with urllib.request.urlopen(source.rstrip("/") + "/api/trace?raw=1", timeout=30) as response:
+            return response.read()
+    with open(source, "rb") as f:
+        return f.read()
+
+
+def parse_pages(data):
+    pages = {}
+    torn = 0
+    for offset in range(0, len(data) - PAGE_BYTES + 1, PAGE_BYTES):
+        page = data[offset:offset + PAGE_BYTES]
+        magic, seq, boot, count, version, crc = HEADER.unpack_from(page)
+        if magic != MAGIC:
+            continue  # Erased or never used
+        used = page[HEADER.size:HEADER.size + min(count, PAGE_RECORDS) * RECORD.size]
+        if version != VERSION or count > PAGE_RECORDS or zlib.crc32(used, zlib.crc32(page[:12])) != crc:
+            torn += 1  # Reset while it was being programmed
+            continue
+        records = [RECORD.unpack_from(page, HEADER.size + i * RECORD.size) for i in range(count)]
+        pages[seq] = (boot, records)  # RTC pages come last and win over a stale flash copy
+    return [pages[seq] for seq in sorted(pages)], torn
+
+
+def describe(events, event, a, b):
+    if event >= len(events):
+        return "event#%d" % event, "a=%d b=%d" % (a, b)
+    name, a_name, b_name = events[event]
+    args = []
+    if a_name:
+        args.append("%s=%d" % (a_name, a))
+    if b_name:
+        args.append("%s=%d" % (b_name, b))
+    if name == "boot":
+        args.append("(%s)" % (RESET_REASONS[a] if 0 <= a < len(RESET_REASONS) else "reason %d" % a))
+    elif name == "clock":
+        args[0] = datetime.datetime.fromtimestamp(a, datetime.timezone.utc).strftime("%Y-%m-%d %H:%M:%SZ")
+    return name, " ".join(args)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("source", help="http://<device> or a dump file")
+    parser.add_argument("--boots", type=int, default=0, help="only the last N boots")
+    parser.add_argument("--tail", type=int, default=0, help="only the last N events")
+    options = parser.parse_args()
+
+    events = load_events()
+    pages, torn = parse_pages(read_dump(options.source))
+    lines = [(boot, record) for boot, records in pages for record in records]
+    if options.boots:
+        boots = sorted({boot for boot, _ in lines})[-options.boots:]
+        lines = [line for line in lines if line[0] in boots]
+    if options.tail:
+        lines = lines[-options.tail:]
+
+    # Wall time per boot: unix - millis at its clock event
+    epoch = {}
+    for boot, (time_ms, event, _, _, a, _) in lines:
+        if event < len(events) and events[event][0] == "clock":
+            epoch.setdefault(boot, a - time_ms / 1000.0)
+
+    current = None
+    for boot, (time_ms, event, core, _, a, b) in lines:
+        if boot != current:
+            current = boot
+            print("---- boot %d" % boot)
+        wall = ""
+        if boot in epoch:
+            wall = datetime.datetime.fromtimestamp(epoch[boot] + time_ms / 1000.0, datetime.timezone.utc) \
+                .strftime("%H:%M:%S")
+        name, args = describe(events, event, a, b)
+        print("%10.3fs %8s  core%d  %-11s %s" % (time_ms / 1000.0, wall, core, name, args))
+
+    print("%d events in %d pages%s" % (len(lines), len(pages), ", %d torn pages skipped" % torn if torn else ""),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
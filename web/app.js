@@ -0,0 +1,244 @@
+// Matrix Show UI - renders from the JSON API; no page reloads.
+// V16.6.4-2026-01-14T00:00:00Z - Status, settings and logs pushed by /api/events (no polling)
+// V16.6.3-2026-01-13T21:00:00Z - Preview tab: canvas fed by /ws/preview
+// V16.6.1-2026-01-13T15:00:00Z - Initial implementation
+'use strict';
+
+const TYPE_LABEL = {
+  scene: '🖼️ Scene', animation: '🎞️ Animation', scroll: '📜 Scroll',
+  countdown: '⏳ Countdown', procedural: '✨ Procedural'
+};
+
+const $ = id => document.getElementById(id);
+const api = (path, params) => {
+  const query = params ? '?' + new URLSearchParams(params) : '';
+  return fetch(path + query).then(r => {
+    if (!r.ok) throw new Error(r.status + ' ' + r.statusText);
+    return (r.headers.get('Content-Type') || '').includes('json') ? r.json() : r.text();
+  });
+};
+
+let settings = {};
+let playingId = 0;
+
+function el(tag, attrs, ...children) {
+  const e = document.createElement(tag);
+  Object.assign(e, attrs || {});
+  for (const c of children) e.append(c);
+  return e;
+}
+
+// --- Control tab ---
+
+function renderContent(items) {
+  const byTheme = new Map();
+  for (const item of items) {
+    if (item.type === 'test') continue;
+    if (!byTheme.has(item.theme)) byTheme.set(item.theme, []);
+    byTheme.get(item.theme).push(item);
+  }
+  const root = $('content');
+  root.replaceChildren();
+  for (const [theme, list] of byTheme) {
+    const grid = el('div', {className: 'content-grid'});
+    for (const item of list) {
+      const button = el('button', {textContent: '▶️ Preview'});
+      button.onclick = () => api('/api/render', {id: item.id});
+      grid.append(el('div', {className: 'content-item', id: 'item' + item.id},
+        el('h3', {textContent: item.name}),
+        el('p', {textContent: TYPE_LABEL[item.type] || item.type}),
+        button));
+    }
+    root.append(el('div', {className: 'section'}, el('h2', {textContent: 'Theme: ' + theme}), grid));
+  }
+  markPlaying();
+}
+
+function renderThemes(data) {
+  const color = $('colorTheme');
+  color.replaceChildren(...data.themes.map(t =>
+    el('option', {value: t.name, textContent: t.name, selected: t.id === data.current})));
+  const filter = $('themeFilter');
+  filter.replaceChildren(el('option', {value: '', textContent: 'ALL THEMES'}),
+    ...data.contentThemes.map(t => el('option', {value: t, textContent: t})));
+  filter.value = settings.filter || '';
+}
+
+function markPlaying() {
+  for (const e of document.querySelectorAll('.content-item.playing')) e.classList.remove('playing');
+  const e = $('item' + playingId);
+  if (e) e.classList.add('playing');
+}
+
+// --- Schedule tab ---
+
+function renderSettings(s) {
+  settings = s;
+  if (document.activeElement !== $('brightness')) $('brightness').value = s.brightness;
+  $('brightnessValue').textContent = s.brightness;
+  $('interval').value = s.interval;
+  $('themeFilter').value = s.filter;
+  const toggle = $('randomToggle');
+  toggle.textContent = s.random ? '⛔ Disable Random Mode' : '✅ Enable Random Mode';
+  toggle.className = 'control-btn' + (s.random ? ' danger-btn' : '');
+}
+
+function setting(params) {
+  return api('/api/settings', params).then(renderSettings);
+}
+
+// --- Status line ---
+
+function renderStatus(s) {
+  playingId = s.playingId;
+  const up = s.uptime;
+  $('status').textContent =
+    'Playing: ' + (s.playing || '-') +
+    (s.zones ? ' (zones active)' : '') +
+    ' | Random: ' + (s.random ? 'on' : 'off') +
+    ' | ' + s.watts + ' W' +
+    ' | Heap: ' + Math.round(s.heap / 1024) + ' KB' +
+    ' | Up: ' + Math.floor(up / 3600) + 'h ' + Math.floor(up % 3600 / 60) + 'm';
+  markPlaying();
+}
+
+function refreshStatus() {
+  return api('/api/status').then(renderStatus)
+    .catch(e => { $('status').textContent = 'Offline: ' + e.message; });
+}
+
+// --- Live events ---
+// "state" carries the /api/status JSON whenever it changes (and every 10 s); "log" is one
+// line with its sequence number as the event id; "gap" counts lines that were lost.
+// After a drop the browser reconnects with Last-Event-ID and the device replays from there.
+
+const LOG_LINES = 200;
+let lastLogId = 0;
+
+function appendLog(text, className) {
+  const list = $('logList');
+  list.append(el('div', {className: 'log-entry' + (className ? ' ' + className : ''), textContent: text}));
+  while (list.childElementCount > LOG_LINES) list.firstElementChild.remove();
+}
+
+function connectEvents() {
+  const events = new EventSource('/api/events');
+  events.addEventListener('state', e => {
+    const s = JSON.parse(e.data);
+    renderStatus(s);
+    if (s.brightness !== settings.brightness || s.random !== settings.random || s.scheduler !== settings.scheduler) {
+      renderSettings(Object.assign({}, settings, {brightness: s.brightness, random: s.random, scheduler: s.scheduler}));
+    }
+  });
+  events.addEventListener('log', e => {
+    const id = Number(e.lastEventId);
+    if (id <= lastLogId) return;  // Already shown (replayed on reconnect)
+    lastLogId = id;
+    appendLog(e.data);
+  });
+  events.addEventListener('gap', e => appendLog('... ' + JSON.parse(e.data).missed + ' lines missed', 'gap'));
+  events.onerror = () => { $('status').textContent = 'Reconnecting...'; };
+}
+
+// --- Preview tab ---
+// Binary frames from /ws/preview (PreviewEncoder.h): 'F', flags, width, height, sequence,
+// then runs of {skip, count} - count bit 15 = one RGB repeated, else count RGB triplets.
+// Open only while the tab is shown; the device does no preview work without a socket.
+// ?ws=host:port takes the stream from elsewhere (tools/preview_sim.py).
+
+let previewSocket = null;
+let previewImage = null;
+let previewFrames = 0;
+let previewBytes = 0;
+
+function drawPreview(buffer) {
+  const view = new DataView(buffer);
+  if (buffer.byteLength < 8 || view.getUint8(0) !== 0x46) return;
+  const width = view.getUint16(2, true), height = view.getUint16(4, true);
+  const canvas = $('previewCanvas');
+  if (!previewImage || previewImage.width !== width || previewImage.height !== height) {
+    canvas.width = width;
+    canvas.height = height;
+    previewImage = canvas.getContext('2d').createImageData(width, height);
+    for (let i = 3; i < previewImage.data.length; i += 4) previewImage.data[i] = 255;
+  }
+  const px = previewImage.data, bytes = new Uint8Array(buffer);
+  let p = 8, i = 0;
+  while (p + 4 <= bytes.length) {
+    i += view.getUint16(p, true);
+    const count = view.getUint16(p + 2, true);
+    p += 4;
+    if (count & 0x8000) {
+      for (let n = count & 0x7FFF; n > 0; n--, i++) px.set(bytes.subarray(p, p + 3), i * 4);
+      p += 3;
+    } else {
+      for (let n = count; n > 0; n--, i++, p += 3) px.set(bytes.subarray(p, p + 3), i * 4);
+    }
+  }
+  canvas.getContext('2d').putImageData(previewImage, 0, 0);
+  previewFrames++;
+  previewBytes += buffer.byteLength;
+}
+
+function openPreview() {
+  if (previewSocket) return;
+  const host = new URLSearchParams(location.search).get('ws') || location.host;
+  previewSocket = new WebSocket('ws://' + host + '/ws/preview');
+  previewSocket.binaryType = 'arraybuffer';
+  previewSocket.onmessage = e => { if (e.data instanceof ArrayBuffer) drawPreview(e.data); };
+  previewSocket.onclose = () => {
+    previewSocket = null;
+    previewImage = null;  // Reconnect starts from a key frame
+    if (!$('preview').hidden) setTimeout(openPreview, 2000);
+  };
+  if (!$('previewFps').value) api('/api/preview').then(s => { $('previewFps').value = s.fps; }).catch(() => {});
+}
+
+function closePreview() {
+  if (previewSocket) previewSocket.close();
+}
+
+setInterval(() => {
+  if (!previewSocket) return;
+  $('previewStats').textContent = previewFrames + ' frames/s, ' + (previewBytes / 1024).toFixed(1) + ' KB/s';
+  previewFrames = previewBytes = 0;
+}, 1000);
+
+// --- Tabs ---
+
+function showTab() {
+  const tab = (location.hash || '#control').slice(1);
+  for (const t of document.querySelectorAll('.tab')) t.hidden = t.id !== tab;
+  for (const a of document.querySelectorAll('.nav a[data-tab]')) a.classList.toggle('active', a.dataset.tab === tab);
+  if (tab === 'preview') openPreview(); else closePreview();
+}
+
+// --- Wiring ---
+
+let brightnessTimer = 0;
+$('brightness').oninput = e => {
+  $('brightnessValue').textContent = e.target.value;
+  clearTimeout(brightnessTimer);
+  brightnessTimer = setTimeout(() => setting({brightness: e.target.value}), 150);
+};
+$('colorTheme').onchange = e => setting({theme: e.target.value});
+$('randomToggle').onclick = () => setting({random: settings.random ? 0 : 1});
+$('intervalSave').onclick = () => setting({interval: $('interval').value});
+$('themeFilter').onchange = e => setting({filter: e.target.value});
+$('previewFps').onchange = e => {
+  if (previewSocket && previewSocket.readyState === WebSocket.OPEN) previewSocket.send('fps=' + e.target.value);
+};
+for (const b of document.querySelectorAll('[data-api]')) {
+  b.onclick = () => api(b.dataset.api);
+}
+$('logsClear').onclick = () => {
+  if (confirm('Clear all logs?')) api('/api/logs/clear').then(() => $('logList').replaceChildren());
+};
+window.onhashchange = showTab;
+
+showTab();
+setting()
+  .then(() => Promise.all([api('/api/content'), api('/api/themes')]))
+  .then(([content, themes]) => { renderContent(content.items); renderThemes(themes); })
+  .then(refreshStatus)
+  .then(connectEvents);